@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Module: Calculator
+ *
+ * File Name: Calculator_CFG.h
+ *
+ * Description: Configuration file for the Calculator module to select the
+ *              evaluation engine and size its internal buffers.
+ *
+ * Author: Omar Khedr , Ali Ashraf
+ *
+ ******************************************************************************/
+
+#ifndef CALCULATOR_CFG_H_
+#define CALCULATOR_CFG_H_
+
+/************************************************************************************
+ * Description: Available evaluation engines.
+ *      - CALCULATOR_ENGINE_LEGACY: Rescans the expression for every operation and
+ *                                  splices each partial result back as ASCII.
+ *      - CALCULATOR_ENGINE_SINGLE_PASS: Walks the expression once using fixed-size
+ *                                       operand and operator stacks.
+ ************************************************************************************/
+#define CALCULATOR_ENGINE_LEGACY        0
+#define CALCULATOR_ENGINE_SINGLE_PASS   1
+
+/************************************************************************************
+ * Description: Select the engine used by Calculator_VOIDCalculation.
+ * Default: CALCULATOR_ENGINE_SINGLE_PASS
+ ************************************************************************************/
+#define CALCULATOR_ENGINE CALCULATOR_ENGINE_SINGLE_PASS
+
+/************************************************************************************
+ * Description: Available number types of the incremental evaluator.
+ *      - CALCULATOR_NUMBER_S32: Plain s32 with the overflow checks of the single-pass
+ *                               engine, a result beyond s32 reports "OVERFLOW!".
+ *      - CALCULATOR_NUMBER_TOWER: NUM_TOWER integers, which run small values at 16
+ *                                 bits and widen up to NUM_TOWER_BIG_DIGITS digits,
+ *                                 then report "OVERFLOW!".
+ *      - CALCULATOR_NUMBER_FIXED: NUM_FIXED decimals with NUM_FIXED_FRACTION_DIGITS
+ *                                 digits after the point, so 7/2 gives 3.5. Adds the
+ *                                 '.' key.
+ *      - CALCULATOR_NUMBER_FLOAT: The same decimals computed with the float routines
+ *                                 of the C library, for comparing code size and
+ *                                 cycles with CALCULATOR_NUMBER_FIXED only. Numbers are
+ *                                 still typed and shown through NUM_FIXED.
+ *      - CALCULATOR_NUMBER_RATIONAL: NUM_RATIONAL fractions, so 1/3*3 gives 1. A result
+ *                                    that is not an integer is shown as a fraction and
+ *                                    typed on as one, the live preview shows its
+ *                                    decimal expansion.
+ ************************************************************************************/
+#define CALCULATOR_NUMBER_S32   0
+#define CALCULATOR_NUMBER_TOWER 1
+#define CALCULATOR_NUMBER_FIXED 2
+#define CALCULATOR_NUMBER_FLOAT 3
+#define CALCULATOR_NUMBER_RATIONAL 4
+
+/************************************************************************************
+ * Description: Select the number type used by the incremental evaluator and streaming
+ *              sessions. May be set from the command line.
+ * Default: CALCULATOR_NUMBER_TOWER
+ ************************************************************************************/
+#ifndef CALCULATOR_NUMBER
+#define CALCULATOR_NUMBER CALCULATOR_NUMBER_TOWER
+#endif
+
+/* Numbers with a fraction accept the '.' key */
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_FIXED || CALCULATOR_NUMBER == CALCULATOR_NUMBER_FLOAT
+#define CALCULATOR_DECIMAL_POINT 1
+#else
+#define CALCULATOR_DECIMAL_POINT 0
+#endif
+
+/* Numbers with a fraction accept the function keys, integers would truncate their results */
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_S32 || CALCULATOR_NUMBER == CALCULATOR_NUMBER_TOWER
+#define CALCULATOR_FUNCTIONS 0
+#else
+#define CALCULATOR_FUNCTIONS 1
+#endif
+
+/************************************************************************************
+ * Description: Depth of the operand and operator stacks of the single-pass engine.
+ *              The two left-associative precedence levels keep at most two operators
+ *              pending, every '^' of a chain waits for the ones after it as '^' is
+ *              right-associative. 8 leaves room for a chain of five; a longer one is
+ *              reported as an overflow, which any base but 0, 1 and -1 would reach.
+ * Default: 8
+ ************************************************************************************/
+#define CALCULATOR_STACK_SIZE 8
+
+/************************************************************************************
+ * Description: Capacity of the token array filled by the lexer. A 39-character
+ *              expression holds at most 20 numbers and 19 operators plus '='.
+ * Default: 40
+ ************************************************************************************/
+#define CALCULATOR_MAX_TOKENS 40
+
+/************************************************************************************
+ * Description: Number of characters kept for the display of a streaming session,
+ *              which is also how far back 'C' can delete. Must be a power of two.
+ * Default: 32
+ ************************************************************************************/
+#define CALCULATOR_VIEW_SIZE 32
+
+/************************************************************************************
+ * Description: Number of operators the incremental evaluator can roll back with 'C'.
+ *              Every operator is preceded by a digit, so half the view is enough.
+ * Default: 16
+ ************************************************************************************/
+#define CALCULATOR_CHECKPOINTS (CALCULATOR_VIEW_SIZE / 2)
+
+/************************************************************************************
+ * Description: Show the value of the expression typed so far on the second line.
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ * Default: 1
+ ************************************************************************************/
+#define CALCULATOR_LIVE_PREVIEW 1
+
+#endif /* CALCULATOR_CFG_H_ */
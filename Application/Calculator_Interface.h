@@ -1,102 +1,359 @@
-/******************************************************************************
- *
- * Module: Calculator
- *
- * File Name: Calculator_Interface.h
- *
- * Description: Header file for the calculator module, containing function
- *              declarations for performing calculations and evaluating
- *              mathematical expressions.
- *
- * Author: Omar Khedr , Ali Ashraf
- *
- ******************************************************************************/
-
-#ifndef CALCULATOR_INTERFACE_H_
-#define CALCULATOR_INTERFACE_H_
-
-/* Include Standard Types Library */
-#include "../LIB/STD_TYPES.h"
-
-/* Include LCD and Keypad HAL Layers */
-#include "../HAL/LCD/HLCD_Interface.h"
-#include "../HAL/KeyPad/HKPD_Interface.h"
-
-/************************************************************************************
- * Function Name: Calculator_U8ErrorState
- * Description: Validates the input expression for errors, such as incorrect
- *              operators or missing elements.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- * Return:
- *      - u8: Error state (0: No error, 1: Error).
- ************************************************************************************/
-u8 Calculator_U8ErrorState(u8 *Copy_U8ExpressionArray);
-
-/************************************************************************************
- * Function Name: Calculator_U8OperationsOrder
- * Description: Determines the precedence order of operations in the given expression.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- *      - Copy_U8OrderArray: Pointer to the array that stores the order of operations.
- * Return:
- *      - u8: Number of operations found in the expression.
- ************************************************************************************/
-u8 Calculator_U8OperationsOrder(u8 *Copy_U8ExpressionArray, u8 *Copy_U8OrderArray);
-
-/************************************************************************************
- * Function Name: Calculator_U32GetPower
- * Description: Calculates the power of a number (base^exponent).
- * Parameters:
- *      - Copy_U32Number: The base number.
- *      - Copy_U8Power: The exponent.
- * Return:
- *      - u32: The result of the power calculation.
- ************************************************************************************/
-u32 Calculator_U32GetPower(u32 Copy_U32Number, u8 Copy_U8Power);
-
-/************************************************************************************
- * Function Name: Calculator_VOIDGetNumberBefore
- * Description: Extracts the number located before a specified index in the expression.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- *      - Copy_S32NumbersArray: Pointer to the array storing extracted numbers.
- *      - Copy_U8Index: The index of the operator in the expression.
- * Return: None
- ************************************************************************************/
-void Calculator_VOIDGetNumberBefore(u8 *Copy_U8ExpressionArray, s32 *Copy_S32NumbersArray, u8 Copy_U8Index);
-
-/************************************************************************************
- * Function Name: Calculator_VOIDGetNumberAfter
- * Description: Extracts the number located after a specified index in the expression.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- *      - Copy_S32NumbersArray: Pointer to the array storing extracted numbers.
- *      - Copy_U8Index: The index of the operator in the expression.
- * Return: None
- ************************************************************************************/
-void Calculator_VOIDGetNumberAfter(u8 *Copy_U8ExpressionArray, s32 *Copy_S32NumbersArray, u8 Copy_U8Index);
-
-/************************************************************************************
- * Function Name: Calculator_VOIDOperationCalculation
- * Description: Performs a calculation for a single operation based on its precedence.
- * Parameters:
- *      - Copy_U8OrderArray: Pointer to the array storing the order of operations.
- *      - Copy_U32NumbersArray: Pointer to the array of numbers involved in the calculation.
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- * Return:
- *      - u8: Operation status (0: Success, 1: Error).
- ************************************************************************************/
-u8 Calculator_VOIDOperationCalculation(u8 *Copy_U8OrderArray, s32 *Copy_U32NumbersArray, u8 *Copy_U8ExpressionArray);
-
-/************************************************************************************
- * Function Name: Calculator_VOIDCalculation
- * Description: Evaluates the entire expression and calculates the final result.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- * Return:
- *      - u8: Calculation status (0: Success, 1: Error).
- ************************************************************************************/
-u8 Calculator_VOIDCalculation(u8 *Copy_U8ExpressionArray);
-
-#endif /* CALCULATOR_INTERFACE_H_ */
+/******************************************************************************
+ *
+ * Module: Calculator
+ *
+ * File Name: Calculator_Interface.h
+ *
+ * Description: Header file for the calculator module, containing function
+ *              declarations for performing calculations and evaluating
+ *              mathematical expressions.
+ *
+ * Author: Omar Khedr , Ali Ashraf
+ *
+ ******************************************************************************/
+
+#ifndef CALCULATOR_INTERFACE_H_
+#define CALCULATOR_INTERFACE_H_
+
+/* Include Standard Types Library */
+#include "../LIB/STD_TYPES.h"
+
+/* Include Number Formatting Library */
+#include "../LIB/NUM_FMT.h"
+
+/* Include Numeric Tower Library */
+#include "../LIB/NUM_TOWER.h"
+
+/* Include Fixed-Point Decimal Library */
+#include "../LIB/NUM_FIXED.h"
+
+/* Include Rational Numbers Library */
+#include "../LIB/NUM_RATIONAL.h"
+
+/* Include Integer Powers Library */
+#include "../LIB/NUM_POW.h"
+
+/* Include Fixed-Point Functions Library */
+#include "../LIB/NUM_CORDIC.h"
+
+/* Include Calculator Configuration */
+#include "Calculator_CFG.h"
+
+/* Include LCD and Keypad HAL Layers */
+#include "../HAL/LCD/HLCD_Interface.h"
+#include "../HAL/KeyPad/HKPD_Interface.h"
+
+/* Include the Cycle Profiler marking the evaluation regions */
+#include "../MCAL/PROFILE/MPROFILE_Interface.h"
+
+/* Token kinds, operators use their own character as kind */
+#define CALCULATOR_TOKEN_NUMBER 0
+#define CALCULATOR_TOKEN_END    '='
+
+/* A lexed element of the expression, Value is only meaningful for numbers */
+typedef struct
+{
+	u8 Kind;
+	s32 Value;
+} Calculator_TokenType;
+
+/* Number type of the incremental evaluator, see CALCULATOR_NUMBER */
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_TOWER
+typedef NUM_TOWER_Type Calculator_NumberType;
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_FIXED
+typedef NUM_FIXED_Type Calculator_NumberType;
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_FLOAT
+typedef float Calculator_NumberType;
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+typedef NUM_RATIONAL_Type Calculator_NumberType;
+#else
+typedef s32 Calculator_NumberType;
+#endif
+
+/* Functions typed before a number when CALCULATOR_FUNCTIONS is 1, in the order of their
+ * profiler regions from MPROFILE_SQRT. A sign typed before a function is kept as CALCULATOR_FUNCTION_NEGATE. */
+#define CALCULATOR_FUNCTION_SQRT   1 /* 'r' */
+#define CALCULATOR_FUNCTION_SIN    2 /* 's' */
+#define CALCULATOR_FUNCTION_COS    3 /* 'c' */
+#define CALCULATOR_FUNCTION_ATAN   4 /* 'a' */
+#define CALCULATOR_FUNCTION_EXP    5 /* 'e' */
+#define CALCULATOR_FUNCTION_LN     6 /* 'l' */
+#define CALCULATOR_FUNCTION_NEGATE 7
+#define CALCULATOR_FUNCTION_BITS   3
+
+/* Running state of the incremental evaluator, also saved as a checkpoint per operator */
+typedef struct
+{
+	Calculator_NumberType Sum;    /* Sum of the completed terms */
+	Calculator_NumberType Term;   /* Product term waiting for MulOperator and Number */
+	Calculator_NumberType Number; /* Magnitude of the number being typed */
+	u8 AddOperator;   /* '+' or '-' applied to the term when it is completed */
+	u8 MulOperator;   /* '*' or '/' pending on Term, 0 when Number starts a term */
+	u8 Negative;      /* Number was preceded by a sign */
+	u8 Digits;        /* Digits typed for Number, and its point */
+	u8 Powers;        /* '^' pending on Number, their bases are the Numbers of the last checkpoints */
+	u8 Modular;       /* Number is the modulus of the pending powers, typed after '%' */
+#if CALCULATOR_FUNCTIONS == 1
+	u16 Functions;    /* Functions applied to Number, CALCULATOR_FUNCTION_BITS each, the last typed lowest */
+#endif
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+	u8 Approximate;   /* Sum, Term or a pending base went through a function */
+#endif
+#if CALCULATOR_DECIMAL_POINT == 1
+	u8 Point;         /* Position of the point in Number, see NUM_FIXED_U8AppendDigit */
+#endif
+} Calculator_CheckpointType;
+
+/* Incremental evaluator fed one key at a time */
+typedef struct
+{
+	Calculator_CheckpointType Current;
+	Calculator_CheckpointType Checkpoints[CALCULATOR_CHECKPOINTS];
+	u8 CheckpointsHead;   /* Ring slot the next checkpoint is saved in */
+	u8 CheckpointsNumber; /* Checkpoints that can still be rolled back */
+	u8 State;         /* Error state caused by the keys typed so far */
+	u8 ErrorKeys;     /* Keys typed since the error, including the one causing it */
+} Calculator_IncrementalType;
+
+/* Streaming session: evaluator plus the tail of the expression kept for the display */
+typedef struct
+{
+	Calculator_IncrementalType Evaluator;
+	u8 View[CALCULATOR_VIEW_SIZE]; /* Ring of the last characters typed */
+	u8 ViewHead;      /* Ring slot the next character is stored in */
+	u8 ViewCount;     /* Characters that can still be deleted */
+	u8 Length;        /* Characters on the line, saturating at 255 */
+	u8 Column;        /* DDRAM column of the cursor */
+	u8 WindowStart;   /* DDRAM column shown at the left edge of the LCD */
+	u8 ClearPending;  /* An error message is shown and must be cleared first */
+} Calculator_StreamType;
+
+/* Characters of a result on the LCD line, a longer one is shown in scientific notation.
+ * One column less than the LCD so that the cursor after a loaded result stays in view */
+#define CALCULATOR_RESULT_WIDTH 15
+
+/* Exact SRAM used by a streaming session, the expression itself is never stored */
+#define CALCULATOR_STREAM_FOOTPRINT (sizeof(Calculator_StreamType))
+
+/************************************************************************************
+ * Function Name: Calculator_U8ErrorState
+ * Description: Validates the input expression for errors, such as incorrect
+ *              operators or missing elements.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Error).
+ ************************************************************************************/
+u8 Calculator_U8ErrorState(u8 *Copy_U8ExpressionArray);
+
+/************************************************************************************
+ * Function Name: Calculator_U8OperationsOrder
+ * Description: Determines the precedence order of operations in the given expression.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ *      - Copy_U8OrderArray: Pointer to the array that stores the order of operations.
+ * Return:
+ *      - u8: Number of operations found in the expression.
+ ************************************************************************************/
+u8 Calculator_U8OperationsOrder(u8 *Copy_U8ExpressionArray, u8 *Copy_U8OrderArray);
+
+/************************************************************************************
+ * Function Name: Calculator_U32GetPower
+ * Description: Calculates the power of a number (base^exponent).
+ * Parameters:
+ *      - Copy_U32Number: The base number.
+ *      - Copy_U8Power: The exponent.
+ * Return:
+ *      - u32: The result of the power calculation.
+ ************************************************************************************/
+u32 Calculator_U32GetPower(u32 Copy_U32Number, u8 Copy_U8Power);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDGetNumberBefore
+ * Description: Extracts the number located before a specified index in the expression.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ *      - Copy_S32NumbersArray: Pointer to the array storing extracted numbers.
+ *      - Copy_U8Index: The index of the operator in the expression.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDGetNumberBefore(u8 *Copy_U8ExpressionArray, s32 *Copy_S32NumbersArray, u8 Copy_U8Index);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDGetNumberAfter
+ * Description: Extracts the number located after a specified index in the expression.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ *      - Copy_S32NumbersArray: Pointer to the array storing extracted numbers.
+ *      - Copy_U8Index: The index of the operator in the expression.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDGetNumberAfter(u8 *Copy_U8ExpressionArray, s32 *Copy_S32NumbersArray, u8 Copy_U8Index);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDOperationCalculation
+ * Description: Performs a calculation for a single operation based on its precedence.
+ * Parameters:
+ *      - Copy_U8OrderArray: Pointer to the array storing the order of operations.
+ *      - Copy_U32NumbersArray: Pointer to the array of numbers involved in the calculation.
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ * Return:
+ *      - u8: Operation status (0: Success, 1: Error).
+ ************************************************************************************/
+u8 Calculator_VOIDOperationCalculation(u8 *Copy_U8OrderArray, s32 *Copy_U32NumbersArray, u8 *Copy_U8ExpressionArray);
+
+/************************************************************************************
+ * Function Name: Calculator_U8Tokenize
+ * Description: Converts the ASCII expression into an array of tokens in one pass.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the '!'-prefixed, '='-terminated expression.
+ *      - Copy_TokensArray: Pointer to an array of CALCULATOR_MAX_TOKENS tokens.
+ *      - Copy_U8TokensNumber: Pointer to where the number of tokens is stored.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error, 3: Number too large for s32).
+ ************************************************************************************/
+u8 Calculator_U8Tokenize(u8 *Copy_U8ExpressionArray, Calculator_TokenType *Copy_TokensArray, u8 *Copy_U8TokensNumber);
+
+/************************************************************************************
+ * Function Name: Calculator_U8ValidateTokens
+ * Description: Checks that the tokens form "number (operator number)* =".
+ * Parameters:
+ *      - Copy_TokensArray: Pointer to the tokens array.
+ *      - Copy_U8TokensNumber: Number of tokens in the array.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error).
+ ************************************************************************************/
+u8 Calculator_U8ValidateTokens(Calculator_TokenType *Copy_TokensArray, u8 Copy_U8TokensNumber);
+
+/************************************************************************************
+ * Function Name: Calculator_U8Evaluate
+ * Description: Evaluates validated tokens in a single pass using fixed-size operand
+ *              and operator stacks.
+ * Parameters:
+ *      - Copy_TokensArray: Pointer to tokens accepted by Calculator_U8ValidateTokens.
+ *      - Copy_S32Result: Pointer to where the result is stored when no error occurs.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+u8 Calculator_U8Evaluate(Calculator_TokenType *Copy_TokensArray, s32 *Copy_S32Result);
+
+/************************************************************************************
+ * Function Name: Calculator_U8WriteResult
+ * Description: Writes a result back into the expression array as "!<result>=" so
+ *              that the user can keep chaining operations on it.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the expression array.
+ *      - Copy_S32Result: The result to write.
+ * Return:
+ *      - u8: Number of characters written for the result (sign included).
+ ************************************************************************************/
+u8 Calculator_U8WriteResult(u8 *Copy_U8ExpressionArray, s32 Copy_S32Result);
+
+/************************************************************************************
+ * Function Name: Calculator_U8ShowResult
+ * Description: Clears the LCD and shows either the error message matching the state
+ *              or the result, which is also written back into the expression array.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the expression array.
+ *      - Copy_U8State: Error state (0: No error, 1: Syntax error, 2: Math error,
+ *                      3: Overflow).
+ *      - Copy_S32Result: The result to show when there is no error.
+ * Return:
+ *      - u8: Counter value to continue typing after the result (0 after an error).
+ ************************************************************************************/
+u8 Calculator_U8ShowResult(u8 *Copy_U8ExpressionArray, u8 Copy_U8State, s32 Copy_S32Result);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalReset
+ * Description: Puts the incremental evaluator back to an empty expression.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalReset(Calculator_IncrementalType *Copy_Evaluator);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalLoad
+ * Description: Starts a new expression whose first operand is a previous result. A
+ *              fraction starts as the division that gives it.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PValue: The value to start from.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalLoad(Calculator_IncrementalType *Copy_Evaluator, const Calculator_NumberType *Copy_PValue);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalFeed
+ * Description: Applies one typed key to the running state of the evaluator.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_U8Key: The key to apply ('0'-'9', '+', '-', '*', '/', '^' or '%', a
+ *                    function key 'r', 's', 'c', 'a', 'e' or 'l', and '.' when
+ *                    CALCULATOR_DECIMAL_POINT is 1).
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalFeed(Calculator_IncrementalType *Copy_Evaluator, u8 Copy_U8Key);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalUndo
+ * Description: Rolls the running state back by one key (the 'C' key).
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalUndo(Calculator_IncrementalType *Copy_Evaluator);
+
+/************************************************************************************
+ * Function Name: Calculator_U8IncrementalResult
+ * Description: Finalizes the running state in constant time without modifying it.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PResult: Pointer to where the result is stored when no error occurs.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+u8 Calculator_U8IncrementalResult(Calculator_IncrementalType *Copy_Evaluator, Calculator_NumberType *Copy_PResult);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDShowPreview
+ * Description: Shows the value of the expression typed so far on the second LCD line.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_U8WindowStart: DDRAM column shown at the left edge of the LCD.
+ *      - Copy_U8CursorColumn: DDRAM column of the cursor on the first line.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDShowPreview(Calculator_IncrementalType *Copy_Evaluator, u8 Copy_U8WindowStart, u8 Copy_U8CursorColumn);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamReset
+ * Description: Starts an empty streaming session.
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDStreamReset(Calculator_StreamType *Copy_Stream);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamFeed
+ * Description: Consumes one key of an expression of unbounded length, updating the
+ *              running result and the display ('C' deletes, '=' shows the result).
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ *      - Copy_U8Key: The key from the keypad or any other byte source.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDStreamFeed(Calculator_StreamType *Copy_Stream, u8 Copy_U8Key);
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDCalculation
+ * Description: Evaluates the entire expression and calculates the final result.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ * Return:
+ *      - u8: Calculation status (0: Success, 1: Error).
+ ************************************************************************************/
+u8 Calculator_VOIDCalculation(u8 *Copy_U8ExpressionArray);
+
+#endif /* CALCULATOR_INTERFACE_H_ */
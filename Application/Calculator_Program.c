@@ -1,508 +1,2385 @@
-/******************************************************************************
- *
- * Module: Calculator
- *
- * File Name: Calculator_Program.c
- *
- * Description: Source file for the Calculator module, containing function
- *              implementations for performing calculations and evaluating
- *              mathematical expressions.
- *
- * Author: Omar Khedr , Ali Ashraf
- *
- ******************************************************************************/
-
-/* Include the header file for the Calculator module */
-#include "Calculator_Interface.h"
-
-/************************************************************************************
- * Function Name: Calculator_U8ErrorState
- * Description: Checks the input expression for syntax errors or invalid operations,
- *              such as misplaced operators or division by zero.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the array containing the expression to check.
- * Return:
- *      - u8: Error state (0: No error, 1: Syntax error, 2: Math error).
- ************************************************************************************/
-u8 Calculator_U8ErrorState(u8 * Copy_U8ExpressionArray)
-{
-	u8 LOC_U8State=0,LOC_U8Iterator=0;
-	/*
-	 * Checking if the second character of the expression is an operator.
-	 * If it's '+' or '*' or '/', set error state to 1.
-	 */
-	if(Copy_U8ExpressionArray[1]=='+' || Copy_U8ExpressionArray[1]=='*' || Copy_U8ExpressionArray[1]=='/' )
-	{
-		LOC_U8State=1;
-	}
-	/*
-	 * Looping through the expression starting from the third character,
-	 * checking if there are any invalid operations (consecutive operators).
-	 */
-	for(LOC_U8Iterator=2;Copy_U8ExpressionArray[LOC_U8Iterator]!='=' && !LOC_U8State;LOC_U8Iterator++)
-	{
-		/*
-		 * Checking if a valid operator is followed by another operator,
-		 * if so, set error state to 1.
-		 */
-		if(Copy_U8ExpressionArray[LOC_U8Iterator]== '+' || Copy_U8ExpressionArray[LOC_U8Iterator]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator]== '/')
-		{
-			if(Copy_U8ExpressionArray[LOC_U8Iterator+1]=='+'  || Copy_U8ExpressionArray[LOC_U8Iterator+1]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator+1]== '/')
-			{
-				LOC_U8State=1;
-			}
-		}
-		/*
-		 * Checking for division by zero error. If division by zero is detected, set error state to 2.
-		 */
-		if(Copy_U8ExpressionArray[LOC_U8Iterator]== '/')
-		{
-			if(Copy_U8ExpressionArray[LOC_U8Iterator+1]=='0')
-			{
-				if(Copy_U8ExpressionArray[LOC_U8Iterator+2]=='+'  || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '/' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '=')
-				{
-					LOC_U8State=2;
-				}
-			}
-		}
-	}
-	/*
-	 * If the last character is an operator, set error state to 1.
-	 */
-	if((Copy_U8ExpressionArray[LOC_U8Iterator-1]== '+' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '/') && !LOC_U8State)
-	{
-		LOC_U8State=1;
-	}
-	return LOC_U8State;
-}
-
-
-/************************************************************************************
- * Function Name: Calculator_U8OperationsOrder
- * Description: Identifies the order of operations in the expression based on precedence
- *              and stores the order in a separate array.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
- *      - Copy_U8OrderArray: Pointer to the array used to store the order of operations.
- * Return:
- *      - u8: The total number of operations detected in the expression.
- ************************************************************************************/
-u8 Calculator_U8OperationsOrder(u8 * Copy_U8ExpressionArray,u8 *Copy_U8OrderArray)
-{
-	u8 LOC_U8OperationsNumber=0,LOC_U8Iterator2=0;
-	/*
-	 * First loop: Finding positions of multiplication operations ('*') in the expression.
-	 */
-	for(u8 LOC_U8Iterator=0;Copy_U8ExpressionArray[LOC_U8Iterator];LOC_U8Iterator++)
-	{
-		if(Copy_U8ExpressionArray[LOC_U8Iterator]=='*')
-		{
-			Copy_U8OrderArray[LOC_U8Iterator2]=LOC_U8Iterator;
-			LOC_U8Iterator2++;
-			LOC_U8OperationsNumber++;
-		}
-	}
-	/*
-	 * Second loop: Finding positions of division operations ('/') in the expression.
-	 */
-	for(u8 iterator=0;Copy_U8ExpressionArray[iterator];iterator++)
-	{
-		if(Copy_U8ExpressionArray[iterator]=='/')
-		{
-			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
-			LOC_U8Iterator2++;
-			LOC_U8OperationsNumber++;
-		}
-	}
-	/*
-	 * Third loop: Finding positions of addition operations ('+') in the expression.
-	 */
-	for(u8 iterator=0;Copy_U8ExpressionArray[iterator];iterator++)
-	{
-		if(Copy_U8ExpressionArray[iterator]=='+')
-		{
-			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
-			LOC_U8Iterator2++;
-			LOC_U8OperationsNumber++;
-		}
-	}
-	/*
-	 * Fourth loop: Finding positions of subtraction operations ('-') in the expression.
-	 */
-	for(u8 iterator=2;Copy_U8ExpressionArray[iterator];iterator++)
-	{
-		if(Copy_U8ExpressionArray[iterator]=='-')
-		{
-			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
-			LOC_U8Iterator2++;
-			LOC_U8OperationsNumber++;
-		}
-	}
-	/*
-	 * Null-terminating the order array of operations.
-	 */
-	Copy_U8OrderArray[LOC_U8Iterator2]='\0';
-	return LOC_U8OperationsNumber;
-}
-
-
-/************************************************************************************
- * Function Name: Calculator_U32GetPower
- * Description: Computes the power of a base number raised to an exponent.
- * Parameters:
- *      - Copy_U32Number: The base number to calculate the power of.
- *      - Copy_U8Power: The exponent to raise the base number to.
- * Return:
- *      - u32: The result of the power calculation.
- ************************************************************************************/
-u32 Calculator_U32GetPower (u32 Copy_U32Number, u8 Copy_U8Power)
-{
-	u32 LOC_U32Result = 1;
-	/*
-	 * If the power is 0, the result is always 1 (any number raised to the power of 0 is 1).
-	 */
-	if(Copy_U8Power == 0)
-	{
-		LOC_U32Result = 1;
-	}
-	else
-	{
-		/*
-		 * Loop to calculate the number raised to the given power.
-		 */
-		for(u8 LOC_U8Iterator = 0; LOC_U8Iterator < Copy_U8Power; LOC_U8Iterator++)
-		{
-			LOC_U32Result = LOC_U32Result*Copy_U32Number;
-		}
-	}
-	return LOC_U32Result;
-}
-/************************************************************************************
- * Function Name: Calculator_VOIDGetNumberBefore
- * Description: Extracts the number immediately preceding an operator in the
- *              expression and stores it in the provided array.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
- *      - Copy_S32NumbersArray: Pointer to the array where the extracted number will be stored.
- *      - Copy_U8Index: The index in the expression where extraction begins.
- * Return:
- *      - void
- ************************************************************************************/
-void Calculator_VOIDGetNumberBefore(u8 *Copy_U8ExpressionArray , s32 *Copy_S32NumbersArray,u8 Copy_U8Index)
-{
-	u8 LOC_U8NumberOfnumbers=0;
-	s32 LOC_S32Accumlator = 0;
-	/*
-	 * Loop to accumulate the number before the operator.
-	 */
-	while(1)
-	{
-		if(Copy_U8ExpressionArray[Copy_U8Index-1] == '*' || Copy_U8ExpressionArray[Copy_U8Index-1] == '+' || Copy_U8ExpressionArray[Copy_U8Index-1] == '/' || Copy_U8ExpressionArray[Copy_U8Index-1] == '=' || Copy_U8ExpressionArray[Copy_U8Index-1] == '!' )
-		{
-			break;
-		}
-		if(Copy_U8ExpressionArray[Copy_U8Index-1]=='-')
-		{
-			LOC_S32Accumlator=(~LOC_S32Accumlator)+1;
-			break;
-		}
-		/*
-		 * Accumulating number from expression.
-		 */
-		LOC_S32Accumlator = LOC_S32Accumlator + ((Copy_U8ExpressionArray[Copy_U8Index-1]-48) * Calculator_U32GetPower(10,LOC_U8NumberOfnumbers));
-		Copy_U8Index--;
-		LOC_U8NumberOfnumbers++;
-	}
-	/*
-	 * Storing the accumulated number in the numbers array.
-	 */
-	Copy_S32NumbersArray[0] = LOC_S32Accumlator;
-}
-
-/************************************************************************************
- * Function Name: Calculator_VOIDGetNumberAfter
- * Description: Extracts the number immediately following an operator in the
- *              expression and stores it in the provided array.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
- *      - Copy_S32NumbersArray: Pointer to the array where the extracted number will be stored.
- *      - Copy_U8Index: The index in the expression where extraction begins.
- * Return:
- *      - void
- ************************************************************************************/
-void Calculator_VOIDGetNumberAfter(u8 *Copy_U8ExpressionArray , s32 *Copy_S32NumbersArray,u8 Copy_U8Index)
-{
-	u8 LOC_U8NumberOfnumbers=0;
-	u32 LOC_U32Accumlator = 0;
-	/*
-	 * Loop to accumulate the number after the operator.
-	 */
-	while(1)
-	{
-		if(Copy_U8ExpressionArray[Copy_U8Index+1] == '*' || Copy_U8ExpressionArray[Copy_U8Index+1] == '+' || Copy_U8ExpressionArray[Copy_U8Index+1] == '-' || Copy_U8ExpressionArray[Copy_U8Index+1] == '/' || Copy_U8ExpressionArray[Copy_U8Index+1] == '=' || Copy_U8ExpressionArray[Copy_U8Index+1] == '!' )
-		{
-			break;
-		}
-		Copy_U8Index++;
-		LOC_U8NumberOfnumbers++;
-	}
-	/*
-	 * Adjust the index back to where the number starts.
-	 */
-	Copy_U8Index=Copy_U8Index-LOC_U8NumberOfnumbers;
-	/*
-	 * Loop to store the number after the operator in the numbers array.
-	 */
-	while (LOC_U8NumberOfnumbers)
-	{
-		LOC_U32Accumlator=LOC_U32Accumlator+((Copy_U8ExpressionArray[Copy_U8Index+1]-48)*Calculator_U32GetPower(10,LOC_U8NumberOfnumbers-1));
-		LOC_U8NumberOfnumbers--;
-		Copy_U8Index++;
-	}
-	Copy_S32NumbersArray[1] = LOC_U32Accumlator;
-}
-
-/************************************************************************************
- * Function Name: Calculator_VOIDOperationCalculation
- * Description: Executes a single mathematical operation from the input expression,
- *              updates the expression with the result, and adjusts indices accordingly.
- * Parameters:
- *      - Copy_U8OrderArray: Pointer to the array containing the indices of operations
- *                           in the expression based on their precedence.
- *      - Copy_U32NumbersArray: Pointer to an array that stores the operands for the
- *                              current operation.
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- * Return:
- *      - u8: Length of the resulting number after the operation.
- ************************************************************************************/
-u8 Calculator_VOIDOperationCalculation(u8 *Copy_U8OrderArray, s32 *Copy_U32NumbersArray, u8 *Copy_U8ExpressionArray)
-{
-    s32 LOC_S32Result = 0; /* Variable to store the result of the operation */
-    u8 LOC_U8Length1 = 0, LOC_U8Length2 = 0, LOC_U8ResultLength = 0, LOC_U8StartIndex, LOC_U8EndIndex;
-    s32 LOC_S32UsedNum1, LOC_S32UsedNum2;
-
-    /* Retrieve the number before the operator in the expression */
-    Calculator_VOIDGetNumberBefore(Copy_U8ExpressionArray, Copy_U32NumbersArray, Copy_U8OrderArray[0]);
-
-    /* Retrieve the number after the operator in the expression */
-    Calculator_VOIDGetNumberAfter(Copy_U8ExpressionArray, Copy_U32NumbersArray, Copy_U8OrderArray[0]);
-
-    LOC_S32UsedNum1 = Copy_U32NumbersArray[0]; /* First operand */
-    LOC_S32UsedNum2 = Copy_U32NumbersArray[1]; /* Second operand */
-
-    /* Calculate the length of the first operand, considering its sign */
-    if (LOC_S32UsedNum1 < 0)
-    {
-        LOC_S32UsedNum1 = (~LOC_S32UsedNum1) + 1;
-        LOC_U8Length1++;
-    }
-    if (LOC_S32UsedNum2 < 0)
-    {
-        LOC_S32UsedNum2 = (~LOC_S32UsedNum2) + 1;
-        LOC_U8Length2++;
-    }
-
-    /* Handle cases where operands are zero */
-    if (LOC_S32UsedNum1 == 0)
-    {
-        LOC_U8Length1++;
-    }
-    if (LOC_S32UsedNum2 == 0)
-    {
-        LOC_U8Length2++;
-    }
-
-    /* Calculate the length of each operand */
-    while (LOC_S32UsedNum1)
-    {
-        LOC_S32UsedNum1 = LOC_S32UsedNum1 / 10;
-        LOC_U8Length1++;
-    }
-    while (LOC_S32UsedNum2)
-    {
-        LOC_S32UsedNum2 = LOC_S32UsedNum2 / 10;
-        LOC_U8Length2++;
-    }
-
-    /* Determine the start and end indices for the operation in the expression */
-    LOC_U8StartIndex = Copy_U8OrderArray[0] - LOC_U8Length1;
-    LOC_U8EndIndex = Copy_U8OrderArray[0] + LOC_U8Length2;
-
-    /* Perform the mathematical operation based on the operator */
-    switch (Copy_U8ExpressionArray[Copy_U8OrderArray[0]])
-    {
-    case '*': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] * Copy_U32NumbersArray[1]); break;
-    case '+': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] + Copy_U32NumbersArray[1]); break;
-    case '-': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] - Copy_U32NumbersArray[1]); break;
-    case '/': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] / Copy_U32NumbersArray[1]); break;
-    default: break;
-    }
-
-    s32 LOC_S32UsedResult = LOC_S32Result; /* Store the result for further processing */
-    s32 LOC_S32Reversed = 1, LOC_S32SentCharacter;
-
-    /* Handle the result if it is zero */
-    if (0 == LOC_S32UsedResult)
-    {
-        Copy_U8ExpressionArray[LOC_U8StartIndex] = 48; /* Replace with '0' */
-
-        /* Adjust the indices to remove extra characters */
-        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
-        {
-            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength + 1; LOC_U8Iterator--)
-            {
-                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
-            }
-            LOC_U8EndIndex++;
-            LOC_U8StartIndex++;
-            LOC_U8ResultLength++;
-        }
-    }
-
-    /* Handle the result if it is positive */
-    else if (LOC_S32UsedResult > 0)
-    {
-        /* Reverse the digits of the result */
-        while (LOC_S32UsedResult > 0)
-        {
-            LOC_S32Reversed = (LOC_S32Reversed * 10) + (LOC_S32UsedResult % 10);
-            LOC_S32UsedResult = LOC_S32UsedResult / 10;
-        }
-
-        /* Store the digits of the result back into the expression array */
-        u8 LOC_U8Iterator2 = 0;
-        while (LOC_S32Reversed > 1)
-        {
-            LOC_S32SentCharacter = LOC_S32Reversed % 10;
-            Copy_U8ExpressionArray[LOC_U8StartIndex + LOC_U8Iterator2] = LOC_S32SentCharacter + 48;
-            LOC_S32Reversed = LOC_S32Reversed / 10;
-            LOC_U8Iterator2++;
-        }
-
-        /* Calculate the length of the result */
-        while (LOC_S32Result)
-        {
-            LOC_S32Result = LOC_S32Result / 10;
-            LOC_U8ResultLength++;
-        }
-
-        /* Adjust the indices to remove extra characters */
-        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
-        {
-            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength; LOC_U8Iterator--)
-            {
-                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
-            }
-            LOC_U8EndIndex++;
-            LOC_U8StartIndex++;
-        }
-    }
-
-    /* Handle the result if it is negative */
-    else
-    {
-        LOC_S32UsedResult = (~LOC_S32UsedResult) + 1; /* Convert to positive */
-        Copy_U8ExpressionArray[LOC_U8StartIndex] = '-'; /* Add the negative sign */
-        LOC_U8ResultLength++;
-
-        /* Reverse the digits of the result */
-        while (LOC_S32UsedResult > 0)
-        {
-            LOC_S32Reversed = (LOC_S32Reversed * 10) + (LOC_S32UsedResult % 10);
-            LOC_S32UsedResult = LOC_S32UsedResult / 10;
-        }
-
-        /* Store the digits of the result back into the expression array */
-        u8 LOC_U8Iterator2 = 0;
-        while (LOC_S32Reversed > 1)
-        {
-            LOC_S32SentCharacter = LOC_S32Reversed % 10;
-            Copy_U8ExpressionArray[LOC_U8StartIndex + 1 + LOC_U8Iterator2] = LOC_S32SentCharacter + 48;
-            LOC_S32Reversed = LOC_S32Reversed / 10;
-            LOC_U8Iterator2++;
-        }
-
-        /* Calculate the length of the result */
-        LOC_S32Result = (~LOC_S32Result) + 1;
-        while (LOC_S32Result)
-        {
-            LOC_S32Result = LOC_S32Result / 10;
-            LOC_U8ResultLength++;
-        }
-
-        /* Adjust the indices to remove extra characters */
-        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
-        {
-            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength; LOC_U8Iterator--)
-            {
-                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
-            }
-            LOC_U8EndIndex++;
-            LOC_U8StartIndex++;
-        }
-    }
-
-    return LOC_U8ResultLength; /* Return the length of the result */
-}
-
-
-
-/************************************************************************************
- * Function Name: Calculator_VOIDCalculation
- * Description: Evaluates the entire mathematical expression by parsing operators and
- *              operands, performing calculations, and displaying the result on an LCD.
- * Parameters:
- *      - Copy_U8ExpressionArray: Pointer to the input expression array.
- * Return:
- *      - u8: Final counter value after the calculations are completed.
- ************************************************************************************/
-u8 Calculator_VOIDCalculation(u8 *Copy_U8ExpressionArray)
-{
-	u8 LOC_U8State = 0, LOC_U8RetCounterValue = 0;
-
-	/* Clear the LCD display */
-	HLCD_VOIDClearDisplay();
-
-	/* Check for any syntax or mathematical errors in the expression */
-	LOC_U8State = Calculator_U8ErrorState(Copy_U8ExpressionArray);
-
-	/* Display error message if syntax error */
-	if (1 == LOC_U8State)
-	{
-		HLCD_VOIDSendString("SYNTAX ERROR!");
-	}
-	/* Display error message if mathematical error (e.g., division by zero) */
-	else if (2 == LOC_U8State)
-	{
-		HLCD_VOIDSendString("MATH ERROR!");
-	}
-	/* No errors, proceed with calculations */
-	else if (0 == LOC_U8State)
-	{
-		u8 LOC_U8OperationsOrder[20];  /* Array to store the order of operations */
-		s32 LOC_S32NumbersArray[2];    /* Array to store operands for the current operation */
-		u8 LOC_U8NumberofOperations = Calculator_U8OperationsOrder(Copy_U8ExpressionArray, LOC_U8OperationsOrder);  /* Get the number of operations to perform */
-
-		/* Loop through and perform each operation */
-		while (LOC_U8NumberofOperations > 0)
-		{
-			/* Perform the current operation */
-			LOC_U8RetCounterValue = Calculator_VOIDOperationCalculation(LOC_U8OperationsOrder, LOC_S32NumbersArray, Copy_U8ExpressionArray);
-
-			/* Recalculate the order of operations after each calculation */
-			LOC_U8NumberofOperations = Calculator_U8OperationsOrder(Copy_U8ExpressionArray, LOC_U8OperationsOrder);
-		}
-
-		u8 LOC_U8Iterator = 1;
-
-		/* Display the result on the LCD screen until '=' is encountered */
-		while (Copy_U8ExpressionArray[LOC_U8Iterator] != '=')
-		{
-			HLCD_VOIDSendCharacter(Copy_U8ExpressionArray[LOC_U8Iterator]);
-			LOC_U8Iterator++;
-		}
-	}
-
-	return LOC_U8RetCounterValue;  /* Return the counter value after calculation */
-}
-
+/******************************************************************************
+ *
+ * Module: Calculator
+ *
+ * File Name: Calculator_Program.c
+ *
+ * Description: Source file for the Calculator module, containing function
+ *              implementations for performing calculations and evaluating
+ *              mathematical expressions.
+ *
+ * Author: Omar Khedr , Ali Ashraf
+ *
+ ******************************************************************************/
+
+/* Include the header file for the Calculator module */
+#include "Calculator_Interface.h"
+
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_FLOAT
+/* Include the float functions of the C library */
+#include <math.h>
+#endif
+
+/* The second layer of the keypad must only give the keys this number type accepts */
+#if HKPD_SHIFT_POINT != CALCULATOR_DECIMAL_POINT || HKPD_SHIFT_FUNCTIONS != CALCULATOR_FUNCTIONS
+#error "HKPD_SHIFT_POINT and HKPD_SHIFT_FUNCTIONS must match CALCULATOR_DECIMAL_POINT and CALCULATOR_FUNCTIONS"
+#endif
+
+/************************************************************************************
+ * Function Name: Calculator_U8ErrorState
+ * Description: Checks the input expression for syntax errors or invalid operations,
+ *              such as misplaced operators or division by zero.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the array containing the expression to check.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error, 2: Math error).
+ ************************************************************************************/
+u8 Calculator_U8ErrorState(u8 * Copy_U8ExpressionArray)
+{
+	u8 LOC_U8State=0,LOC_U8Iterator=0;
+	MPROFILE_ENTER(MPROFILE_ERROR_STATE);
+	/*
+	 * Checking if the second character of the expression is an operator.
+	 * If it's '+' or '*' or '/', set error state to 1.
+	 */
+	if(Copy_U8ExpressionArray[1]=='+' || Copy_U8ExpressionArray[1]=='*' || Copy_U8ExpressionArray[1]=='/' )
+	{
+		LOC_U8State=1;
+	}
+	/*
+	 * Only digits and the four operators are known to this engine, it has no '^'.
+	 */
+	for(LOC_U8Iterator=1;Copy_U8ExpressionArray[LOC_U8Iterator]!='=' && !LOC_U8State;LOC_U8Iterator++)
+	{
+		if((Copy_U8ExpressionArray[LOC_U8Iterator]<'0' || Copy_U8ExpressionArray[LOC_U8Iterator]>'9') && Copy_U8ExpressionArray[LOC_U8Iterator]!='+' && Copy_U8ExpressionArray[LOC_U8Iterator]!='-' && Copy_U8ExpressionArray[LOC_U8Iterator]!='*' && Copy_U8ExpressionArray[LOC_U8Iterator]!='/')
+		{
+			LOC_U8State=1;
+		}
+	}
+	/*
+	 * Looping through the expression starting from the third character,
+	 * checking if there are any invalid operations (consecutive operators).
+	 */
+	for(LOC_U8Iterator=2;Copy_U8ExpressionArray[LOC_U8Iterator]!='=' && !LOC_U8State;LOC_U8Iterator++)
+	{
+		/*
+		 * Checking if a valid operator is followed by another operator,
+		 * if so, set error state to 1.
+		 */
+		if(Copy_U8ExpressionArray[LOC_U8Iterator]== '+' || Copy_U8ExpressionArray[LOC_U8Iterator]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator]== '/')
+		{
+			if(Copy_U8ExpressionArray[LOC_U8Iterator+1]=='+'  || Copy_U8ExpressionArray[LOC_U8Iterator+1]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator+1]== '/')
+			{
+				LOC_U8State=1;
+			}
+		}
+		/*
+		 * Checking for division by zero error. If division by zero is detected, set error state to 2.
+		 */
+		if(Copy_U8ExpressionArray[LOC_U8Iterator]== '/')
+		{
+			if(Copy_U8ExpressionArray[LOC_U8Iterator+1]=='0')
+			{
+				if(Copy_U8ExpressionArray[LOC_U8Iterator+2]=='+'  || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '/' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator+2]== '=')
+				{
+					LOC_U8State=2;
+				}
+			}
+		}
+	}
+	/*
+	 * If the last character is an operator, set error state to 1.
+	 */
+	if((Copy_U8ExpressionArray[LOC_U8Iterator-1]== '+' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '-' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '*' || Copy_U8ExpressionArray[LOC_U8Iterator-1]== '/') && !LOC_U8State)
+	{
+		LOC_U8State=1;
+	}
+	MPROFILE_EXIT(MPROFILE_ERROR_STATE);
+	return LOC_U8State;
+}
+
+
+/************************************************************************************
+ * Function Name: Calculator_U8OperationsOrder
+ * Description: Identifies the order of operations in the expression based on precedence
+ *              and stores the order in a separate array.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
+ *      - Copy_U8OrderArray: Pointer to the array used to store the order of operations.
+ * Return:
+ *      - u8: The total number of operations detected in the expression.
+ ************************************************************************************/
+u8 Calculator_U8OperationsOrder(u8 * Copy_U8ExpressionArray,u8 *Copy_U8OrderArray)
+{
+	u8 LOC_U8OperationsNumber=0,LOC_U8Iterator2=0;
+	MPROFILE_ENTER(MPROFILE_OPERATIONS_ORDER);
+	/*
+	 * First loop: Finding positions of multiplication operations ('*') in the expression.
+	 */
+	for(u8 LOC_U8Iterator=0;Copy_U8ExpressionArray[LOC_U8Iterator];LOC_U8Iterator++)
+	{
+		if(Copy_U8ExpressionArray[LOC_U8Iterator]=='*')
+		{
+			Copy_U8OrderArray[LOC_U8Iterator2]=LOC_U8Iterator;
+			LOC_U8Iterator2++;
+			LOC_U8OperationsNumber++;
+		}
+	}
+	/*
+	 * Second loop: Finding positions of division operations ('/') in the expression.
+	 */
+	for(u8 iterator=0;Copy_U8ExpressionArray[iterator];iterator++)
+	{
+		if(Copy_U8ExpressionArray[iterator]=='/')
+		{
+			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
+			LOC_U8Iterator2++;
+			LOC_U8OperationsNumber++;
+		}
+	}
+	/*
+	 * Third loop: Finding positions of addition operations ('+') in the expression.
+	 */
+	for(u8 iterator=0;Copy_U8ExpressionArray[iterator];iterator++)
+	{
+		if(Copy_U8ExpressionArray[iterator]=='+')
+		{
+			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
+			LOC_U8Iterator2++;
+			LOC_U8OperationsNumber++;
+		}
+	}
+	/*
+	 * Fourth loop: Finding positions of subtraction operations ('-') in the expression.
+	 */
+	for(u8 iterator=2;Copy_U8ExpressionArray[iterator];iterator++)
+	{
+		if(Copy_U8ExpressionArray[iterator]=='-')
+		{
+			Copy_U8OrderArray[LOC_U8Iterator2]=iterator;
+			LOC_U8Iterator2++;
+			LOC_U8OperationsNumber++;
+		}
+	}
+	/*
+	 * Null-terminating the order array of operations.
+	 */
+	Copy_U8OrderArray[LOC_U8Iterator2]='\0';
+	MPROFILE_EXIT(MPROFILE_OPERATIONS_ORDER);
+	return LOC_U8OperationsNumber;
+}
+
+
+/************************************************************************************
+ * Function Name: Calculator_U32GetPower
+ * Description: Computes the power of a base number raised to an exponent.
+ * Parameters:
+ *      - Copy_U32Number: The base number to calculate the power of.
+ *      - Copy_U8Power: The exponent to raise the base number to.
+ * Return:
+ *      - u32: The result of the power calculation.
+ ************************************************************************************/
+u32 Calculator_U32GetPower (u32 Copy_U32Number, u8 Copy_U8Power)
+{
+	u32 LOC_U32Result = 1;
+	/*
+	 * If the power is 0, the result is always 1 (any number raised to the power of 0 is 1).
+	 */
+	if(Copy_U8Power == 0)
+	{
+		LOC_U32Result = 1;
+	}
+	else
+	{
+		/*
+		 * Loop to calculate the number raised to the given power.
+		 */
+		for(u8 LOC_U8Iterator = 0; LOC_U8Iterator < Copy_U8Power; LOC_U8Iterator++)
+		{
+			LOC_U32Result = LOC_U32Result*Copy_U32Number;
+		}
+	}
+	return LOC_U32Result;
+}
+/************************************************************************************
+ * Function Name: Calculator_VOIDGetNumberBefore
+ * Description: Extracts the number immediately preceding an operator in the
+ *              expression and stores it in the provided array.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
+ *      - Copy_S32NumbersArray: Pointer to the array where the extracted number will be stored.
+ *      - Copy_U8Index: The index in the expression where extraction begins.
+ * Return:
+ *      - void
+ ************************************************************************************/
+void Calculator_VOIDGetNumberBefore(u8 *Copy_U8ExpressionArray , s32 *Copy_S32NumbersArray,u8 Copy_U8Index)
+{
+	u8 LOC_U8NumberOfnumbers=0;
+	s32 LOC_S32Accumlator = 0;
+	/*
+	 * Loop to accumulate the number before the operator.
+	 */
+	while(1)
+	{
+		if(Copy_U8ExpressionArray[Copy_U8Index-1] == '*' || Copy_U8ExpressionArray[Copy_U8Index-1] == '+' || Copy_U8ExpressionArray[Copy_U8Index-1] == '/' || Copy_U8ExpressionArray[Copy_U8Index-1] == '=' || Copy_U8ExpressionArray[Copy_U8Index-1] == '!' )
+		{
+			break;
+		}
+		if(Copy_U8ExpressionArray[Copy_U8Index-1]=='-')
+		{
+			LOC_S32Accumlator=(~LOC_S32Accumlator)+1;
+			break;
+		}
+		/*
+		 * Accumulating number from expression.
+		 */
+		LOC_S32Accumlator = LOC_S32Accumlator + ((Copy_U8ExpressionArray[Copy_U8Index-1]-48) * Calculator_U32GetPower(10,LOC_U8NumberOfnumbers));
+		Copy_U8Index--;
+		LOC_U8NumberOfnumbers++;
+	}
+	/*
+	 * Storing the accumulated number in the numbers array.
+	 */
+	Copy_S32NumbersArray[0] = LOC_S32Accumlator;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDGetNumberAfter
+ * Description: Extracts the number immediately following an operator in the
+ *              expression and stores it in the provided array.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the array containing the mathematical expression.
+ *      - Copy_S32NumbersArray: Pointer to the array where the extracted number will be stored.
+ *      - Copy_U8Index: The index in the expression where extraction begins.
+ * Return:
+ *      - void
+ ************************************************************************************/
+void Calculator_VOIDGetNumberAfter(u8 *Copy_U8ExpressionArray , s32 *Copy_S32NumbersArray,u8 Copy_U8Index)
+{
+	u8 LOC_U8NumberOfnumbers=0;
+	u32 LOC_U32Accumlator = 0;
+	/*
+	 * Loop to accumulate the number after the operator.
+	 */
+	while(1)
+	{
+		if(Copy_U8ExpressionArray[Copy_U8Index+1] == '*' || Copy_U8ExpressionArray[Copy_U8Index+1] == '+' || Copy_U8ExpressionArray[Copy_U8Index+1] == '-' || Copy_U8ExpressionArray[Copy_U8Index+1] == '/' || Copy_U8ExpressionArray[Copy_U8Index+1] == '=' || Copy_U8ExpressionArray[Copy_U8Index+1] == '!' )
+		{
+			break;
+		}
+		Copy_U8Index++;
+		LOC_U8NumberOfnumbers++;
+	}
+	/*
+	 * Adjust the index back to where the number starts.
+	 */
+	Copy_U8Index=Copy_U8Index-LOC_U8NumberOfnumbers;
+	/*
+	 * Loop to store the number after the operator in the numbers array.
+	 */
+	while (LOC_U8NumberOfnumbers)
+	{
+		LOC_U32Accumlator=LOC_U32Accumlator+((Copy_U8ExpressionArray[Copy_U8Index+1]-48)*Calculator_U32GetPower(10,LOC_U8NumberOfnumbers-1));
+		LOC_U8NumberOfnumbers--;
+		Copy_U8Index++;
+	}
+	Copy_S32NumbersArray[1] = LOC_U32Accumlator;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDOperationCalculation
+ * Description: Executes a single mathematical operation from the input expression,
+ *              updates the expression with the result, and adjusts indices accordingly.
+ * Parameters:
+ *      - Copy_U8OrderArray: Pointer to the array containing the indices of operations
+ *                           in the expression based on their precedence.
+ *      - Copy_U32NumbersArray: Pointer to an array that stores the operands for the
+ *                              current operation.
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ * Return:
+ *      - u8: Length of the resulting number after the operation.
+ ************************************************************************************/
+u8 Calculator_VOIDOperationCalculation(u8 *Copy_U8OrderArray, s32 *Copy_U32NumbersArray, u8 *Copy_U8ExpressionArray)
+{
+    s32 LOC_S32Result = 0; /* Variable to store the result of the operation */
+    u8 LOC_U8Length1 = 0, LOC_U8Length2 = 0, LOC_U8ResultLength = 0, LOC_U8StartIndex, LOC_U8EndIndex;
+    s32 LOC_S32UsedNum1, LOC_S32UsedNum2;
+
+    MPROFILE_ENTER(MPROFILE_OPERATION);
+
+    /* Retrieve the number before the operator in the expression */
+    Calculator_VOIDGetNumberBefore(Copy_U8ExpressionArray, Copy_U32NumbersArray, Copy_U8OrderArray[0]);
+
+    /* Retrieve the number after the operator in the expression */
+    Calculator_VOIDGetNumberAfter(Copy_U8ExpressionArray, Copy_U32NumbersArray, Copy_U8OrderArray[0]);
+
+    LOC_S32UsedNum1 = Copy_U32NumbersArray[0]; /* First operand */
+    LOC_S32UsedNum2 = Copy_U32NumbersArray[1]; /* Second operand */
+
+    /* Calculate the length of the first operand, considering its sign */
+    if (LOC_S32UsedNum1 < 0)
+    {
+        LOC_S32UsedNum1 = (~LOC_S32UsedNum1) + 1;
+        LOC_U8Length1++;
+    }
+    if (LOC_S32UsedNum2 < 0)
+    {
+        LOC_S32UsedNum2 = (~LOC_S32UsedNum2) + 1;
+        LOC_U8Length2++;
+    }
+
+    /* Handle cases where operands are zero */
+    if (LOC_S32UsedNum1 == 0)
+    {
+        LOC_U8Length1++;
+    }
+    if (LOC_S32UsedNum2 == 0)
+    {
+        LOC_U8Length2++;
+    }
+
+    /* Calculate the length of each operand */
+    while (LOC_S32UsedNum1)
+    {
+        LOC_S32UsedNum1 = LOC_S32UsedNum1 / 10;
+        LOC_U8Length1++;
+    }
+    while (LOC_S32UsedNum2)
+    {
+        LOC_S32UsedNum2 = LOC_S32UsedNum2 / 10;
+        LOC_U8Length2++;
+    }
+
+    /* Determine the start and end indices for the operation in the expression */
+    LOC_U8StartIndex = Copy_U8OrderArray[0] - LOC_U8Length1;
+    LOC_U8EndIndex = Copy_U8OrderArray[0] + LOC_U8Length2;
+
+    /* Perform the mathematical operation based on the operator */
+    switch (Copy_U8ExpressionArray[Copy_U8OrderArray[0]])
+    {
+    case '*': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] * Copy_U32NumbersArray[1]); break;
+    case '+': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] + Copy_U32NumbersArray[1]); break;
+    case '-': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] - Copy_U32NumbersArray[1]); break;
+    case '/': LOC_S32Result = LOC_S32Result + (Copy_U32NumbersArray[0] / Copy_U32NumbersArray[1]); break;
+    default: break;
+    }
+
+    s32 LOC_S32UsedResult = LOC_S32Result; /* Store the result for further processing */
+    s32 LOC_S32Reversed = 1, LOC_S32SentCharacter;
+
+    /* Handle the result if it is zero */
+    if (0 == LOC_S32UsedResult)
+    {
+        Copy_U8ExpressionArray[LOC_U8StartIndex] = 48; /* Replace with '0' */
+
+        /* Adjust the indices to remove extra characters */
+        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
+        {
+            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength + 1; LOC_U8Iterator--)
+            {
+                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
+            }
+            LOC_U8EndIndex++;
+            LOC_U8StartIndex++;
+            LOC_U8ResultLength++;
+        }
+    }
+
+    /* Handle the result if it is positive */
+    else if (LOC_S32UsedResult > 0)
+    {
+        /* Reverse the digits of the result */
+        while (LOC_S32UsedResult > 0)
+        {
+            LOC_S32Reversed = (LOC_S32Reversed * 10) + (LOC_S32UsedResult % 10);
+            LOC_S32UsedResult = LOC_S32UsedResult / 10;
+        }
+
+        /* Store the digits of the result back into the expression array */
+        u8 LOC_U8Iterator2 = 0;
+        while (LOC_S32Reversed > 1)
+        {
+            LOC_S32SentCharacter = LOC_S32Reversed % 10;
+            Copy_U8ExpressionArray[LOC_U8StartIndex + LOC_U8Iterator2] = LOC_S32SentCharacter + 48;
+            LOC_S32Reversed = LOC_S32Reversed / 10;
+            LOC_U8Iterator2++;
+        }
+
+        /* Calculate the length of the result */
+        while (LOC_S32Result)
+        {
+            LOC_S32Result = LOC_S32Result / 10;
+            LOC_U8ResultLength++;
+        }
+
+        /* Adjust the indices to remove extra characters */
+        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
+        {
+            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength; LOC_U8Iterator--)
+            {
+                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
+            }
+            LOC_U8EndIndex++;
+            LOC_U8StartIndex++;
+        }
+    }
+
+    /* Handle the result if it is negative */
+    else
+    {
+        LOC_S32UsedResult = (~LOC_S32UsedResult) + 1; /* Convert to positive */
+        Copy_U8ExpressionArray[LOC_U8StartIndex] = '-'; /* Add the negative sign */
+        LOC_U8ResultLength++;
+
+        /* Reverse the digits of the result */
+        while (LOC_S32UsedResult > 0)
+        {
+            LOC_S32Reversed = (LOC_S32Reversed * 10) + (LOC_S32UsedResult % 10);
+            LOC_S32UsedResult = LOC_S32UsedResult / 10;
+        }
+
+        /* Store the digits of the result back into the expression array */
+        u8 LOC_U8Iterator2 = 0;
+        while (LOC_S32Reversed > 1)
+        {
+            LOC_S32SentCharacter = LOC_S32Reversed % 10;
+            Copy_U8ExpressionArray[LOC_U8StartIndex + 1 + LOC_U8Iterator2] = LOC_S32SentCharacter + 48;
+            LOC_S32Reversed = LOC_S32Reversed / 10;
+            LOC_U8Iterator2++;
+        }
+
+        /* Calculate the length of the result */
+        LOC_S32Result = (~LOC_S32Result) + 1;
+        while (LOC_S32Result)
+        {
+            LOC_S32Result = LOC_S32Result / 10;
+            LOC_U8ResultLength++;
+        }
+
+        /* Adjust the indices to remove extra characters */
+        while (Copy_U8ExpressionArray[LOC_U8EndIndex])
+        {
+            for (u8 LOC_U8Iterator = LOC_U8EndIndex + 1; LOC_U8Iterator > LOC_U8StartIndex + LOC_U8ResultLength; LOC_U8Iterator--)
+            {
+                Copy_U8ExpressionArray[LOC_U8Iterator - 1] = Copy_U8ExpressionArray[LOC_U8Iterator];
+            }
+            LOC_U8EndIndex++;
+            LOC_U8StartIndex++;
+        }
+    }
+
+    MPROFILE_EXIT(MPROFILE_OPERATION);
+    return LOC_U8ResultLength; /* Return the length of the result */
+}
+
+
+
+/************************************************************************************
+ * Function Name: Calculator_U8GetPrecedence
+ * Description: Returns the binding strength of an operator character.
+ * Parameters:
+ *      - Copy_U8Operator: The operator character.
+ * Return:
+ *      - u8: 3 for '^', 2 for '*' and '/', 1 for '+' and '-', 0 for anything else.
+ ************************************************************************************/
+static u8 Calculator_U8GetPrecedence(u8 Copy_U8Operator)
+{
+	u8 LOC_U8Precedence = 0;
+	if (Copy_U8Operator == '^')
+	{
+		LOC_U8Precedence = 3;
+	}
+	else if (Copy_U8Operator == '*' || Copy_U8Operator == '/')
+	{
+		LOC_U8Precedence = 2;
+	}
+	else if (Copy_U8Operator == '+' || Copy_U8Operator == '-')
+	{
+		LOC_U8Precedence = 1;
+	}
+	return LOC_U8Precedence;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8Reduce
+ * Description: Pops the top operator and its two operands, applies the operator
+ *              and pushes the result back on the operand stack.
+ * Parameters:
+ *      - Copy_S32Operands: Pointer to the operand stack.
+ *      - Copy_U8OperandsTop: Pointer to the operand stack depth.
+ *      - Copy_U8Operators: Pointer to the operator stack.
+ *      - Copy_U8OperatorsTop: Pointer to the operator stack depth.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8Reduce(s32 *Copy_S32Operands, u8 *Copy_U8OperandsTop, u8 *Copy_U8Operators, u8 *Copy_U8OperatorsTop)
+{
+	s32 LOC_S32Right = Copy_S32Operands[--(*Copy_U8OperandsTop)];
+	u8 LOC_U8Operator = Copy_U8Operators[--(*Copy_U8OperatorsTop)];
+
+	if (LOC_U8Operator == '^')
+	{
+		return NUM_POW_U8PowerS32(&Copy_S32Operands[*Copy_U8OperandsTop - 1], Copy_S32Operands[*Copy_U8OperandsTop - 1], LOC_S32Right);
+	}
+
+	/* Division by zero, whatever way the zero was written, and any result beyond s32 */
+	return NUM_TOWER_U8CheckedS32(LOC_U8Operator, Copy_S32Operands[*Copy_U8OperandsTop - 1], LOC_S32Right, &Copy_S32Operands[*Copy_U8OperandsTop - 1]);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8Tokenize
+ * Description: Converts the ASCII expression into an array of tokens in one pass.
+ *              Digits are accumulated with Horner's rule into a single number token,
+ *              and a '-' that appears where an operand is expected is folded into the
+ *              sign of that number. Operators and the terminating '=' become tokens
+ *              whose kind is the operator character itself. A number beyond s32 is
+ *              reported instead of wrapping around.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the '!'-prefixed, '='-terminated expression.
+ *      - Copy_TokensArray: Pointer to the array receiving the tokens.
+ *      - Copy_U8TokensNumber: Pointer to where the number of tokens is stored.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error, 3: Overflow).
+ ************************************************************************************/
+u8 Calculator_U8Tokenize(u8 *Copy_U8ExpressionArray, Calculator_TokenType *Copy_TokensArray, u8 *Copy_U8TokensNumber)
+{
+	u8 LOC_U8State = 0, LOC_U8Iterator = 1, LOC_U8TokensNumber = 0;
+	u8 LOC_U8Character, LOC_U8Negative = 0, LOC_U8ExpectOperand = 1;
+	s32 LOC_S32Accumlator;
+
+	while (!LOC_U8State)
+	{
+		LOC_U8Character = Copy_U8ExpressionArray[LOC_U8Iterator];
+
+		if (LOC_U8TokensNumber >= CALCULATOR_MAX_TOKENS)
+		{
+			LOC_U8State = 1;
+		}
+		/* Number: accumulate all its digits at once */
+		else if (LOC_U8Character >= '0' && LOC_U8Character <= '9')
+		{
+			LOC_S32Accumlator = 0;
+			do
+			{
+				/* 2147483647 is the largest magnitude both signs can hold */
+				if (LOC_S32Accumlator > 214748364L || (214748364L == LOC_S32Accumlator && LOC_U8Character > '7'))
+				{
+					LOC_U8State = 3;
+				}
+				else
+				{
+					LOC_S32Accumlator = (LOC_S32Accumlator * 10) + (LOC_U8Character - '0');
+					LOC_U8Character = Copy_U8ExpressionArray[++LOC_U8Iterator];
+				}
+			} while (LOC_U8Character >= '0' && LOC_U8Character <= '9' && !LOC_U8State);
+
+			Copy_TokensArray[LOC_U8TokensNumber].Kind = CALCULATOR_TOKEN_NUMBER;
+			Copy_TokensArray[LOC_U8TokensNumber].Value = LOC_U8Negative ? -LOC_S32Accumlator : LOC_S32Accumlator;
+			LOC_U8TokensNumber++;
+			LOC_U8Negative = 0;
+			LOC_U8ExpectOperand = 0;
+		}
+		/* Sign of the next number */
+		else if (LOC_U8Character == '-' && LOC_U8ExpectOperand && !LOC_U8Negative)
+		{
+			LOC_U8Negative = 1;
+			LOC_U8Iterator++;
+		}
+		/* Operator or end of the expression, a pending sign must be followed by digits */
+		else if ((LOC_U8Character == '+' || LOC_U8Character == '-' || LOC_U8Character == '*' || LOC_U8Character == '/' || LOC_U8Character == '^' || LOC_U8Character == '=') && !LOC_U8Negative)
+		{
+			Copy_TokensArray[LOC_U8TokensNumber].Kind = LOC_U8Character;
+			Copy_TokensArray[LOC_U8TokensNumber].Value = 0;
+			LOC_U8TokensNumber++;
+			LOC_U8ExpectOperand = 1;
+			if (LOC_U8Character == CALCULATOR_TOKEN_END)
+			{
+				break;
+			}
+			LOC_U8Iterator++;
+		}
+		else
+		{
+			LOC_U8State = 1;
+		}
+	}
+
+	*Copy_U8TokensNumber = LOC_U8TokensNumber;
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8ValidateTokens
+ * Description: Checks that the tokens form "number (operator number)* =", which
+ *              rejects leading, trailing and consecutive operators.
+ * Parameters:
+ *      - Copy_TokensArray: Pointer to the tokens produced by Calculator_U8Tokenize.
+ *      - Copy_U8TokensNumber: Number of tokens in the array.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error).
+ ************************************************************************************/
+u8 Calculator_U8ValidateTokens(Calculator_TokenType *Copy_TokensArray, u8 Copy_U8TokensNumber)
+{
+	u8 LOC_U8State = 0, LOC_U8Iterator;
+
+	/* Numbers sit on even positions, operators on odd ones, and '=' comes last */
+	if ((Copy_U8TokensNumber & 1) || Copy_TokensArray[Copy_U8TokensNumber - 1].Kind != CALCULATOR_TOKEN_END)
+	{
+		LOC_U8State = 1;
+	}
+	for (LOC_U8Iterator = 0; LOC_U8Iterator < Copy_U8TokensNumber - 1 && !LOC_U8State; LOC_U8Iterator++)
+	{
+		if ((Copy_TokensArray[LOC_U8Iterator].Kind == CALCULATOR_TOKEN_NUMBER) != (0 == (LOC_U8Iterator & 1)) || Copy_TokensArray[LOC_U8Iterator].Kind == CALCULATOR_TOKEN_END)
+		{
+			LOC_U8State = 1;
+		}
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8Evaluate
+ * Description: Evaluates validated tokens in one pass. An operator only waits on the
+ *              stack until an operator of lower or equal precedence arrives, so '*'
+ *              and '/' (then '+' and '-') are applied left to right. '^' also waits
+ *              for the next '^', so a chain of powers is applied right to left.
+ * Parameters:
+ *      - Copy_TokensArray: Pointer to tokens accepted by Calculator_U8ValidateTokens.
+ *      - Copy_S32Result: Pointer to where the result is stored when no error occurs.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow, also for a chain
+ *            of '^' deeper than CALCULATOR_STACK_SIZE allows).
+ ************************************************************************************/
+u8 Calculator_U8Evaluate(Calculator_TokenType *Copy_TokensArray, s32 *Copy_S32Result)
+{
+	/* Two left-associative precedence levels keep at most two operators pending, plus a chain of '^' */
+	s32 LOC_S32Operands[CALCULATOR_STACK_SIZE];
+	u8 LOC_U8Operators[CALCULATOR_STACK_SIZE];
+	u8 LOC_U8OperandsTop = 0, LOC_U8OperatorsTop = 0, LOC_U8State = 0, LOC_U8Operator;
+
+	while (!LOC_U8State)
+	{
+		LOC_S32Operands[LOC_U8OperandsTop++] = Copy_TokensArray->Value;
+		LOC_U8Operator = Copy_TokensArray[1].Kind;
+		Copy_TokensArray += 2;
+
+		/* Apply every pending operator that binds at least as tightly, or more tightly than '^' */
+		while (!LOC_U8State && LOC_U8OperatorsTop > 0 && Calculator_U8GetPrecedence(LOC_U8Operators[LOC_U8OperatorsTop - 1]) + (LOC_U8Operator != '^') > Calculator_U8GetPrecedence(LOC_U8Operator))
+		{
+			LOC_U8State = Calculator_U8Reduce(LOC_S32Operands, &LOC_U8OperandsTop, LOC_U8Operators, &LOC_U8OperatorsTop);
+		}
+		if (LOC_U8Operator == CALCULATOR_TOKEN_END)
+		{
+			break;
+		}
+		if (LOC_U8OperandsTop >= CALCULATOR_STACK_SIZE)
+		{
+			LOC_U8State = 3;
+		}
+		else
+		{
+			LOC_U8Operators[LOC_U8OperatorsTop++] = LOC_U8Operator;
+		}
+	}
+
+	if (!LOC_U8State)
+	{
+		*Copy_S32Result = LOC_S32Operands[0];
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8WriteResult
+ * Description: Writes a result back into the expression array as "!<result>=" so
+ *              that the user can keep chaining operations on it.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the expression array.
+ *      - Copy_S32Result: The result to write.
+ * Return:
+ *      - u8: Number of characters written for the result (sign included).
+ ************************************************************************************/
+u8 Calculator_U8WriteResult(u8 *Copy_U8ExpressionArray, s32 Copy_S32Result)
+{
+	u8 LOC_U8Length;
+
+	MPROFILE_ENTER(MPROFILE_FORMAT);
+	LOC_U8Length = NUM_FMT_U8S32ToAscii(Copy_S32Result, Copy_U8ExpressionArray + 1);
+	MPROFILE_EXIT(MPROFILE_FORMAT);
+
+	/* Replace the null terminator with the expression end marker */
+	Copy_U8ExpressionArray[LOC_U8Length + 1] = '=';
+
+	return LOC_U8Length;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8ShowResult
+ * Description: Clears the LCD and shows either the error message matching the state
+ *              or the result, which is also written back into the expression array.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the expression array.
+ *      - Copy_U8State: Error state (0: No error, 1: Syntax error, 2: Math error,
+ *                      3: Overflow).
+ *      - Copy_S32Result: The result to show when there is no error.
+ * Return:
+ *      - u8: Counter value to continue typing after the result (0 after an error).
+ ************************************************************************************/
+u8 Calculator_U8ShowResult(u8 *Copy_U8ExpressionArray, u8 Copy_U8State, s32 Copy_S32Result)
+{
+	u8 LOC_U8RetCounterValue = 0, LOC_U8Iterator;
+
+	/* Clear the LCD display */
+	HLCD_VOIDClearDisplay();
+
+	/* Display error message if syntax error */
+	if (1 == Copy_U8State)
+	{
+		HLCD_VOIDSendString("SYNTAX ERROR!");
+	}
+	/* Display error message if mathematical error (e.g., division by zero) */
+	else if (2 == Copy_U8State)
+	{
+		HLCD_VOIDSendString("MATH ERROR!");
+	}
+	/* Display error message if a number or result does not fit s32 */
+	else if (3 == Copy_U8State)
+	{
+		HLCD_VOIDSendString("OVERFLOW!");
+	}
+	/* Write the result back so it can be displayed and chained */
+	else
+	{
+		LOC_U8RetCounterValue = Calculator_U8WriteResult(Copy_U8ExpressionArray, Copy_S32Result);
+		for (LOC_U8Iterator = 1; LOC_U8Iterator <= LOC_U8RetCounterValue; LOC_U8Iterator++)
+		{
+			HLCD_VOIDSendCharacter(Copy_U8ExpressionArray[LOC_U8Iterator]);
+		}
+	}
+
+	return LOC_U8RetCounterValue;
+}
+
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_TOWER
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDNumberSet
+ * Description: Sets a number of the evaluator from a plain value.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ *      - Copy_S32Value: The value.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDNumberSet(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value)
+{
+	NUM_TOWER_VOIDFromS32(Copy_PNumber, Copy_S32Value);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberDigit
+ * Description: Appends a typed digit to the magnitude of the number being typed.
+ * Parameters:
+ *      - Copy_Checkpoint: Pointer to the running state holding the number.
+ *      - Copy_U8Digit: The digit, 0 to 9.
+ * Return:
+ *      - u8: Error state (0: No error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8NumberDigit(Calculator_CheckpointType *Copy_Checkpoint, u8 Copy_U8Digit)
+{
+	return NUM_TOWER_U8AppendDigit(&Copy_Checkpoint->Number, Copy_U8Digit);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDNumberDropDigit
+ * Description: Removes the last typed digit from the magnitude of the number.
+ * Parameters:
+ *      - Copy_Checkpoint: Pointer to the running state holding the number.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDNumberDropDigit(Calculator_CheckpointType *Copy_Checkpoint)
+{
+	NUM_TOWER_VOIDDropDigit(&Copy_Checkpoint->Number);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDNumberNegate
+ * Description: Changes the sign of a number.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDNumberNegate(Calculator_NumberType *Copy_PNumber)
+{
+	NUM_TOWER_VOIDNegate(Copy_PNumber);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberIsNegative
+ * Description: Tells whether a number is below zero.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ * Return:
+ *      - u8: 1 when negative, 0 otherwise.
+ ************************************************************************************/
+static u8 Calculator_U8NumberIsNegative(const Calculator_NumberType *Copy_PNumber)
+{
+	return (NUM_TOWER_S8Sign(Copy_PNumber) < 0);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberDigits
+ * Description: Counts the decimal digits of the magnitude of a number.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ * Return:
+ *      - u8: Number of digits.
+ ************************************************************************************/
+static u8 Calculator_U8NumberDigits(const Calculator_NumberType *Copy_PNumber)
+{
+	return NUM_TOWER_U8CountDigits(Copy_PNumber);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberApply
+ * Description: Applies an operator to two numbers. Its cycles are counted in the
+ *              profiler region of the width of the widest operand, from
+ *              MPROFILE_NUMBER_16 up.
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/'.
+ *      - Copy_PResult: Pointer to where the result is stored when no error occurs,
+ *                      may be one of the operands.
+ *      - Copy_PLeft: Pointer to the left operand.
+ *      - Copy_PRight: Pointer to the right operand.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8NumberApply(u8 Copy_U8Operator, Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PLeft, const Calculator_NumberType *Copy_PRight)
+{
+	u8 LOC_U8State;
+	Calculator_NumberType LOC_Result;
+
+	MPROFILE_ENTER(MPROFILE_NUMBER_16 + ((Copy_PLeft->Width > Copy_PRight->Width) ? Copy_PLeft->Width : Copy_PRight->Width));
+	switch (Copy_U8Operator)
+	{
+	case '+': LOC_U8State = NUM_TOWER_U8Add(&LOC_Result, Copy_PLeft, Copy_PRight); break;
+	case '-': LOC_U8State = NUM_TOWER_U8Sub(&LOC_Result, Copy_PLeft, Copy_PRight); break;
+	case '*': LOC_U8State = NUM_TOWER_U8Mul(&LOC_Result, Copy_PLeft, Copy_PRight); break;
+	default:  LOC_U8State = NUM_TOWER_U8Div(&LOC_Result, Copy_PLeft, Copy_PRight); break;
+	}
+	MPROFILE_EXIT(MPROFILE_NUMBER_16 + ((Copy_PLeft->Width > Copy_PRight->Width) ? Copy_PLeft->Width : Copy_PRight->Width));
+
+	if (0 == LOC_U8State)
+	{
+		*Copy_PResult = LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberInteger
+ * Description: Reads a number as a 32-bit integer, for the exponent and the modulus
+ *              of a power.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ *      - Copy_PS32Integer: Pointer to where the integer is stored when there is no error.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error when the number is not an
+ *            integer, 3: Overflow when it does not fit s32).
+ ************************************************************************************/
+static u8 Calculator_U8NumberInteger(const Calculator_NumberType *Copy_PNumber, s32 *Copy_PS32Integer)
+{
+	return NUM_TOWER_U8ToS32(Copy_PNumber, Copy_PS32Integer);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberToAscii
+ * Description: Writes a number in at most CALCULATOR_RESULT_WIDTH characters, in
+ *              scientific notation when its digits do not fit.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ *      - Copy_U8Buffer: Destination of CALCULATOR_RESULT_WIDTH + 1 bytes.
+ * Return:
+ *      - u8: Number of characters written.
+ ************************************************************************************/
+static u8 Calculator_U8NumberToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	return NUM_TOWER_U8ToAscii(Copy_PNumber, Copy_U8Buffer, CALCULATOR_RESULT_WIDTH);
+}
+
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_FIXED
+
+/* The same operations on NUM_FIXED decimals, see the tower versions above */
+static void Calculator_VOIDNumberSet(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value)
+{
+	NUM_FIXED_U8FromS32(Copy_PNumber, Copy_S32Value);
+}
+
+static u8 Calculator_U8NumberDigit(Calculator_CheckpointType *Copy_Checkpoint, u8 Copy_U8Digit)
+{
+	return NUM_FIXED_U8AppendDigit(&Copy_Checkpoint->Number, &Copy_Checkpoint->Point, Copy_U8Digit);
+}
+
+static void Calculator_VOIDNumberDropDigit(Calculator_CheckpointType *Copy_Checkpoint)
+{
+	NUM_FIXED_VOIDDropDigit(&Copy_Checkpoint->Number, &Copy_Checkpoint->Point);
+}
+
+static void Calculator_VOIDNumberNegate(Calculator_NumberType *Copy_PNumber)
+{
+	*Copy_PNumber = -*Copy_PNumber;
+}
+
+static u8 Calculator_U8NumberIsNegative(const Calculator_NumberType *Copy_PNumber)
+{
+	return (*Copy_PNumber < 0);
+}
+
+/* Keys typed for the number, the point included */
+static u8 Calculator_U8NumberDigits(const Calculator_NumberType *Copy_PNumber)
+{
+	u8 LOC_U8Text[NUM_FIXED_BUFFER_SIZE];
+
+	return NUM_FIXED_U8ToAscii(*Copy_PNumber, LOC_U8Text);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberPoint
+ * Description: Gives the position of the point of a number as if it had been typed.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ * Return:
+ *      - u8: Position of the point, see NUM_FIXED_U8AppendDigit.
+ ************************************************************************************/
+static u8 Calculator_U8NumberPoint(const Calculator_NumberType *Copy_PNumber)
+{
+	return NUM_FIXED_U8Point(*Copy_PNumber);
+}
+
+/* Each operator has its own profiler region, from MPROFILE_OPERATOR_ADD up */
+static u8 Calculator_U8NumberApply(u8 Copy_U8Operator, Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PLeft, const Calculator_NumberType *Copy_PRight)
+{
+	u8 LOC_U8State;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_ADD);
+		LOC_U8State = NUM_FIXED_U8Add(Copy_PResult, *Copy_PLeft, *Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_ADD);
+		break;
+	case '-':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_SUB);
+		LOC_U8State = NUM_FIXED_U8Sub(Copy_PResult, *Copy_PLeft, *Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_SUB);
+		break;
+	case '*':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_MUL);
+		LOC_U8State = NUM_FIXED_U8Mul(Copy_PResult, *Copy_PLeft, *Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_MUL);
+		break;
+	default:
+		MPROFILE_ENTER(MPROFILE_OPERATOR_DIV);
+		LOC_U8State = NUM_FIXED_U8Div(Copy_PResult, *Copy_PLeft, *Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_DIV);
+		break;
+	}
+	return LOC_U8State;
+}
+
+static u8 Calculator_U8NumberInteger(const Calculator_NumberType *Copy_PNumber, s32 *Copy_PS32Integer)
+{
+	u8 LOC_U8State = 2;
+
+	if (0 == *Copy_PNumber % (s32)NUM_FIXED_SCALE)
+	{
+		*Copy_PS32Integer = *Copy_PNumber / (s32)NUM_FIXED_SCALE;
+		LOC_U8State = 0;
+	}
+	return LOC_U8State;
+}
+
+static u8 Calculator_U8NumberToBinary(const Calculator_NumberType *Copy_PNumber, s64 *Copy_PS64Value)
+{
+	*Copy_PS64Value = (s64)*Copy_PNumber * NUM_CORDIC_ONE / (s32)NUM_FIXED_SCALE;
+	return 0;
+}
+
+/* Rounded half away from zero to the nearest decimal */
+static u8 Calculator_U8NumberFromBinary(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value, u8 Copy_U8Bits)
+{
+	u8 LOC_U8State = 0;
+	u32 LOC_U32Magnitude = (Copy_S32Value < 0) ? 0UL - (u32)Copy_S32Value : (u32)Copy_S32Value;
+	u64 LOC_U64Magnitude = ((u64)LOC_U32Magnitude * NUM_FIXED_SCALE + ((1UL << Copy_U8Bits) >> 1)) >> Copy_U8Bits;
+
+	if (LOC_U64Magnitude > (u64)NUM_FIXED_MAX)
+	{
+		LOC_U8State = 3;
+	}
+	else
+	{
+		*Copy_PNumber = (Copy_S32Value < 0) ? -(s32)LOC_U64Magnitude : (s32)LOC_U64Magnitude;
+	}
+	return LOC_U8State;
+}
+
+static u8 Calculator_U8NumberToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	return NUM_FIXED_U8ToAscii(*Copy_PNumber, Copy_U8Buffer);
+}
+
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_FLOAT
+
+/* Largest integer part of a decimal, floats beyond it would not convert back */
+#define CALCULATOR_FLOAT_LIMIT ((float)(NUM_FIXED_MAX / NUM_FIXED_SCALE))
+
+/************************************************************************************
+ * Function Name: Calculator_NumberToFixed
+ * Description: Rounds a float to the nearest NUM_FIXED decimal, through which the
+ *              float build types and shows its numbers.
+ * Parameters:
+ *      - Copy_F32Number: A float within CALCULATOR_FLOAT_LIMIT.
+ * Return:
+ *      - NUM_FIXED_Type: The decimal.
+ ************************************************************************************/
+static NUM_FIXED_Type Calculator_NumberToFixed(float Copy_F32Number)
+{
+	return (NUM_FIXED_Type)(Copy_F32Number * NUM_FIXED_SCALE + ((Copy_F32Number < 0) ? -0.5f : 0.5f));
+}
+
+/* The same operations on float, see the tower versions above */
+static void Calculator_VOIDNumberSet(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value)
+{
+	*Copy_PNumber = (float)Copy_S32Value;
+}
+
+static u8 Calculator_U8NumberDigit(Calculator_CheckpointType *Copy_Checkpoint, u8 Copy_U8Digit)
+{
+	NUM_FIXED_Type LOC_Number = Calculator_NumberToFixed(Copy_Checkpoint->Number);
+	u8 LOC_U8State = NUM_FIXED_U8AppendDigit(&LOC_Number, &Copy_Checkpoint->Point, Copy_U8Digit);
+
+	Copy_Checkpoint->Number = (float)LOC_Number / NUM_FIXED_SCALE;
+	return LOC_U8State;
+}
+
+static void Calculator_VOIDNumberDropDigit(Calculator_CheckpointType *Copy_Checkpoint)
+{
+	NUM_FIXED_Type LOC_Number = Calculator_NumberToFixed(Copy_Checkpoint->Number);
+
+	NUM_FIXED_VOIDDropDigit(&LOC_Number, &Copy_Checkpoint->Point);
+	Copy_Checkpoint->Number = (float)LOC_Number / NUM_FIXED_SCALE;
+}
+
+static void Calculator_VOIDNumberNegate(Calculator_NumberType *Copy_PNumber)
+{
+	*Copy_PNumber = -*Copy_PNumber;
+}
+
+static u8 Calculator_U8NumberIsNegative(const Calculator_NumberType *Copy_PNumber)
+{
+	return (*Copy_PNumber < 0);
+}
+
+static u8 Calculator_U8NumberDigits(const Calculator_NumberType *Copy_PNumber)
+{
+	u8 LOC_U8Text[NUM_FIXED_BUFFER_SIZE];
+
+	return NUM_FIXED_U8ToAscii(Calculator_NumberToFixed(*Copy_PNumber), LOC_U8Text);
+}
+
+static u8 Calculator_U8NumberPoint(const Calculator_NumberType *Copy_PNumber)
+{
+	return NUM_FIXED_U8Point(Calculator_NumberToFixed(*Copy_PNumber));
+}
+
+static u8 Calculator_U8NumberApply(u8 Copy_U8Operator, Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PLeft, const Calculator_NumberType *Copy_PRight)
+{
+	u8 LOC_U8State = 0;
+	Calculator_NumberType LOC_Result = 0;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_ADD);
+		LOC_Result = *Copy_PLeft + *Copy_PRight;
+		MPROFILE_EXIT(MPROFILE_OPERATOR_ADD);
+		break;
+	case '-':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_SUB);
+		LOC_Result = *Copy_PLeft - *Copy_PRight;
+		MPROFILE_EXIT(MPROFILE_OPERATOR_SUB);
+		break;
+	case '*':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_MUL);
+		LOC_Result = *Copy_PLeft * *Copy_PRight;
+		MPROFILE_EXIT(MPROFILE_OPERATOR_MUL);
+		break;
+	default:
+		if (0 == *Copy_PRight)
+		{
+			LOC_U8State = 2;
+		}
+		else
+		{
+			MPROFILE_ENTER(MPROFILE_OPERATOR_DIV);
+			LOC_Result = *Copy_PLeft / *Copy_PRight;
+			MPROFILE_EXIT(MPROFILE_OPERATOR_DIV);
+		}
+		break;
+	}
+
+	/* Keep the range of the fixed-point build, which also rejects infinities */
+	if (0 == LOC_U8State && !(LOC_Result < CALCULATOR_FLOAT_LIMIT && LOC_Result > -CALCULATOR_FLOAT_LIMIT))
+	{
+		LOC_U8State = 3;
+	}
+	if (0 == LOC_U8State)
+	{
+		*Copy_PResult = LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+/* Numbers stay within CALCULATOR_FLOAT_LIMIT, so an integer always fits */
+static u8 Calculator_U8NumberInteger(const Calculator_NumberType *Copy_PNumber, s32 *Copy_PS32Integer)
+{
+	u8 LOC_U8State = 2;
+
+	if ((float)(s32)*Copy_PNumber == *Copy_PNumber)
+	{
+		*Copy_PS32Integer = (s32)*Copy_PNumber;
+		LOC_U8State = 0;
+	}
+	return LOC_U8State;
+}
+
+static u8 Calculator_U8NumberToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	return NUM_FIXED_U8ToAscii(Calculator_NumberToFixed(*Copy_PNumber), Copy_U8Buffer);
+}
+
+/* The functions of the C library instead of NUM_CORDIC, see Calculator_U8NumberFunction below */
+static u8 Calculator_U8NumberFunction(u8 Copy_U8Function, Calculator_NumberType *Copy_PNumber)
+{
+	u8 LOC_U8State = 0;
+	Calculator_NumberType LOC_Result = *Copy_PNumber;
+
+	if (CALCULATOR_FUNCTION_NEGATE == Copy_U8Function)
+	{
+		LOC_Result = -LOC_Result;
+	}
+	else if ((CALCULATOR_FUNCTION_SQRT == Copy_U8Function && LOC_Result < 0) || (CALCULATOR_FUNCTION_LN == Copy_U8Function && LOC_Result <= 0))
+	{
+		LOC_U8State = 2;
+	}
+	else
+	{
+		MPROFILE_ENTER(MPROFILE_SQRT + Copy_U8Function - CALCULATOR_FUNCTION_SQRT);
+		switch (Copy_U8Function)
+		{
+		case CALCULATOR_FUNCTION_SQRT: LOC_Result = sqrtf(LOC_Result); break;
+		case CALCULATOR_FUNCTION_SIN:  LOC_Result = sinf(LOC_Result);  break;
+		case CALCULATOR_FUNCTION_COS:  LOC_Result = cosf(LOC_Result);  break;
+		case CALCULATOR_FUNCTION_ATAN: LOC_Result = atanf(LOC_Result); break;
+		case CALCULATOR_FUNCTION_EXP:  LOC_Result = expf(LOC_Result);  break;
+		default:                       LOC_Result = logf(LOC_Result);  break;
+		}
+		MPROFILE_EXIT(MPROFILE_SQRT + Copy_U8Function - CALCULATOR_FUNCTION_SQRT);
+	}
+
+	/* Keep the range of the fixed-point build, which also rejects infinities */
+	if (0 == LOC_U8State && !(LOC_Result < CALCULATOR_FLOAT_LIMIT && LOC_Result > -CALCULATOR_FLOAT_LIMIT))
+	{
+		LOC_U8State = 3;
+	}
+	if (0 == LOC_U8State)
+	{
+		*Copy_PNumber = LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+#elif CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+
+/* The same operations on NUM_RATIONAL fractions, see the tower versions above. Numbers
+ * are typed as integers, a fraction only comes from a division. */
+static void Calculator_VOIDNumberSet(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value)
+{
+	NUM_RATIONAL_VOIDFromS32(Copy_PNumber, Copy_S32Value);
+}
+
+static u8 Calculator_U8NumberDigit(Calculator_CheckpointType *Copy_Checkpoint, u8 Copy_U8Digit)
+{
+	return NUM_RATIONAL_U8AppendDigit(&Copy_Checkpoint->Number, Copy_U8Digit);
+}
+
+static void Calculator_VOIDNumberDropDigit(Calculator_CheckpointType *Copy_Checkpoint)
+{
+	NUM_RATIONAL_VOIDDropDigit(&Copy_Checkpoint->Number);
+}
+
+static void Calculator_VOIDNumberNegate(Calculator_NumberType *Copy_PNumber)
+{
+	NUM_RATIONAL_VOIDNegate(Copy_PNumber);
+}
+
+/* Each operator has its own profiler region, from MPROFILE_OPERATOR_ADD up */
+static u8 Calculator_U8NumberApply(u8 Copy_U8Operator, Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PLeft, const Calculator_NumberType *Copy_PRight)
+{
+	u8 LOC_U8State;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_ADD);
+		LOC_U8State = NUM_RATIONAL_U8Add(Copy_PResult, Copy_PLeft, Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_ADD);
+		break;
+	case '-':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_SUB);
+		LOC_U8State = NUM_RATIONAL_U8Sub(Copy_PResult, Copy_PLeft, Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_SUB);
+		break;
+	case '*':
+		MPROFILE_ENTER(MPROFILE_OPERATOR_MUL);
+		LOC_U8State = NUM_RATIONAL_U8Mul(Copy_PResult, Copy_PLeft, Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_MUL);
+		break;
+	default:
+		MPROFILE_ENTER(MPROFILE_OPERATOR_DIV);
+		LOC_U8State = NUM_RATIONAL_U8Div(Copy_PResult, Copy_PLeft, Copy_PRight);
+		MPROFILE_EXIT(MPROFILE_OPERATOR_DIV);
+		break;
+	}
+	return LOC_U8State;
+}
+
+/* A fraction is an integer when its lowest terms have 1 as denominator */
+static u8 Calculator_U8NumberInteger(const Calculator_NumberType *Copy_PNumber, s32 *Copy_PS32Integer)
+{
+	u8 LOC_U8State = 2;
+	NUM_RATIONAL_Type LOC_Number = *Copy_PNumber;
+
+	NUM_RATIONAL_VOIDNormalize(&LOC_Number);
+	if (1 == LOC_Number.Denominator)
+	{
+		*Copy_PS32Integer = LOC_Number.Numerator;
+		LOC_U8State = 0;
+	}
+	return LOC_U8State;
+}
+
+static u8 Calculator_U8NumberToBinary(const Calculator_NumberType *Copy_PNumber, s64 *Copy_PS64Value)
+{
+	*Copy_PS64Value = (s64)Copy_PNumber->Numerator * NUM_CORDIC_ONE / Copy_PNumber->Denominator;
+	return 0;
+}
+
+/* Exact, the denominator is a power of two */
+static u8 Calculator_U8NumberFromBinary(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value, u8 Copy_U8Bits)
+{
+	Copy_PNumber->Numerator = Copy_S32Value;
+	Copy_PNumber->Denominator = 1L << Copy_U8Bits;
+	NUM_RATIONAL_VOIDNormalize(Copy_PNumber);
+	return 0;
+}
+
+/* "n/d" in lowest terms, or the decimal expansion when that does not fit */
+static u8 Calculator_U8NumberToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	return NUM_RATIONAL_U8ToAscii(Copy_PNumber, Copy_U8Buffer, CALCULATOR_RESULT_WIDTH, NUM_RATIONAL_FRACTION);
+}
+
+/* Fraction digits of a result that went through a function, NUM_CORDIC is within 2^-16 */
+#define CALCULATOR_APPROXIMATE_DIGITS 5
+
+/************************************************************************************
+ * Function Name: Calculator_U8ApproximateToAscii
+ * Description: Writes a result that went through a function as its decimal expansion
+ *              rounded to CALCULATOR_APPROXIMATE_DIGITS fraction digits, instead of the
+ *              fraction over a power of two NUM_CORDIC gives. The integer part always
+ *              fits CALCULATOR_RESULT_WIDTH, so the width only limits the fraction.
+ * Parameters:
+ *      - Copy_PNumber: Pointer to the number.
+ *      - Copy_U8Buffer: Destination of CALCULATOR_RESULT_WIDTH + 1 bytes.
+ * Return:
+ *      - u8: Number of characters written.
+ ************************************************************************************/
+static u8 Calculator_U8ApproximateToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	u32 LOC_U32Magnitude = (Copy_PNumber->Numerator < 0) ? 0UL - (u32)Copy_PNumber->Numerator : (u32)Copy_PNumber->Numerator;
+	u8 LOC_U8Width = (Copy_PNumber->Numerator < 0) + NUM_FMT_U8CountDigits(LOC_U32Magnitude / (u32)Copy_PNumber->Denominator)
+	               + 1 + CALCULATOR_APPROXIMATE_DIGITS;
+
+	if (LOC_U8Width > CALCULATOR_RESULT_WIDTH)
+	{
+		LOC_U8Width = CALCULATOR_RESULT_WIDTH;
+	}
+	return NUM_RATIONAL_U8ToAscii(Copy_PNumber, Copy_U8Buffer, LOC_U8Width, NUM_RATIONAL_DECIMAL);
+}
+
+#else
+
+/* The same operations on plain s32, see the tower versions above */
+static void Calculator_VOIDNumberSet(Calculator_NumberType *Copy_PNumber, s32 Copy_S32Value)
+{
+	*Copy_PNumber = Copy_S32Value;
+}
+
+static u8 Calculator_U8NumberDigit(Calculator_CheckpointType *Copy_Checkpoint, u8 Copy_U8Digit)
+{
+	/* A magnitude beyond s32 is an overflow, as in the single-pass engine */
+	u8 LOC_U8State = NUM_TOWER_U8CheckedS32('*', Copy_Checkpoint->Number, 10, &Copy_Checkpoint->Number);
+
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		LOC_U8State = NUM_TOWER_U8CheckedS32('+', Copy_Checkpoint->Number, Copy_U8Digit, &Copy_Checkpoint->Number);
+	}
+	return LOC_U8State;
+}
+
+static void Calculator_VOIDNumberDropDigit(Calculator_CheckpointType *Copy_Checkpoint)
+{
+	Copy_Checkpoint->Number = (s32)((u32)Copy_Checkpoint->Number / 10);
+}
+
+static void Calculator_VOIDNumberNegate(Calculator_NumberType *Copy_PNumber)
+{
+	*Copy_PNumber = (s32)(0UL - (u32)*Copy_PNumber);
+}
+
+static u8 Calculator_U8NumberIsNegative(const Calculator_NumberType *Copy_PNumber)
+{
+	return (*Copy_PNumber < 0);
+}
+
+static u8 Calculator_U8NumberDigits(const Calculator_NumberType *Copy_PNumber)
+{
+	return NUM_FMT_U8CountDigits((*Copy_PNumber < 0) ? 0UL - (u32)*Copy_PNumber : (u32)*Copy_PNumber);
+}
+
+/* Division by zero gives 2 and any result beyond s32 gives 3, as in the single-pass engine */
+static u8 Calculator_U8NumberApply(u8 Copy_U8Operator, Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PLeft, const Calculator_NumberType *Copy_PRight)
+{
+	return NUM_TOWER_U8CheckedS32(Copy_U8Operator, *Copy_PLeft, *Copy_PRight, Copy_PResult);
+}
+
+static u8 Calculator_U8NumberInteger(const Calculator_NumberType *Copy_PNumber, s32 *Copy_PS32Integer)
+{
+	*Copy_PS32Integer = *Copy_PNumber;
+	return 0;
+}
+
+static u8 Calculator_U8NumberToAscii(const Calculator_NumberType *Copy_PNumber, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Length;
+
+	MPROFILE_ENTER(MPROFILE_FORMAT);
+	LOC_U8Length = NUM_FMT_U8S32ToAscii(*Copy_PNumber, Copy_U8Buffer);
+	MPROFILE_EXIT(MPROFILE_FORMAT);
+	return LOC_U8Length;
+}
+
+/* Powers by NUM_POW_U8PowerS32, whose error codes are the same states */
+static u8 Calculator_U8NumberPower(Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PBase, const Calculator_NumberType *Copy_PExponent)
+{
+	u8 LOC_U8State;
+
+	MPROFILE_ENTER(MPROFILE_POWER);
+	LOC_U8State = NUM_POW_U8PowerS32(Copy_PResult, *Copy_PBase, *Copy_PExponent);
+	MPROFILE_EXIT(MPROFILE_POWER);
+	return LOC_U8State;
+}
+
+#endif
+
+#if CALCULATOR_NUMBER != CALCULATOR_NUMBER_S32
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberPower
+ * Description: Raises a number to an integer power by squaring as NUM_POW does, but
+ *              with every product made by Calculator_U8NumberApply so each number
+ *              type keeps its own rounding and overflow checks. A negative exponent
+ *              raises the reciprocal of the base, so integers truncate as 1/x does.
+ *              0^0 is 1. The s32 type uses NUM_POW_U8PowerS32 itself.
+ * Parameters:
+ *      - Copy_PResult: Pointer to where the power is stored when no error occurs,
+ *                      may be one of the operands.
+ *      - Copy_PBase: Pointer to the base.
+ *      - Copy_PExponent: Pointer to the exponent.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, also for an exponent that is not
+ *            an integer, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8NumberPower(Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PBase, const Calculator_NumberType *Copy_PExponent)
+{
+	Calculator_NumberType LOC_Power, LOC_Square = *Copy_PBase;
+	s32 LOC_S32Exponent = 0;
+	u32 LOC_U32Exponent;
+	u8 LOC_U8State = Calculator_U8NumberInteger(Copy_PExponent, &LOC_S32Exponent);
+
+	MPROFILE_ENTER(MPROFILE_POWER);
+	Calculator_VOIDNumberSet(&LOC_Power, 1);
+	LOC_U32Exponent = (LOC_S32Exponent < 0) ? 0UL - (u32)LOC_S32Exponent : (u32)LOC_S32Exponent;
+	if (0 == LOC_U8State && LOC_S32Exponent < 0)
+	{
+		LOC_U8State = Calculator_U8NumberApply('/', &LOC_Square, &LOC_Power, &LOC_Square);
+	}
+	while (0 == LOC_U8State && LOC_U32Exponent)
+	{
+		if (LOC_U32Exponent & 1)
+		{
+			LOC_U8State = Calculator_U8NumberApply('*', &LOC_Power, &LOC_Power, &LOC_Square);
+		}
+		LOC_U32Exponent >>= 1;
+
+		/* Only square while bits remain, as NUM_POW_U8PowerS32 */
+		if (0 == LOC_U8State && LOC_U32Exponent)
+		{
+			LOC_U8State = Calculator_U8NumberApply('*', &LOC_Square, &LOC_Square, &LOC_Square);
+		}
+	}
+	MPROFILE_EXIT(MPROFILE_POWER);
+
+	if (0 == LOC_U8State)
+	{
+		*Copy_PResult = LOC_Power;
+	}
+	return LOC_U8State;
+}
+
+#endif
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberModPower
+ * Description: Raises an integer to an integer power modulo a third one with
+ *              NUM_POW_U32ModPower, which reduces every product so the exponent can
+ *              be as large as s32 allows. A negative base is brought between 0 and
+ *              the modulus first by NUM_POW_U32Reduce, so the result always is.
+ * Parameters:
+ *      - Copy_PResult: Pointer to where the result is stored when no error occurs,
+ *                      may be one of the operands.
+ *      - Copy_PBase: Pointer to the base.
+ *      - Copy_PExponent: Pointer to the exponent, not negative.
+ *      - Copy_PModulus: Pointer to the modulus, above zero.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, also for an operand that is not
+ *            an integer, 3: Overflow when an operand does not fit s32).
+ ************************************************************************************/
+static u8 Calculator_U8NumberModPower(Calculator_NumberType *Copy_PResult, const Calculator_NumberType *Copy_PBase, const Calculator_NumberType *Copy_PExponent, const Calculator_NumberType *Copy_PModulus)
+{
+	s32 LOC_S32Base = 0, LOC_S32Exponent = 0, LOC_S32Modulus = 0;
+	u32 LOC_U32Base;
+	u8 LOC_U8State = Calculator_U8NumberInteger(Copy_PBase, &LOC_S32Base);
+
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8NumberInteger(Copy_PExponent, &LOC_S32Exponent);
+	}
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8NumberInteger(Copy_PModulus, &LOC_S32Modulus);
+	}
+	if (0 == LOC_U8State && (LOC_S32Modulus <= 0 || LOC_S32Exponent < 0))
+	{
+		LOC_U8State = 2;
+	}
+	if (0 == LOC_U8State)
+	{
+		MPROFILE_ENTER(MPROFILE_MOD_POWER);
+		LOC_U32Base = NUM_POW_U32Reduce((LOC_S32Base < 0) ? 0UL - (u32)LOC_S32Base : (u32)LOC_S32Base, (u32)LOC_S32Modulus);
+		if (LOC_S32Base < 0 && 0 != LOC_U32Base)
+		{
+			LOC_U32Base = (u32)LOC_S32Modulus - LOC_U32Base;
+		}
+		Calculator_VOIDNumberSet(Copy_PResult, (s32)NUM_POW_U32ModPower(LOC_U32Base, (u32)LOC_S32Exponent, (u32)LOC_S32Modulus));
+		MPROFILE_EXIT(MPROFILE_MOD_POWER);
+	}
+	return LOC_U8State;
+}
+
+#if CALCULATOR_FUNCTIONS == 1 && CALCULATOR_NUMBER != CALCULATOR_NUMBER_FLOAT
+
+/************************************************************************************
+ * Function Name: Calculator_U8NumberFunction
+ * Description: Applies a function key to a number through NUM_CORDIC, on the number
+ *              converted to binary fixed point with NUM_CORDIC_FRACTION_BITS fraction
+ *              bits, or fewer for an argument beyond 32767. Its cycles are counted in
+ *              the profiler region of the function, from MPROFILE_SQRT up.
+ * Parameters:
+ *      - Copy_U8Function: A CALCULATOR_FUNCTION code.
+ *      - Copy_PNumber: Pointer to the argument, receives the result when no error
+ *                      occurs.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error for the square root of a negative
+ *            number or the logarithm of one not above zero, 3: Overflow, also for the
+ *            sine, cosine or positive exponential of an argument beyond 32767).
+ ************************************************************************************/
+static u8 Calculator_U8NumberFunction(u8 Copy_U8Function, Calculator_NumberType *Copy_PNumber)
+{
+	s64 LOC_S64Value = 0;
+	s32 LOC_S32Value, LOC_S32Sine, LOC_S32Cosine;
+	u32 LOC_U32Root;
+	u8 LOC_U8Bits = NUM_CORDIC_FRACTION_BITS, LOC_U8State = 0;
+
+	if (CALCULATOR_FUNCTION_NEGATE == Copy_U8Function)
+	{
+		Calculator_VOIDNumberNegate(Copy_PNumber);
+	}
+	else
+	{
+		MPROFILE_ENTER(MPROFILE_SQRT + Copy_U8Function - CALCULATOR_FUNCTION_SQRT);
+		LOC_U8State = Calculator_U8NumberToBinary(Copy_PNumber, &LOC_S64Value);
+
+		/* Fraction bits are given up until the value fits, any s32 fits with none */
+		while (LOC_S64Value > 0x7FFFFFFFLL || LOC_S64Value < -0x7FFFFFFFLL)
+		{
+			LOC_S64Value >>= 1;
+			LOC_U8Bits--;
+		}
+		LOC_S32Value = (s32)LOC_S64Value;
+
+		if (0 != LOC_U8State)
+		{
+			/* The argument does not fit s32 */
+		}
+		else if (CALCULATOR_FUNCTION_SQRT == Copy_U8Function)
+		{
+			if (LOC_S32Value < 0)
+			{
+				LOC_U8State = 2;
+			}
+			else
+			{
+				/* The radicand with 32 fraction bits has a root with 16 */
+				LOC_U32Root = NUM_CORDIC_U32Sqrt((u64)LOC_S32Value << (32 - LOC_U8Bits));
+				LOC_U8Bits = NUM_CORDIC_FRACTION_BITS;
+				if (LOC_U32Root > 0x7FFFFFFFUL)
+				{
+					LOC_U32Root = (LOC_U32Root + 1) >> 1;
+					LOC_U8Bits--;
+				}
+				LOC_S32Value = (s32)LOC_U32Root;
+			}
+		}
+		else if (CALCULATOR_FUNCTION_SIN == Copy_U8Function || CALCULATOR_FUNCTION_COS == Copy_U8Function)
+		{
+			/* An angle that lost fraction bits would lose the whole result with them */
+			if (LOC_U8Bits < NUM_CORDIC_FRACTION_BITS)
+			{
+				LOC_U8State = 3;
+			}
+			else
+			{
+				NUM_CORDIC_VOIDSinCos(LOC_S32Value, &LOC_S32Sine, &LOC_S32Cosine);
+				LOC_S32Value = (CALCULATOR_FUNCTION_SIN == Copy_U8Function) ? LOC_S32Sine : LOC_S32Cosine;
+			}
+		}
+		else if (CALCULATOR_FUNCTION_ATAN == Copy_U8Function)
+		{
+			LOC_S32Value = NUM_CORDIC_S32Atan(LOC_S32Value, LOC_U8Bits);
+			LOC_U8Bits = NUM_CORDIC_FRACTION_BITS;
+		}
+		else if (CALCULATOR_FUNCTION_EXP == Copy_U8Function)
+		{
+			/* Beyond 32767 only a negative exponent has a power that fits, which is 0 */
+			if (LOC_U8Bits < NUM_CORDIC_FRACTION_BITS)
+			{
+				LOC_U8State = (LOC_S32Value > 0) ? 3 : 0;
+				LOC_S32Value = 0;
+			}
+			else
+			{
+				LOC_U8State = NUM_CORDIC_U8Exp(&LOC_S32Value, &LOC_U8Bits, LOC_S32Value);
+			}
+		}
+		else
+		{
+			LOC_U8State = NUM_CORDIC_U8Log(&LOC_S32Value, LOC_S32Value, LOC_U8Bits);
+			LOC_U8Bits = NUM_CORDIC_FRACTION_BITS;
+		}
+
+		if (0 == LOC_U8State)
+		{
+			LOC_U8State = Calculator_U8NumberFromBinary(Copy_PNumber, LOC_S32Value, LOC_U8Bits);
+		}
+		MPROFILE_EXIT(MPROFILE_SQRT + Copy_U8Function - CALCULATOR_FUNCTION_SQRT);
+	}
+	return LOC_U8State;
+}
+
+#endif
+
+#if CALCULATOR_FUNCTIONS == 1
+
+/************************************************************************************
+ * Function Name: Calculator_U8FunctionCode
+ * Description: Tells which function a key of the shift layer stands for.
+ * Parameters:
+ *      - Copy_U8Key: The key.
+ * Return:
+ *      - u8: Its CALCULATOR_FUNCTION code, 0 when it is not a function key.
+ ************************************************************************************/
+static u8 Calculator_U8FunctionCode(u8 Copy_U8Key)
+{
+	u8 LOC_U8Function;
+
+	switch (Copy_U8Key)
+	{
+	case 'r': LOC_U8Function = CALCULATOR_FUNCTION_SQRT; break;
+	case 's': LOC_U8Function = CALCULATOR_FUNCTION_SIN;  break;
+	case 'c': LOC_U8Function = CALCULATOR_FUNCTION_COS;  break;
+	case 'a': LOC_U8Function = CALCULATOR_FUNCTION_ATAN; break;
+	case 'e': LOC_U8Function = CALCULATOR_FUNCTION_EXP;  break;
+	case 'l': LOC_U8Function = CALCULATOR_FUNCTION_LN;   break;
+	default:  LOC_U8Function = 0;                        break;
+	}
+	return LOC_U8Function;
+}
+
+#endif
+
+/************************************************************************************
+ * Function Name: Calculator_U8SignedNumber
+ * Description: Gives the number of a checkpoint with the sign typed before it, then
+ *              the functions typed before that from the last one typed, so s-2 is
+ *              sin(-2) and -s2 is -sin(2).
+ * Parameters:
+ *      - Copy_Checkpoint: Pointer to the checkpoint.
+ *      - Copy_PNumber: Pointer to where the number is stored.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8SignedNumber(const Calculator_CheckpointType *Copy_Checkpoint, Calculator_NumberType *Copy_PNumber)
+{
+	u8 LOC_U8State = 0;
+#if CALCULATOR_FUNCTIONS == 1
+	u16 LOC_U16Functions = Copy_Checkpoint->Functions;
+#endif
+
+	*Copy_PNumber = Copy_Checkpoint->Number;
+	if (Copy_Checkpoint->Negative)
+	{
+		Calculator_VOIDNumberNegate(Copy_PNumber);
+	}
+#if CALCULATOR_FUNCTIONS == 1
+	while (0 == LOC_U8State && LOC_U16Functions)
+	{
+		LOC_U8State = Calculator_U8NumberFunction(LOC_U16Functions & ((1U << CALCULATOR_FUNCTION_BITS) - 1), Copy_PNumber);
+		LOC_U16Functions >>= CALCULATOR_FUNCTION_BITS;
+	}
+#endif
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalReset
+ * Description: Puts the incremental evaluator back to an empty expression.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalReset(Calculator_IncrementalType *Copy_Evaluator)
+{
+	Calculator_VOIDNumberSet(&Copy_Evaluator->Current.Sum, 0);
+	Calculator_VOIDNumberSet(&Copy_Evaluator->Current.Term, 0);
+	Calculator_VOIDNumberSet(&Copy_Evaluator->Current.Number, 0);
+	Copy_Evaluator->Current.AddOperator = '+';
+	Copy_Evaluator->Current.MulOperator = 0;
+	Copy_Evaluator->Current.Negative = 0;
+	Copy_Evaluator->Current.Digits = 0;
+	Copy_Evaluator->Current.Powers = 0;
+	Copy_Evaluator->Current.Modular = 0;
+#if CALCULATOR_FUNCTIONS == 1
+	Copy_Evaluator->Current.Functions = 0;
+#endif
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+	Copy_Evaluator->Current.Approximate = 0;
+#endif
+#if CALCULATOR_DECIMAL_POINT == 1
+	Copy_Evaluator->Current.Point = 0;
+#endif
+	Copy_Evaluator->CheckpointsHead = 0;
+	Copy_Evaluator->CheckpointsNumber = 0;
+	Copy_Evaluator->State = 0;
+	Copy_Evaluator->ErrorKeys = 0;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalLoad
+ * Description: Starts a new expression whose first operand is a previous result, as
+ *              if its digits had just been typed.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PValue: The value to start from.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalLoad(Calculator_IncrementalType *Copy_Evaluator, const Calculator_NumberType *Copy_PValue)
+{
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+	u8 LOC_U8Text[CALCULATOR_RESULT_WIDTH + 1], LOC_U8Iterator;
+
+	/* Typed back key by key, so 'C' deletes a fraction like a typed division */
+	Calculator_VOIDIncrementalReset(Copy_Evaluator);
+	Calculator_U8NumberToAscii(Copy_PValue, LOC_U8Text);
+	for (LOC_U8Iterator = 0; LOC_U8Text[LOC_U8Iterator]; LOC_U8Iterator++)
+	{
+		Calculator_VOIDIncrementalFeed(Copy_Evaluator, LOC_U8Text[LOC_U8Iterator]);
+	}
+#else
+	Calculator_VOIDIncrementalReset(Copy_Evaluator);
+	Copy_Evaluator->Current.Number = *Copy_PValue;
+	if (Calculator_U8NumberIsNegative(Copy_PValue))
+	{
+		Copy_Evaluator->Current.Negative = 1;
+		Calculator_VOIDNumberNegate(&Copy_Evaluator->Current.Number);
+	}
+	Copy_Evaluator->Current.Digits = Calculator_U8NumberDigits(&Copy_Evaluator->Current.Number);
+#if CALCULATOR_DECIMAL_POINT == 1
+	Copy_Evaluator->Current.Point = Calculator_U8NumberPoint(&Copy_Evaluator->Current.Number);
+#endif
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8Operand
+ * Description: Gives the value of the number being typed raised by the powers pending
+ *              on it. Their bases wait in the numbers of the last checkpoints and are
+ *              applied right to left. After '%' the number being typed is the modulus
+ *              of the leftmost power instead. Every number gets its sign and functions
+ *              before any power, so s2^3 is sin(2)^3.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PValue: Pointer to where the value is stored.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8Operand(Calculator_IncrementalType *Copy_Evaluator, Calculator_NumberType *Copy_PValue)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+	u8 LOC_U8State, LOC_U8Powers = LOC_Current->Powers, LOC_U8Index = Copy_Evaluator->CheckpointsHead;
+	Calculator_NumberType LOC_Base, LOC_Modulus;
+
+	Calculator_VOIDNumberSet(&LOC_Modulus, 0);
+	LOC_U8State = Calculator_U8SignedNumber(LOC_Current, Copy_PValue);
+	if (0 == LOC_U8State && LOC_Current->Modular)
+	{
+		LOC_Modulus = *Copy_PValue;
+		LOC_U8Index = (0 == LOC_U8Index) ? CALCULATOR_CHECKPOINTS - 1 : LOC_U8Index - 1;
+		LOC_U8State = Calculator_U8SignedNumber(&Copy_Evaluator->Checkpoints[LOC_U8Index], Copy_PValue);
+	}
+	while (0 == LOC_U8State && LOC_U8Powers)
+	{
+		LOC_U8Index = (0 == LOC_U8Index) ? CALCULATOR_CHECKPOINTS - 1 : LOC_U8Index - 1;
+		LOC_U8State = Calculator_U8SignedNumber(&Copy_Evaluator->Checkpoints[LOC_U8Index], &LOC_Base);
+		LOC_U8Powers--;
+		if (0 != LOC_U8State)
+		{
+			/* The function of a base failed */
+		}
+		else if (0 == LOC_U8Powers && LOC_Current->Modular)
+		{
+			LOC_U8State = Calculator_U8NumberModPower(Copy_PValue, &LOC_Base, Copy_PValue, &LOC_Modulus);
+		}
+		else
+		{
+			LOC_U8State = Calculator_U8NumberPower(Copy_PValue, &LOC_Base, Copy_PValue);
+		}
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8CombineTerm
+ * Description: Applies the pending '*' or '/' of the running state to the operand
+ *              being typed.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PTerm: Pointer to where the resulting product term is stored.
+ * Return:
+ *      - u8: Error state (0: No error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+static u8 Calculator_U8CombineTerm(Calculator_IncrementalType *Copy_Evaluator, Calculator_NumberType *Copy_PTerm)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+	u8 LOC_U8State = Calculator_U8Operand(Copy_Evaluator, Copy_PTerm);
+
+	if (0 == LOC_U8State && LOC_Current->MulOperator)
+	{
+		LOC_U8State = Calculator_U8NumberApply(LOC_Current->MulOperator, Copy_PTerm, &LOC_Current->Term, Copy_PTerm);
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDPushCheckpoint
+ * Description: Saves the running state in the ring before an operator, overwriting
+ *              the oldest checkpoint when full, and starts the next number.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDPushCheckpoint(Calculator_IncrementalType *Copy_Evaluator)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+
+	Copy_Evaluator->Checkpoints[Copy_Evaluator->CheckpointsHead] = *LOC_Current;
+	Copy_Evaluator->CheckpointsHead = (Copy_Evaluator->CheckpointsHead == CALCULATOR_CHECKPOINTS - 1) ? 0 : Copy_Evaluator->CheckpointsHead + 1;
+	if (Copy_Evaluator->CheckpointsNumber < CALCULATOR_CHECKPOINTS)
+	{
+		Copy_Evaluator->CheckpointsNumber++;
+	}
+	Calculator_VOIDNumberSet(&LOC_Current->Number, 0);
+	LOC_Current->Negative = 0;
+	LOC_Current->Digits = 0;
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+	LOC_Current->Approximate |= (0 != LOC_Current->Functions);
+#endif
+#if CALCULATOR_FUNCTIONS == 1
+	LOC_Current->Functions = 0;
+#endif
+#if CALCULATOR_DECIMAL_POINT == 1
+	LOC_Current->Point = 0;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalFeed
+ * Description: Applies one key to the running state. Digits extend the current number,
+ *              '*' and '/' fold it into the pending product term, and '+' and '-' fold
+ *              that term into the accumulated sum. '^' leaves the number in its
+ *              checkpoint as a base, and '%' after a power starts its modulus, so the
+ *              powers are only computed with the rest of the operand. A sign belongs
+ *              to the number it precedes, so -2^2 is 4. Function keys typed before a
+ *              number stack up to five deep with the signs between them, and are only
+ *              applied with the rest of the operand too. The state before every operator is
+ *              saved in a ring of the last CALCULATOR_CHECKPOINTS operators so that
+ *              Calculator_VOIDIncrementalUndo can roll it back. A key that
+ *              makes the expression invalid leaves the state untouched and is only
+ *              counted, so that deleting it clears the error again.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_U8Key: The key to apply ('0'-'9', '+', '-', '*', '/', '^' or '%', a
+ *                    function key 'r', 's', 'c', 'a', 'e' or 'l', and '.' when
+ *                    CALCULATOR_DECIMAL_POINT is 1).
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalFeed(Calculator_IncrementalType *Copy_Evaluator, u8 Copy_U8Key)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+	Calculator_NumberType LOC_Term, LOC_Sum;
+
+	if (Copy_Evaluator->State)
+	{
+		/* Keys typed after an error only need to be deleted again */
+	}
+	else if (Copy_U8Key >= '0' && Copy_U8Key <= '9')
+	{
+		Copy_Evaluator->State = Calculator_U8NumberDigit(LOC_Current, Copy_U8Key - '0');
+		if (0 == Copy_Evaluator->State)
+		{
+			LOC_Current->Digits++;
+		}
+	}
+#if CALCULATOR_DECIMAL_POINT == 1
+	else if (Copy_U8Key == '.' && 0 == LOC_Current->Point)
+	{
+		/* The point counts as a digit, so it is deleted like one */
+		LOC_Current->Point = 1;
+		LOC_Current->Digits++;
+	}
+#endif
+	else if (Copy_U8Key == '-' && 0 == LOC_Current->Digits && !LOC_Current->Negative)
+	{
+		LOC_Current->Negative = 1;
+	}
+#if CALCULATOR_FUNCTIONS == 1
+	/* The sign before a function is kept with it, so both need room */
+	else if (Calculator_U8FunctionCode(Copy_U8Key) && 0 == LOC_Current->Digits
+	         && LOC_Current->Functions < ((1U << (4 * CALCULATOR_FUNCTION_BITS)) >> (CALCULATOR_FUNCTION_BITS * LOC_Current->Negative)))
+	{
+		if (LOC_Current->Negative)
+		{
+			LOC_Current->Functions = (LOC_Current->Functions << CALCULATOR_FUNCTION_BITS) | CALCULATOR_FUNCTION_NEGATE;
+			LOC_Current->Negative = 0;
+		}
+		LOC_Current->Functions = (LOC_Current->Functions << CALCULATOR_FUNCTION_BITS) | Calculator_U8FunctionCode(Copy_U8Key);
+	}
+#endif
+	/* Every pending base and the exponent must still be in the ring when '%' is added */
+	else if (Copy_U8Key == '^' && LOC_Current->Digits && !LOC_Current->Modular && LOC_Current->Powers + 1 < CALCULATOR_CHECKPOINTS)
+	{
+		Calculator_VOIDPushCheckpoint(Copy_Evaluator);
+		LOC_Current->Powers++;
+	}
+	else if (Copy_U8Key == '%' && LOC_Current->Digits && LOC_Current->Powers && !LOC_Current->Modular)
+	{
+		Calculator_VOIDPushCheckpoint(Copy_Evaluator);
+		LOC_Current->Modular = 1;
+	}
+	else if (Calculator_U8GetPrecedence(Copy_U8Key) && Copy_U8Key != '^' && LOC_Current->Digits)
+	{
+		Copy_Evaluator->State = Calculator_U8CombineTerm(Copy_Evaluator, &LOC_Term);
+		if (0 == Copy_Evaluator->State && (Copy_U8Key == '+' || Copy_U8Key == '-'))
+		{
+			Copy_Evaluator->State = Calculator_U8NumberApply(LOC_Current->AddOperator, &LOC_Sum, &LOC_Current->Sum, &LOC_Term);
+		}
+		if (0 == Copy_Evaluator->State)
+		{
+			Calculator_VOIDPushCheckpoint(Copy_Evaluator);
+			LOC_Current->Powers = 0;
+			LOC_Current->Modular = 0;
+			if (Copy_U8Key == '*' || Copy_U8Key == '/')
+			{
+				LOC_Current->Term = LOC_Term;
+				LOC_Current->MulOperator = Copy_U8Key;
+			}
+			else
+			{
+				LOC_Current->Sum = LOC_Sum;
+				LOC_Current->AddOperator = Copy_U8Key;
+				LOC_Current->MulOperator = 0;
+			}
+		}
+	}
+	else
+	{
+		Copy_Evaluator->State = 1;
+	}
+
+	if (Copy_Evaluator->State && Copy_Evaluator->ErrorKeys < 255)
+	{
+		Copy_Evaluator->ErrorKeys++;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDIncrementalUndo
+ * Description: Rolls the running state back by one key: first any keys typed after an
+ *              error, then a digit, a pending sign, a function with the sign typed
+ *              before it pending again, or an operator through its saved
+ *              checkpoint. Does nothing on an empty expression, or when the operator
+ *              to roll back is older than the checkpoints kept.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDIncrementalUndo(Calculator_IncrementalType *Copy_Evaluator)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+
+	if (Copy_Evaluator->ErrorKeys)
+	{
+		Copy_Evaluator->ErrorKeys--;
+		if (0 == Copy_Evaluator->ErrorKeys)
+		{
+			Copy_Evaluator->State = 0;
+		}
+	}
+	else if (LOC_Current->Digits)
+	{
+		Calculator_VOIDNumberDropDigit(LOC_Current);
+		LOC_Current->Digits--;
+	}
+	else if (LOC_Current->Negative)
+	{
+		LOC_Current->Negative = 0;
+	}
+#if CALCULATOR_FUNCTIONS == 1
+	else if (LOC_Current->Functions)
+	{
+		LOC_Current->Functions >>= CALCULATOR_FUNCTION_BITS;
+		if (CALCULATOR_FUNCTION_NEGATE == (LOC_Current->Functions & ((1U << CALCULATOR_FUNCTION_BITS) - 1)))
+		{
+			LOC_Current->Functions >>= CALCULATOR_FUNCTION_BITS;
+			LOC_Current->Negative = 1;
+		}
+	}
+#endif
+	else if (Copy_Evaluator->CheckpointsNumber)
+	{
+		Copy_Evaluator->CheckpointsHead = (0 == Copy_Evaluator->CheckpointsHead) ? CALCULATOR_CHECKPOINTS - 1 : Copy_Evaluator->CheckpointsHead - 1;
+		Copy_Evaluator->CheckpointsNumber--;
+		*LOC_Current = Copy_Evaluator->Checkpoints[Copy_Evaluator->CheckpointsHead];
+	}
+}
+
+/************************************************************************************
+ * Function Name: Calculator_U8IncrementalResult
+ * Description: Finalizes the running state without modifying it, which takes a constant
+ *              number of operations whatever the length of the expression, plus the
+ *              powers pending on the last number. Used both for the live preview and
+ *              when '=' is pressed.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_PResult: Pointer to where the result is stored when no error occurs.
+ * Return:
+ *      - u8: Error state (0: No error, 1: Syntax error, 2: Math error, 3: Overflow).
+ ************************************************************************************/
+u8 Calculator_U8IncrementalResult(Calculator_IncrementalType *Copy_Evaluator, Calculator_NumberType *Copy_PResult)
+{
+	Calculator_CheckpointType *LOC_Current = &Copy_Evaluator->Current;
+	u8 LOC_U8State = Copy_Evaluator->State;
+	Calculator_NumberType LOC_Term;
+
+	/* An empty expression or a trailing operator is incomplete */
+	if (0 == LOC_U8State && 0 == LOC_Current->Digits)
+	{
+		LOC_U8State = 1;
+	}
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8CombineTerm(Copy_Evaluator, &LOC_Term);
+	}
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8NumberApply(LOC_Current->AddOperator, Copy_PResult, &LOC_Current->Sum, &LOC_Term);
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDShowPreview
+ * Description: Shows the value of the expression typed so far right-aligned on the
+ *              second LCD line, inside the visible window, then returns the cursor to
+ *              the first line. The line is left blank while the expression is
+ *              incomplete or invalid. Columns wrap around the 40 DDRAM columns.
+ * Parameters:
+ *      - Copy_Evaluator: Pointer to the evaluator state.
+ *      - Copy_U8WindowStart: DDRAM column shown at the left edge of the LCD.
+ *      - Copy_U8CursorColumn: DDRAM column of the cursor on the first line.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDShowPreview(Calculator_IncrementalType *Copy_Evaluator, u8 Copy_U8WindowStart, u8 Copy_U8CursorColumn)
+{
+	u8 LOC_U8Preview[CALCULATOR_RESULT_WIDTH + 1], LOC_U8Length = 0, LOC_U8Iterator;
+	Calculator_NumberType LOC_Result;
+
+	if (0 == Calculator_U8IncrementalResult(Copy_Evaluator, &LOC_Result))
+	{
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+		/* A fraction is previewed as its decimal expansion, which the first line never shows */
+		if (Copy_Evaluator->Current.Approximate || Copy_Evaluator->Current.Functions)
+		{
+			LOC_U8Length = Calculator_U8ApproximateToAscii(&LOC_Result, LOC_U8Preview);
+		}
+		else
+		{
+			LOC_U8Length = NUM_RATIONAL_U8ToAscii(&LOC_Result, LOC_U8Preview, CALCULATOR_RESULT_WIDTH, NUM_RATIONAL_DECIMAL);
+		}
+#else
+		LOC_U8Length = Calculator_U8NumberToAscii(&LOC_Result, LOC_U8Preview);
+#endif
+	}
+
+	/* Right-align the preview in the 16 visible columns, blanking the rest */
+	HLCD_VOIDSetPosition(1, Copy_U8WindowStart);
+	for (LOC_U8Iterator = 0; LOC_U8Iterator < 16; LOC_U8Iterator++)
+	{
+		if (Copy_U8WindowStart + LOC_U8Iterator == 40)
+		{
+			HLCD_VOIDSetPosition(1, 0);
+		}
+		HLCD_VOIDSendCharacter((LOC_U8Iterator < 16 - LOC_U8Length) ? ' ' : LOC_U8Preview[LOC_U8Iterator - (16 - LOC_U8Length)]);
+	}
+	HLCD_VOIDSetPosition(0, Copy_U8CursorColumn);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamReset
+ * Description: Starts an empty streaming session on a cleared display.
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDStreamReset(Calculator_StreamType *Copy_Stream)
+{
+	Calculator_VOIDIncrementalReset(&Copy_Stream->Evaluator);
+	Copy_Stream->ViewHead = 0;
+	Copy_Stream->ViewCount = 0;
+	Copy_Stream->Length = 0;
+	Copy_Stream->Column = 0;
+	Copy_Stream->WindowStart = 0;
+	Copy_Stream->ClearPending = 0;
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamAppend
+ * Description: Records a character in the view and writes it at the cursor, scrolling
+ *              the display left by one once the line is full.
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ *      - Copy_U8Character: The character to append.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDStreamAppend(Calculator_StreamType *Copy_Stream, u8 Copy_U8Character)
+{
+	Copy_Stream->View[Copy_Stream->ViewHead] = Copy_U8Character;
+	Copy_Stream->ViewHead = (Copy_Stream->ViewHead + 1) & (CALCULATOR_VIEW_SIZE - 1);
+	if (Copy_Stream->ViewCount < CALCULATOR_VIEW_SIZE)
+	{
+		Copy_Stream->ViewCount++;
+	}
+
+	HLCD_VOIDSetPosition(0, Copy_Stream->Column);
+	HLCD_VOIDSendCharacter(Copy_U8Character);
+	Copy_Stream->Column = (Copy_Stream->Column == 39) ? 0 : Copy_Stream->Column + 1;
+
+	if (Copy_Stream->Length < 255)
+	{
+		Copy_Stream->Length++;
+	}
+	if (Copy_Stream->Length >= 16)
+	{
+		/* The cursor cell scrolls into view and may still hold a character from 40 columns ago */
+		if (0 == Copy_Stream->Column)
+		{
+			HLCD_VOIDSetPosition(0, 0);
+		}
+		HLCD_VOIDSendCharacter(' ');
+		HLCD_VOIDShiftDisplayLeft(1);
+		Copy_Stream->WindowStart = (Copy_Stream->WindowStart == 39) ? 0 : Copy_Stream->WindowStart + 1;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamDelete
+ * Description: Removes the last character from the view and the display, scrolling
+ *              back right and redrawing the character that comes back into view.
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ * Return: None
+ ************************************************************************************/
+static void Calculator_VOIDStreamDelete(Calculator_StreamType *Copy_Stream)
+{
+	Copy_Stream->ViewHead = (Copy_Stream->ViewHead - 1) & (CALCULATOR_VIEW_SIZE - 1);
+	Copy_Stream->ViewCount--;
+	Copy_Stream->Length--;
+	Copy_Stream->Column = (0 == Copy_Stream->Column) ? 39 : Copy_Stream->Column - 1;
+
+	HLCD_VOIDSetPosition(0, Copy_Stream->Column);
+	HLCD_VOIDSendCharacter(' ');
+
+	if (Copy_Stream->Length >= 15)
+	{
+		HLCD_VOIDShiftDisplayRight(1);
+		Copy_Stream->WindowStart = (0 == Copy_Stream->WindowStart) ? 39 : Copy_Stream->WindowStart - 1;
+
+		/* Its DDRAM cell may have been reused by a later character since it was typed */
+		HLCD_VOIDSetPosition(0, Copy_Stream->WindowStart);
+		HLCD_VOIDSendCharacter((Copy_Stream->ViewCount >= 15) ? Copy_Stream->View[(Copy_Stream->ViewHead - 15) & (CALCULATOR_VIEW_SIZE - 1)] : ' ');
+	}
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDStreamFeed
+ * Description: Consumes one key of an expression of unbounded length. The expression
+ *              itself is never stored: the incremental evaluator keeps its value and
+ *              only the last CALCULATOR_VIEW_SIZE characters are kept for the display,
+ *              which scrolls through the 40 DDRAM columns as a ring. 'C' deletes as far
+ *              back as the view reaches, and '=' shows the result, which becomes the
+ *              start of the next expression. After an error only as many keys as the
+ *              view holds are taken, so 'C' can always delete back to before it.
+ * Parameters:
+ *      - Copy_Stream: Pointer to the streaming state.
+ *      - Copy_U8Key: The key from the keypad or any other byte source.
+ * Return: None
+ ************************************************************************************/
+void Calculator_VOIDStreamFeed(Calculator_StreamType *Copy_Stream, u8 Copy_U8Key)
+{
+	u8 LOC_U8State, LOC_U8Result[CALCULATOR_RESULT_WIDTH + 1], LOC_U8Iterator;
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+	u8 LOC_U8Approximate;
+#endif
+	Calculator_NumberType LOC_Result;
+
+	MPROFILE_ENTER(MPROFILE_STREAM_FEED);
+
+	/* Remove a previous error message before the next expression starts */
+	if (Copy_Stream->ClearPending)
+	{
+		HLCD_VOIDClearDisplay();
+		Copy_Stream->ClearPending = 0;
+	}
+
+	if (Copy_U8Key == '=')
+	{
+		LOC_U8State = Calculator_U8IncrementalResult(&Copy_Stream->Evaluator, &LOC_Result);
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+		/* A function gives a binary approximation, shown in decimals rather than over a power of two */
+		LOC_U8Approximate = Copy_Stream->Evaluator.Current.Approximate || Copy_Stream->Evaluator.Current.Functions;
+#endif
+		HLCD_VOIDClearDisplay();
+		Calculator_VOIDStreamReset(Copy_Stream);
+		if (1 == LOC_U8State)
+		{
+			HLCD_VOIDSendString("SYNTAX ERROR!");
+			Copy_Stream->ClearPending = 1;
+		}
+		else if (2 == LOC_U8State)
+		{
+			HLCD_VOIDSendString("MATH ERROR!");
+			Copy_Stream->ClearPending = 1;
+		}
+		else if (3 == LOC_U8State)
+		{
+			HLCD_VOIDSendString("OVERFLOW!");
+			Copy_Stream->ClearPending = 1;
+		}
+		else
+		{
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL
+			if (LOC_U8Approximate)
+			{
+				Calculator_U8ApproximateToAscii(&LOC_Result, LOC_U8Result);
+			}
+			else
+#endif
+			{
+				Calculator_U8NumberToAscii(&LOC_Result, LOC_U8Result);
+			}
+			LOC_U8Iterator = 0;
+			while (LOC_U8Result[LOC_U8Iterator] && LOC_U8Result[LOC_U8Iterator] != 'e'
+			       && (CALCULATOR_DECIMAL_POINT || LOC_U8Result[LOC_U8Iterator] != '.'))
+			{
+				LOC_U8Iterator++;
+			}
+
+			/* A result in scientific notation, or a decimal that cannot be typed, is only shown */
+			if (LOC_U8Result[LOC_U8Iterator])
+			{
+				HLCD_VOIDSendString(LOC_U8Result);
+				Copy_Stream->ClearPending = 1;
+			}
+			/* The result is the first operand of the next expression */
+			else
+			{
+				for (LOC_U8Iterator = 0; LOC_U8Result[LOC_U8Iterator]; LOC_U8Iterator++)
+				{
+					Calculator_VOIDStreamAppend(Copy_Stream, LOC_U8Result[LOC_U8Iterator]);
+				}
+				Calculator_VOIDIncrementalLoad(&Copy_Stream->Evaluator, &LOC_Result);
+#if CALCULATOR_NUMBER == CALCULATOR_NUMBER_RATIONAL && CALCULATOR_LIVE_PREVIEW == 1
+				/* A fraction was loaded as a division, its decimal expansion goes below */
+				if (Copy_Stream->Evaluator.Current.MulOperator)
+				{
+					Calculator_VOIDShowPreview(&Copy_Stream->Evaluator, Copy_Stream->WindowStart, Copy_Stream->Column);
+				}
+#endif
+			}
+		}
+	}
+	else
+	{
+		if (Copy_U8Key == 'C')
+		{
+			if (Copy_Stream->ViewCount)
+			{
+				Calculator_VOIDStreamDelete(Copy_Stream);
+				Calculator_VOIDIncrementalUndo(&Copy_Stream->Evaluator);
+			}
+		}
+		else if (Copy_Stream->Evaluator.State && Copy_Stream->Evaluator.ErrorKeys >= CALCULATOR_VIEW_SIZE)
+		{
+			/* Keys after an error are only taken while 'C' can still delete them all */
+		}
+		else
+		{
+			Calculator_VOIDStreamAppend(Copy_Stream, Copy_U8Key);
+			Calculator_VOIDIncrementalFeed(&Copy_Stream->Evaluator, Copy_U8Key);
+		}
+
+#if CALCULATOR_LIVE_PREVIEW == 1
+		/* Show the value of what has been typed so far */
+		Calculator_VOIDShowPreview(&Copy_Stream->Evaluator, Copy_Stream->WindowStart, Copy_Stream->Column);
+#else
+		HLCD_VOIDSetPosition(0, Copy_Stream->Column);
+#endif
+	}
+
+	MPROFILE_EXIT(MPROFILE_STREAM_FEED);
+}
+
+/************************************************************************************
+ * Function Name: Calculator_VOIDCalculation
+ * Description: Evaluates the entire mathematical expression by parsing operators and
+ *              operands, performing calculations, and displaying the result on an LCD.
+ * Parameters:
+ *      - Copy_U8ExpressionArray: Pointer to the input expression array.
+ * Return:
+ *      - u8: Final counter value after the calculations are completed.
+ ************************************************************************************/
+u8 Calculator_VOIDCalculation(u8 *Copy_U8ExpressionArray)
+{
+	u8 LOC_U8State = 0, LOC_U8RetCounterValue = 0;
+
+#if CALCULATOR_ENGINE == CALCULATOR_ENGINE_SINGLE_PASS
+	Calculator_TokenType LOC_TokensArray[CALCULATOR_MAX_TOKENS];
+	u8 LOC_U8TokensNumber = 0;
+	s32 LOC_S32Result = 0;
+
+	/* Lex the expression once, then validate and evaluate the tokens */
+	LOC_U8State = Calculator_U8Tokenize(Copy_U8ExpressionArray, LOC_TokensArray, &LOC_U8TokensNumber);
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8ValidateTokens(LOC_TokensArray, LOC_U8TokensNumber);
+	}
+	if (0 == LOC_U8State)
+	{
+		LOC_U8State = Calculator_U8Evaluate(LOC_TokensArray, &LOC_S32Result);
+	}
+
+	/* Display the outcome and write the result back so it can be chained */
+	LOC_U8RetCounterValue = Calculator_U8ShowResult(Copy_U8ExpressionArray, LOC_U8State, LOC_S32Result);
+#else
+	/* Clear the LCD display */
+	HLCD_VOIDClearDisplay();
+
+	/* Check for any syntax or mathematical errors in the expression */
+	LOC_U8State = Calculator_U8ErrorState(Copy_U8ExpressionArray);
+
+	/* No errors, proceed with calculations */
+	if (0 == LOC_U8State)
+	{
+		u8 LOC_U8OperationsOrder[20];  /* Array to store the order of operations */
+		s32 LOC_S32NumbersArray[2];    /* Array to store operands for the current operation */
+		u8 LOC_U8NumberofOperations = Calculator_U8OperationsOrder(Copy_U8ExpressionArray, LOC_U8OperationsOrder);  /* Get the number of operations to perform */
+
+		/* Loop through and perform each operation */
+		while (LOC_U8NumberofOperations > 0)
+		{
+			/* Perform the current operation */
+			LOC_U8RetCounterValue = Calculator_VOIDOperationCalculation(LOC_U8OperationsOrder, LOC_S32NumbersArray, Copy_U8ExpressionArray);
+
+			/* Recalculate the order of operations after each calculation */
+			LOC_U8NumberofOperations = Calculator_U8OperationsOrder(Copy_U8ExpressionArray, LOC_U8OperationsOrder);
+		}
+	}
+
+	/* Display error message if syntax error */
+	if (1 == LOC_U8State)
+	{
+		HLCD_VOIDSendString("SYNTAX ERROR!");
+	}
+	/* Display error message if mathematical error (e.g., division by zero) */
+	else if (2 == LOC_U8State)
+	{
+		HLCD_VOIDSendString("MATH ERROR!");
+	}
+	else
+	{
+		u8 LOC_U8Iterator = 1;
+
+		/* Display the result on the LCD screen until '=' is encountered */
+		while (Copy_U8ExpressionArray[LOC_U8Iterator] != '=')
+		{
+			HLCD_VOIDSendCharacter(Copy_U8ExpressionArray[LOC_U8Iterator]);
+			LOC_U8Iterator++;
+		}
+	}
+#endif
+
+	/* Send the result screen to the LCD */
+	HLCD_VOIDFlush();
+
+	return LOC_U8RetCounterValue;  /* Return the counter value after calculation */
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Module: HKPD (HAL Keypad Configuration)
+ *
+ * File Name: HKPD_CFG.h
+ *
+ * Description: Configuration file for the keypad module to select how the
+ *              matrix is scanned and how key events are debounced.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _HKPD_CFG_H_
+#define _HKPD_CFG_H_
+
+/************************************************************************************
+ * Description: Configure how the keypad matrix is scanned.
+ * Default: HKPD_SCAN_TIMER
+ * Options:
+ *      - HKPD_SCAN_POLLING: HKPD_U8GetEvent scans once through HKPD_U8GetPressedValue,
+ *                           which blocks until the key is released.
+ *      - HKPD_SCAN_TIMER: The Timer 2 compare interrupt scans the matrix, debounces
+ *                         every key and queues press and release events.
+ ************************************************************************************/
+#define HKPD_SCAN_POLLING 0
+#define HKPD_SCAN_TIMER   1
+
+#define HKPD_SCAN_MODE HKPD_SCAN_TIMER
+
+/************************************************************************************
+ * Description: Timer 2 compare value of the scan tick. With 8 us per count the
+ *              period is (value + 1) * 8 us.
+ * Default: 124 (1 ms per scan)
+ ************************************************************************************/
+#define HKPD_SCAN_COMPARE 124
+
+/************************************************************************************
+ * Description: Length of the per-key debounce integrator. A clean press or release
+ *              is reported after this many scans, which bounds the key to event
+ *              latency. Bounces delay the report instead of repeating it.
+ * Default: 5 (5 ms)
+ ************************************************************************************/
+#define HKPD_DEBOUNCE_TICKS 5
+
+/************************************************************************************
+ * Description: Auto-repeat of a held key. The first repeat comes after the delay,
+ *              then one every period. A delay of 0 disables auto-repeat.
+ * Default: 500 ms delay, 150 ms period
+ ************************************************************************************/
+#define HKPD_REPEAT_DELAY_TICKS  500
+#define HKPD_REPEAT_PERIOD_TICKS 150
+
+/************************************************************************************
+ * Description: Index (row * 4 + column) of the shift key, which reaches the second
+ *              layer of the keymap. Pressing another key while it is held gives the
+ *              second value of that key. Pressed and released alone it reports its
+ *              own value on the release, so it does not auto-repeat. 16 disables the
+ *              shift layer.
+ * Default: 14 ('=')
+ ************************************************************************************/
+#define HKPD_SHIFT_NONE 16
+
+#define HKPD_SHIFT_KEY 14
+
+/************************************************************************************
+ * Description: Keys of the second layer only a calculator computing with fractions
+ *              accepts: the point on '0' and the functions on the top two rows.
+ *              Left out, those keys keep their first value on the second layer. The
+ *              application must accept what the keypad gives, the calculator checks
+ *              them against its CALCULATOR_DECIMAL_POINT and CALCULATOR_FUNCTIONS.
+ * Default: 0 and 0, as the default integer calculator
+ * Options:
+ *      - 0: Left out
+ *      - 1: On the second layer
+ ************************************************************************************/
+#ifndef HKPD_SHIFT_POINT
+#define HKPD_SHIFT_POINT 0
+#endif
+
+#ifndef HKPD_SHIFT_FUNCTIONS
+#define HKPD_SHIFT_FUNCTIONS 0
+#endif
+
+/************************************************************************************
+ * Description: Number of slots of the event queue, one is always kept free. Must be
+ *              a power of two. Events arriving at a full queue are dropped.
+ * Default: 16
+ ************************************************************************************/
+#define HKPD_EVENT_QUEUE_SIZE 16
+
+#endif /* _HKPD_CFG_H_ */
@@ -1,43 +1,90 @@
-/******************************************************************************
- *
- * Module: HKPD (HAL Keypad Interface)
- *
- * File Name: HKPD_Interface.h
- *
- * Description: Header file for the keypad module, containing function
- *              declarations for keypad initialization and key detection.
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-
-#ifndef _HKPD_INTERFACE_H_
-#define _HKPD_INTERFACE_H_
-
-/* Include Standard Types Library */
-#include "../../LIB/STD_TYPES.h"
-
-/* Include MDIO Interface for DIO functionalities */
-#include "../../MCAL/DIO/MDIO_Interface.h"
-
-/* Include Delay Library for timing functions */
-#include <avr/delay.h>
-
-/************************************************************************************
- * Function Name: HKPD_VOIDInitialization
- * Description: Configures the keypad pins as input and output and initializes them.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HKPD_VOIDInitialization(void);
-
-/************************************************************************************
- * Function Name: HKPD_U8GetPressedValue
- * Description: Scans the keypad to detect a pressed key and returns its value.
- * Parameters: None
- * Return:
- *      - u8: The ASCII value of the pressed key or 30 (indicating no key pressed).
- ************************************************************************************/
-u8 HKPD_U8GetPressedValue(void);
-
-#endif /* _HKPD_INTERFACE_H_ */
+/******************************************************************************
+ *
+ * Module: HKPD (HAL Keypad Interface)
+ *
+ * File Name: HKPD_Interface.h
+ *
+ * Description: Header file for the keypad module, containing function
+ *              declarations for keypad initialization and key detection.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _HKPD_INTERFACE_H_
+#define _HKPD_INTERFACE_H_
+
+/* Include Standard Types Library */
+#include "../../LIB/STD_TYPES.h"
+
+/* Include Flash Memory Access for the keymap */
+#include "../../LIB/FLASH_MEM.h"
+
+/* Include MDIO Interface for DIO functionalities */
+#include "../../MCAL/DIO/MDIO_Interface.h"
+
+/* Include Timer and Global Interrupt Interfaces for the scan tick */
+#include "../../MCAL/TIMER/MTIMER_Interface.h"
+#include "../../MCAL/GIE/MGIE_Interface.h"
+
+/* Include the backend for the delays of the selected target */
+#include "../../MCAL/BACKEND/MBACKEND_Interface.h"
+
+/* Include the profiler marking the scan regions */
+#include "../../MCAL/PROFILE/MPROFILE_Interface.h"
+
+/* Include Keypad Configuration */
+#include "HKPD_CFG.h"
+
+/* Returned by HKPD_U8GetPressedValue when no key or more than one key is pressed */
+#define HKPD_NO_KEY        30
+#define HKPD_MULTIPLE_KEYS 31
+
+/* Event queued once when the keys held down make the matrix ambiguous (ghosting) */
+#define HKPD_EVENT_GHOST 0x7F
+
+/* Set in an event for a key release, the lower bits hold the ASCII value of the key */
+#define HKPD_EVENT_RELEASE 0x80
+
+/* Extract the ASCII value of the key from an event */
+#define HKPD_EVENT_KEY(event) ((event) & 0x7F)
+
+/************************************************************************************
+ * Function Name: HKPD_VOIDInitialization
+ * Description: Configures the keypad pins as input and output and initializes them.
+ *              With HKPD_SCAN_TIMER the periodic scan is started as well.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HKPD_VOIDInitialization(void);
+
+/************************************************************************************
+ * Function Name: HKPD_U8GetPressedValue
+ * Description: Scans the keypad to detect a pressed key and returns its value.
+ *              Blocks while the key is held. A key pressed while the shift key is
+ *              held gives its second value. Must not be used with HKPD_SCAN_TIMER.
+ * Parameters: None
+ * Return:
+ *      - u8: The ASCII value of the pressed key, HKPD_NO_KEY (30) if no key is
+ *            pressed or HKPD_MULTIPLE_KEYS (31) if more than one key is pressed.
+ ************************************************************************************/
+u8 HKPD_U8GetPressedValue(void);
+
+/************************************************************************************
+ * Function Name: HKPD_U8GetEvent
+ * Description: Takes the oldest key event from the event queue without blocking.
+ *              A held key produces repeated press events and HKPD_EVENT_GHOST is
+ *              reported when the pressed keys cannot be told apart. A key pressed
+ *              while the shift key is held reports its second value, and the
+ *              shift key reports its own only when released alone. With
+ *              HKPD_SCAN_POLLING the keypad is scanned once instead and only press
+ *              events are reported.
+ * Parameters:
+ *      - Copy_PU8Event: Pointer to store the event, the ASCII value of the key with
+ *                       HKPD_EVENT_RELEASE set for a release.
+ * Return:
+ *      - u8: 1 if an event was stored, 0 if there was none.
+ ************************************************************************************/
+u8 HKPD_U8GetEvent(u8 *Copy_PU8Event);
+
+#endif /* _HKPD_INTERFACE_H_ */
@@ -1,85 +1,494 @@
-/******************************************************************************
- *
- * Module: HKPD (HAL Keypad Interface)
- *
- * File Name: HKPD_Interface.c
- *
- * Description: Source file for the keypad module, containing functions for
- *              initializing the keypad and detecting pressed keys.
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-
-#include "HKPD_Interface.h"
-
-/************************************************************************************
- * Function Name: HKPD_VOIDInitialization
- * Description: Configures the keypad pins as input and output and initializes them.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HKPD_VOIDInitialization(void)
-{
-    /* Set lower nibble (R0-R3) as output and upper nibble (C0-C3) as input */
-    MDIO_VOIDSetPortDirection(0, 0b00001111);
-
-    /* Activate pull-up resistors on input pins (C0-C3) */
-    MDIO_VOIDSetPortValue(0, 0b11111111);
-}
-
-/************************************************************************************
- * Function Name: HKPD_U8GetPressedValue
- * Description: Scans the keypad to detect a pressed key and returns its value.
- * Parameters: None
- * Return:
- *      - u8: The ASCII value of the pressed key or 30 (indicating no key pressed).
- ************************************************************************************/
-u8 HKPD_U8GetPressedValue(void)
-{
-    u8 LOC_U8Row, LOC_U8Column, LOC_U8PinValue, LOC_U8ReturnedValue = 30;
-
-    /* 2D array representing the keypad layout */
-    u8 LOC_U8CalculatorKeys[4][4] = {
-        {'7', '8', '9', '/'},
-        {'4', '5', '6', '*'},
-        {'1', '2', '3', '-'},
-        {'C', '0', '=', '+'}
-    };
-
-    /* Iterate through each column */
-    for (LOC_U8Column = 0; LOC_U8Column < 4; LOC_U8Column++)
-    {
-        /* Activate the current column by driving it LOW */
-        MDIO_VOIDSetPinValue(0, LOC_U8Column, 0);
-
-        /* Check each row in the current column */
-        for (LOC_U8Row = 0; LOC_U8Row < 4; LOC_U8Row++)
-        {
-            /* Read the state of the current row pin */
-            LOC_U8PinValue = MDIO_U8GetPinValue(0, LOC_U8Row + 4);
-
-            /* If a key is pressed (row pin is LOW) */
-            if (0 == LOC_U8PinValue)
-            {
-                /* Get the corresponding key value from the layout array */
-                LOC_U8ReturnedValue = LOC_U8CalculatorKeys[LOC_U8Row][LOC_U8Column];
-
-                /* Wait until the key is released */
-                while (0 == MDIO_U8GetPinValue(0, LOC_U8Row + 4))
-                {
-                    /* Do nothing */
-                }
-
-                /* Debounce delay */
-                _delay_ms(10);
-            }
-        }
-
-        /* Deactivate the current column by driving it HIGH */
-        MDIO_VOIDSetPinValue(0, LOC_U8Column, 1);
-    }
-
-    /* Return the detected key value (or 30 if no key is pressed) */
-    return LOC_U8ReturnedValue;
-}
+/******************************************************************************
+ *
+ * Module: HKPD (HAL Keypad Interface)
+ *
+ * File Name: HKPD_Interface.c
+ *
+ * Description: Source file for the keypad module, containing functions for
+ *              initializing the keypad and detecting pressed keys.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "HKPD_Interface.h"
+
+/* Layout of the keypad, indexed by row * 4 + column */
+static FLASH_CONST u8 HKPD_AU8Keymap[16] = {
+    '7', '8', '9', '/',
+    '4', '5', '6', '*',
+    '1', '2', '3', '-',
+    'C', '0', '=', '+'
+};
+
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+/* Second layer, reached through the shift key: power on '*', its modulus on '/', the
+ * point on '0' with HKPD_SHIFT_POINT, and the functions on the top two rows with
+ * HKPD_SHIFT_FUNCTIONS: sin, cos, atan, exp, ln and the square root. The other keys
+ * keep their value. */
+static FLASH_CONST u8 HKPD_AU8ShiftKeymap[16] = {
+#if HKPD_SHIFT_FUNCTIONS == 1
+    's', 'c', 'a', '%',
+    'e', 'l', 'r', '^',
+#else
+    '7', '8', '9', '%',
+    '4', '5', '6', '^',
+#endif
+    '1', '2', '3', '-',
+#if HKPD_SHIFT_POINT == 1
+    'C', '.', '=', '+'
+#else
+    'C', '0', '=', '+'
+#endif
+};
+#endif
+
+/* Spreads the four row bits of one column read to bits 0, 4, 8 and 12 */
+static FLASH_CONST u16 HKPD_AU16RowSpread[16] = {
+    0x0000, 0x0001, 0x0010, 0x0011, 0x0100, 0x0101, 0x0110, 0x0111,
+    0x1000, 0x1001, 0x1010, 0x1011, 0x1100, 0x1101, 0x1110, 0x1111
+};
+
+/************************************************************************************
+ * Function Name: HKPD_U16ScanMatrix
+ * Description: Reads the whole matrix with one port write and one port read per
+ *              column, instead of one pin access per key.
+ * Parameters: None
+ * Return:
+ *      - u16: Pressed keys, bit (row * 4 + column) set for every key reading LOW.
+ ************************************************************************************/
+static u16 HKPD_U16ScanMatrix(void)
+{
+    u16 LOC_U16Keys = 0;
+    u8 LOC_U8Column, LOC_U8Rows;
+
+    for (LOC_U8Column = 0; LOC_U8Column < 4; LOC_U8Column++)
+    {
+        /* Drive only the current column LOW, the row pull-ups are not touched */
+        MDIO_VOIDWritePortMaskedInline(0, 0b00001111, (u8)~(1 << LOC_U8Column));
+
+        /* Let the rows settle, this also covers the input synchronizer delay */
+        _delay_us(1);
+
+        /* All four rows at once, a pressed key pulls its row LOW */
+        LOC_U8Rows = (u8)~MDIO_U8ReadPortMaskedInline(0, 0b11110000) >> 4;
+        LOC_U16Keys |= FLASH_READ_U16(&HKPD_AU16RowSpread[LOC_U8Rows]) << LOC_U8Column;
+    }
+
+    /* Leave every column HIGH */
+    MDIO_VOIDWritePortMaskedInline(0, 0b00001111, 0b00001111);
+
+    return LOC_U16Keys;
+}
+
+#if HKPD_SCAN_MODE == HKPD_SCAN_TIMER
+/************************************************************************************
+ * Function Name: HKPD_U8IsAmbiguous
+ * Description: Checks a scan for ghosting. Without diodes three keys on the corners
+ *              of a rectangle make the fourth corner read pressed too, so any two
+ *              rows sharing two or more pressed columns cannot be trusted.
+ * Parameters:
+ *      - Copy_U16Keys: Pressed keys as returned by HKPD_U16ScanMatrix.
+ * Return:
+ *      - u8: 1 if the scan may contain phantom keys, 0 otherwise.
+ ************************************************************************************/
+static u8 HKPD_U8IsAmbiguous(u16 Copy_U16Keys)
+{
+    u8 LOC_U8Row, LOC_U8Other, LOC_U8Common, LOC_U8Ambiguous = 0;
+
+    for (LOC_U8Row = 0; LOC_U8Row < 3; LOC_U8Row++)
+    {
+        for (LOC_U8Other = LOC_U8Row + 1; LOC_U8Other < 4; LOC_U8Other++)
+        {
+            LOC_U8Common = (Copy_U16Keys >> (LOC_U8Row << 2)) & (Copy_U16Keys >> (LOC_U8Other << 2)) & 0x0F;
+
+            /* More than one bit set */
+            if (LOC_U8Common & (LOC_U8Common - 1))
+            {
+                LOC_U8Ambiguous = 1;
+            }
+        }
+    }
+
+    return LOC_U8Ambiguous;
+}
+
+/* Debounce integrator of every key and the debounced states, one bit per key */
+static u8 HKPD_AU8Integrator[16];
+static u16 HKPD_U16KeyStates;
+
+/* Index of the key being auto-repeated (0xFF for none) and ticks to its next repeat */
+static u8 HKPD_U8RepeatKey = 0xFF;
+static u16 HKPD_U16RepeatTicks;
+
+/* Set while the matrix reads ambiguous, so the ghost event is queued only once */
+static u8 HKPD_U8GhostReported;
+
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+/* States of the shift key */
+#define HKPD_SHIFT_RELEASED 0 /* Not held */
+#define HKPD_SHIFT_PENDING  1 /* Held alone so far, reports its own value on release */
+#define HKPD_SHIFT_USED     2 /* Held and another key was pressed through it */
+
+static u8 HKPD_U8ShiftState;
+
+/* Keys pressed through the shift layer, one bit per key, so their repeats and
+ * releases report the same value as their press */
+static u16 HKPD_U16ShiftedKeys;
+#endif
+
+/* Event ring buffer, head is only written by the interrupt and tail by the reader */
+static u8 HKPD_AU8Events[HKPD_EVENT_QUEUE_SIZE];
+static volatile u8 HKPD_U8EventsHead, HKPD_U8EventsTail;
+
+/************************************************************************************
+ * Function Name: HKPD_U8PushEvent
+ * Description: Adds an event to the event queue, dropping it if the queue is full.
+ * Parameters:
+ *      - Copy_U8Event: The event to add.
+ * Return:
+ *      - u8: 1 if the event was queued, 0 if it was dropped.
+ ************************************************************************************/
+static u8 HKPD_U8PushEvent(u8 Copy_U8Event)
+{
+    u8 LOC_U8Head = HKPD_U8EventsHead;
+    u8 LOC_U8Next = (LOC_U8Head + 1) & (HKPD_EVENT_QUEUE_SIZE - 1);
+    u8 LOC_U8Queued = 0;
+
+    if (LOC_U8Next != HKPD_U8EventsTail)
+    {
+        HKPD_AU8Events[LOC_U8Head] = Copy_U8Event;
+        HKPD_U8EventsHead = LOC_U8Next;
+        LOC_U8Queued = 1;
+    }
+
+    return LOC_U8Queued;
+}
+
+/************************************************************************************
+ * Function Name: HKPD_U8KeyValue
+ * Description: Gives the value a debounced key reports, from the layer it was
+ *              pressed on.
+ * Parameters:
+ *      - Copy_U8Key: Index of the key, row * 4 + column.
+ * Return:
+ *      - u8: The ASCII value of the key.
+ ************************************************************************************/
+static u8 HKPD_U8KeyValue(u8 Copy_U8Key)
+{
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+    if (GET_BIT(HKPD_U16ShiftedKeys, Copy_U8Key))
+    {
+        return FLASH_READ_U8(&HKPD_AU8ShiftKeymap[Copy_U8Key]);
+    }
+#endif
+    return FLASH_READ_U8(&HKPD_AU8Keymap[Copy_U8Key]);
+}
+
+/************************************************************************************
+ * Function Name: HKPD_VOIDKeyPressed
+ * Description: Reports a debounced press and makes the key the one auto-repeated.
+ *              The shift key is only noted, and a key pressed while it is held is
+ *              reported from the second layer.
+ * Parameters:
+ *      - Copy_U8Key: Index of the key, row * 4 + column.
+ * Return: None
+ ************************************************************************************/
+static void HKPD_VOIDKeyPressed(u8 Copy_U8Key)
+{
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+    if (HKPD_SHIFT_KEY == Copy_U8Key)
+    {
+        /* Nothing to report until the next key or the release */
+        HKPD_U8ShiftState = HKPD_SHIFT_PENDING;
+        return;
+    }
+    if (HKPD_SHIFT_RELEASED != HKPD_U8ShiftState)
+    {
+        SET_BIT(HKPD_U16ShiftedKeys, Copy_U8Key);
+        HKPD_U8ShiftState = HKPD_SHIFT_USED;
+    }
+#endif
+
+    if (HKPD_U8PushEvent(HKPD_U8KeyValue(Copy_U8Key)))
+    {
+        MPROFILE_LATENCY_ACCEPT(Copy_U8Key);
+    }
+    HKPD_U8RepeatKey = Copy_U8Key;
+    HKPD_U16RepeatTicks = HKPD_REPEAT_DELAY_TICKS;
+}
+
+/************************************************************************************
+ * Function Name: HKPD_VOIDKeyReleased
+ * Description: Reports a debounced release with the value of the press. The shift
+ *              key released without another key pressed through it reports its own
+ *              press and release now.
+ * Parameters:
+ *      - Copy_U8Key: Index of the key, row * 4 + column.
+ * Return: None
+ ************************************************************************************/
+static void HKPD_VOIDKeyReleased(u8 Copy_U8Key)
+{
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+    if (HKPD_SHIFT_KEY == Copy_U8Key)
+    {
+        if (HKPD_SHIFT_PENDING == HKPD_U8ShiftState)
+        {
+            /* The key takes effect on the release, so its latency starts here */
+            MPROFILE_LATENCY_DETECT(Copy_U8Key);
+            if (HKPD_U8PushEvent(FLASH_READ_U8(&HKPD_AU8Keymap[Copy_U8Key])))
+            {
+                MPROFILE_LATENCY_ACCEPT(Copy_U8Key);
+            }
+            HKPD_U8PushEvent(FLASH_READ_U8(&HKPD_AU8Keymap[Copy_U8Key]) | HKPD_EVENT_RELEASE);
+        }
+        HKPD_U8ShiftState = HKPD_SHIFT_RELEASED;
+        return;
+    }
+#endif
+
+    HKPD_U8PushEvent(HKPD_U8KeyValue(Copy_U8Key) | HKPD_EVENT_RELEASE);
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+    CLR_BIT(HKPD_U16ShiftedKeys, Copy_U8Key);
+#endif
+    if (HKPD_U8RepeatKey == Copy_U8Key)
+    {
+        HKPD_U8RepeatKey = 0xFF;
+    }
+}
+
+/************************************************************************************
+ * Function Name: HKPD_VOIDScanTick
+ * Description: Timer 2 callback scanning the whole matrix once. Each key has an
+ *              integrator that counts up while the key reads pressed and down while
+ *              it reads released. A press is reported when it reaches
+ *              HKPD_DEBOUNCE_TICKS and a release when it falls back to 0. The most
+ *              recently pressed key is auto-repeated while it is held. The shift key
+ *              is held back until another key is pressed, which is then reported
+ *              from the second layer, or until it is released alone, which reports
+ *              its own press and release. An ambiguous scan is reported once with
+ *              HKPD_EVENT_GHOST and leaves the debounce state untouched.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static void HKPD_VOIDScanTick(void)
+{
+    u16 LOC_U16Keys;
+    u8 LOC_U8Key;
+
+    MPROFILE_ENTER(MPROFILE_SCAN_TICK);
+    LOC_U16Keys = HKPD_U16ScanMatrix();
+
+    if (HKPD_U8IsAmbiguous(LOC_U16Keys))
+    {
+        if (!HKPD_U8GhostReported)
+        {
+            HKPD_U8PushEvent(HKPD_EVENT_GHOST);
+            HKPD_U8GhostReported = 1;
+        }
+    }
+    else
+    {
+        HKPD_U8GhostReported = 0;
+
+        for (LOC_U8Key = 0; LOC_U8Key < 16; LOC_U8Key++)
+        {
+            if (GET_BIT(LOC_U16Keys, LOC_U8Key))
+            {
+                /* First contact of a released key */
+                if (0 == HKPD_AU8Integrator[LOC_U8Key] && !GET_BIT(HKPD_U16KeyStates, LOC_U8Key))
+                {
+                    MPROFILE_LATENCY_DETECT(LOC_U8Key);
+                }
+                if (HKPD_AU8Integrator[LOC_U8Key] < HKPD_DEBOUNCE_TICKS)
+                {
+                    HKPD_AU8Integrator[LOC_U8Key]++;
+                }
+            }
+            else if (HKPD_AU8Integrator[LOC_U8Key] > 0)
+            {
+                HKPD_AU8Integrator[LOC_U8Key]--;
+            }
+
+            if (HKPD_DEBOUNCE_TICKS == HKPD_AU8Integrator[LOC_U8Key] && !GET_BIT(HKPD_U16KeyStates, LOC_U8Key))
+            {
+                SET_BIT(HKPD_U16KeyStates, LOC_U8Key);
+                HKPD_VOIDKeyPressed(LOC_U8Key);
+            }
+            else if (0 == HKPD_AU8Integrator[LOC_U8Key] && GET_BIT(HKPD_U16KeyStates, LOC_U8Key))
+            {
+                CLR_BIT(HKPD_U16KeyStates, LOC_U8Key);
+                HKPD_VOIDKeyReleased(LOC_U8Key);
+            }
+        }
+    }
+
+#if HKPD_REPEAT_DELAY_TICKS > 0
+    if (0xFF != HKPD_U8RepeatKey)
+    {
+        HKPD_U16RepeatTicks--;
+        if (0 == HKPD_U16RepeatTicks)
+        {
+            if (HKPD_U8PushEvent(HKPD_U8KeyValue(HKPD_U8RepeatKey)))
+            {
+                MPROFILE_LATENCY_ACCEPT(HKPD_U8RepeatKey);
+            }
+            HKPD_U16RepeatTicks = HKPD_REPEAT_PERIOD_TICKS;
+        }
+    }
+#endif
+
+    MPROFILE_EXIT(MPROFILE_SCAN_TICK);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: HKPD_VOIDInitialization
+ * Description: Configures the keypad pins as input and output and initializes them.
+ *              With HKPD_SCAN_TIMER the periodic scan is started as well.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HKPD_VOIDInitialization(void)
+{
+    /* Set lower nibble (R0-R3) as output and upper nibble (C0-C3) as input */
+    MDIO_VOIDSetPortDirectionInline(0, 0b00001111);
+
+    /* Activate pull-up resistors on input pins (C0-C3) */
+    MDIO_VOIDSetPortValueInline(0, 0b11111111);
+
+#if HKPD_SCAN_MODE == HKPD_SCAN_TIMER
+    MTIMER_VOIDTimer2SetCallback(HKPD_VOIDScanTick);
+    MTIMER_VOIDTimer2Init(HKPD_SCAN_COMPARE);
+    MTIMER_VOIDTimer2EnableInterrupt();
+    MGIE_VOIDEnable();
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HKPD_U8GetPressedValue
+ * Description: Scans the keypad to detect a pressed key and returns its value.
+ *              Blocks while the key is held. A key pressed while the shift key is
+ *              held gives its second value. Must not be used with HKPD_SCAN_TIMER.
+ * Parameters: None
+ * Return:
+ *      - u8: The ASCII value of the pressed key, HKPD_NO_KEY (30) if no key is
+ *            pressed or HKPD_MULTIPLE_KEYS (31) if more than one key is pressed.
+ ************************************************************************************/
+u8 HKPD_U8GetPressedValue(void)
+{
+    u8 LOC_U8Key = 0, LOC_U8ReturnedValue = HKPD_NO_KEY;
+    u16 LOC_U16Keys;
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+    u8 LOC_U8Shifted = 0;
+#endif
+
+    MPROFILE_ENTER(MPROFILE_PRESSED_VALUE);
+    LOC_U16Keys = HKPD_U16ScanMatrix();
+
+    if (LOC_U16Keys)
+    {
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+        if (GET_BIT(LOC_U16Keys, HKPD_SHIFT_KEY))
+        {
+            /* Collect the keys pressed while shift is held, until all are released */
+            u16 LOC_U16Held;
+
+            while ((LOC_U16Held = HKPD_U16ScanMatrix()))
+            {
+                LOC_U16Keys |= LOC_U16Held;
+            }
+
+            /* Alone it is a key like the others, else it selects the second layer */
+            if (LOC_U16Keys != (1U << HKPD_SHIFT_KEY))
+            {
+                CLR_BIT(LOC_U16Keys, HKPD_SHIFT_KEY);
+                LOC_U8Shifted = 1;
+            }
+        }
+#endif
+
+        /* More than one bit set */
+        if (LOC_U16Keys & (LOC_U16Keys - 1))
+        {
+            LOC_U8ReturnedValue = HKPD_MULTIPLE_KEYS;
+        }
+        else
+        {
+            while (!GET_BIT(LOC_U16Keys, LOC_U8Key))
+            {
+                LOC_U8Key++;
+            }
+#if HKPD_SHIFT_KEY != HKPD_SHIFT_NONE
+            if (LOC_U8Shifted)
+            {
+                LOC_U8ReturnedValue = FLASH_READ_U8(&HKPD_AU8ShiftKeymap[LOC_U8Key]);
+            }
+            else
+#endif
+            {
+                LOC_U8ReturnedValue = FLASH_READ_U8(&HKPD_AU8Keymap[LOC_U8Key]);
+            }
+        }
+
+        /* Wait until every key is released */
+        while (HKPD_U16ScanMatrix())
+        {
+            /* Do nothing */
+        }
+
+        /* Debounce delay */
+        _delay_ms(10);
+    }
+
+    MPROFILE_EXIT(MPROFILE_PRESSED_VALUE);
+
+    /* Return the detected key value */
+    return LOC_U8ReturnedValue;
+}
+
+/************************************************************************************
+ * Function Name: HKPD_U8GetEvent
+ * Description: Takes the oldest key event from the event queue without blocking.
+ *              A held key produces repeated press events and HKPD_EVENT_GHOST is
+ *              reported when the pressed keys cannot be told apart. A key pressed
+ *              while the shift key is held reports its second value, and the
+ *              shift key reports its own only when released alone. With
+ *              HKPD_SCAN_POLLING the keypad is scanned once instead and only press
+ *              events are reported.
+ * Parameters:
+ *      - Copy_PU8Event: Pointer to store the event, the ASCII value of the key with
+ *                       HKPD_EVENT_RELEASE set for a release.
+ * Return:
+ *      - u8: 1 if an event was stored, 0 if there was none.
+ ************************************************************************************/
+u8 HKPD_U8GetEvent(u8 *Copy_PU8Event)
+{
+    u8 LOC_U8Found = 0;
+
+#if HKPD_SCAN_MODE == HKPD_SCAN_TIMER
+    u8 LOC_U8Tail = HKPD_U8EventsTail;
+
+    if (LOC_U8Tail != HKPD_U8EventsHead)
+    {
+        *Copy_PU8Event = HKPD_AU8Events[LOC_U8Tail];
+        HKPD_U8EventsTail = (LOC_U8Tail + 1) & (HKPD_EVENT_QUEUE_SIZE - 1);
+        LOC_U8Found = 1;
+    }
+#else
+    u8 LOC_U8Key = HKPD_U8GetPressedValue();
+
+    if (HKPD_MULTIPLE_KEYS == LOC_U8Key)
+    {
+        *Copy_PU8Event = HKPD_EVENT_GHOST;
+        LOC_U8Found = 1;
+    }
+    else if (HKPD_NO_KEY != LOC_U8Key)
+    {
+        *Copy_PU8Event = LOC_U8Key;
+        LOC_U8Found = 1;
+    }
+#endif
+
+    return LOC_U8Found;
+}
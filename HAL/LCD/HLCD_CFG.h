@@ -1,52 +1,137 @@
-/******************************************************************************
- *
- * Module: HLCD (HAL LCD Configuration)
- *
- * File Name: HLCD_Cfg.h
- *
- * Description: Configuration file for the HLCD module to set up ports and pins
- *              for LCD interfacing and customization options.
- *
- * Author: Omar Khedr
- *
- *
- ******************************************************************************/
-
-#ifndef _HLCD_CFG_H_
-#define _HLCD_CFG_H_
-
-/************************************************************************************
- * Description: Configure the data port (D0-D7) for LCD connection.
- * Default: Port C is used for data connections.
- * Options:
- *      - PORTA: 0
- *      - PORTB: 1
- *      - PORTC: 2
- *      - PORTD: 3
- ************************************************************************************/
-#define DATA_PORT 2
-
-/************************************************************************************
- * Description: Configure the control port (RS, RW, EN) for LCD control signals.
- * Default: Port B is used for control connections.
- * Options:
- *      - PORTA: 0
- *      - PORTB: 1
- *      - PORTC: 2
- *      - PORTD: 3
- ************************************************************************************/
-#define CONTROL_PORT 1
-
-/************************************************************************************
- * Description: Configure the control pins for RS, RW, and EN signals.
- * Default:
- *      - RS_PIN is connected to Pin 0 of the control port.
- *      - RW_PIN is connected to Pin 1 of the control port.
- *      - EN_PIN is connected to Pin 2 of the control port.
- * Options: Any pin from the chosen control port (0 to 7).
- ************************************************************************************/
-#define RS_PIN 0
-#define RW_PIN 1
-#define EN_PIN 2
-
-#endif
+/******************************************************************************
+ *
+ * Module: HLCD (HAL LCD Configuration)
+ *
+ * File Name: HLCD_Cfg.h
+ *
+ * Description: Configuration file for the HLCD module to set up ports and pins
+ *              for LCD interfacing and customization options.
+ *
+ * Author: Omar Khedr
+ *
+ *
+ ******************************************************************************/
+
+#ifndef _HLCD_CFG_H_
+#define _HLCD_CFG_H_
+
+/************************************************************************************
+ * Description: Configure the data port (D0-D7) for LCD connection.
+ * Default: Port C is used for data connections.
+ * Options:
+ *      - PORTA: 0
+ *      - PORTB: 1
+ *      - PORTC: 2
+ *      - PORTD: 3
+ ************************************************************************************/
+#define DATA_PORT 2
+
+/************************************************************************************
+ * Description: Configure the control port (RS, RW, EN) for LCD control signals.
+ * Default: Port B is used for control connections.
+ * Options:
+ *      - PORTA: 0
+ *      - PORTB: 1
+ *      - PORTC: 2
+ *      - PORTD: 3
+ ************************************************************************************/
+#define CONTROL_PORT 1
+
+/************************************************************************************
+ * Description: Configure the control pins for RS, RW, and EN signals.
+ * Default:
+ *      - RS_PIN is connected to Pin 0 of the control port.
+ *      - RW_PIN is connected to Pin 1 of the control port.
+ *      - EN_PIN is connected to Pin 2 of the control port.
+ * Options: Any pin from the chosen control port (0 to 7).
+ ************************************************************************************/
+#define RS_PIN 0
+#define RW_PIN 1
+#define EN_PIN 2
+
+/************************************************************************************
+ * Description: Configure how the driver waits for the LCD between transactions.
+ * Default: HLCD_WAIT_FIXED_DELAY
+ * Options:
+ *      - HLCD_WAIT_FIXED_DELAY: Wait 2 ms after every transaction (RW may be tied low).
+ *      - HLCD_WAIT_BUSY_FLAG: Poll the busy flag on DB7 before every transaction,
+ *                             which needs RW_PIN wired to the LCD. Falls back to the
+ *                             fixed delay if the flag never clears.
+ ************************************************************************************/
+#define HLCD_WAIT_FIXED_DELAY 0
+#define HLCD_WAIT_BUSY_FLAG   1
+
+#define HLCD_WAIT_MODE HLCD_WAIT_FIXED_DELAY
+
+/************************************************************************************
+ * Description: Number of busy flag polls (about 3 us each at 8 MHz) before the driver
+ *              gives up and falls back to the fixed delay. Must cover the 1.52 ms of
+ *              the Clear Display and Return Home instructions.
+ * Default: 1000
+ ************************************************************************************/
+#define HLCD_BUSY_TIMEOUT 1000
+
+/************************************************************************************
+ * Description: Keep a RAM shadow of the 2x40 DDRAM. Drawing APIs only update the
+ *              shadow and HLCD_VOIDFlush sends the cells that changed.
+ * Default: 1
+ * Options:
+ *      - 0: Every drawing call is sent to the LCD immediately
+ *      - 1: Drawing calls are buffered until HLCD_VOIDFlush
+ ************************************************************************************/
+#define HLCD_FRAMEBUFFER 1
+
+/************************************************************************************
+ * Description: Configure how transactions reach the LCD bus.
+ * Default: HLCD_WRITE_QUEUED
+ * Options:
+ *      - HLCD_WRITE_BLOCKING: Every transaction is performed by the caller, which
+ *                             waits as set by HLCD_WAIT_MODE.
+ *      - HLCD_WRITE_QUEUED: Transactions are put in a ring buffer and performed one
+ *                           per Timer 0 compare interrupt. HLCD_WAIT_MODE then only
+ *                           applies to HLCD_VOIDInitialization, the queue is paced
+ *                           by the timer.
+ ************************************************************************************/
+#define HLCD_WRITE_BLOCKING 0
+#define HLCD_WRITE_QUEUED   1
+
+#define HLCD_WRITE_MODE HLCD_WRITE_QUEUED
+
+/************************************************************************************
+ * Description: Number of slots of the write queue, one is always kept free. Must be
+ *              a power of two from 8 to 128.
+ * Default: 64
+ ************************************************************************************/
+#define HLCD_QUEUE_SIZE 64
+
+/************************************************************************************
+ * Description: Configure what happens to a transaction added to a full queue.
+ * Default: HLCD_QUEUE_FULL_BLOCK
+ * Options:
+ *      - HLCD_QUEUE_FULL_BLOCK: Wait for the interrupt to free a slot. Must not be
+ *                               used with interrupts disabled.
+ *      - HLCD_QUEUE_FULL_DROP: Discard the transaction and count it, see
+ *                              HLCD_U16GetDroppedCount. With the frame buffer the
+ *                              lost cells stay wrong until they change again.
+ ************************************************************************************/
+#define HLCD_QUEUE_FULL_BLOCK 0
+#define HLCD_QUEUE_FULL_DROP  1
+
+#define HLCD_QUEUE_FULL_POLICY HLCD_QUEUE_FULL_BLOCK
+
+/************************************************************************************
+ * Description: Timer 0 compare value of the queue tick. With 8 us per count the
+ *              period is (value + 1) * 8 us, which must exceed the 37 us execution
+ *              time of the LCD instructions. The period restarts at every write, so
+ *              a tick delayed by the keypad scan does not shorten the next one.
+ * Default: 6 (56 us per transaction)
+ ************************************************************************************/
+#define HLCD_QUEUE_TICK_COMPARE 6
+
+/************************************************************************************
+ * Description: Ticks skipped after Clear Display or Return Home, which take 1.52 ms.
+ * Default: 28
+ ************************************************************************************/
+#define HLCD_QUEUE_LONG_TICKS 28
+
+#endif
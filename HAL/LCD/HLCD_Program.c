@@ -1,267 +1,693 @@
-/******************************************************************************
- *
- * Module: HLCD (HAL LCD Program)
- *
- * File Name: HLCD_Program.c
- *
- * Description: Source file containing the implementation of APIs for LCD control
- *              and display operations.
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-
-#include "HLCD_Interface.h"
-
-/************************************************************************************
- * Function Name: HLCD_VOIDSendCharacter
- * Description: Sends a character to the LCD for display.
- * Parameters:
- *      - Copy_U8Data: The character to be displayed.
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDSendCharacter(u8 Copy_U8Data)
-{
-    MDIO_VOIDSetPinValue(CONTROL_PORT, RS_PIN, 1);
-    MDIO_VOIDSetPinValue(CONTROL_PORT, RW_PIN, 0);
-    MDIO_VOIDSetPortValue(DATA_PORT, Copy_U8Data);
-
-    MDIO_VOIDSetPinValue(CONTROL_PORT, EN_PIN, 1);
-    _delay_us(10);
-    MDIO_VOIDSetPinValue(CONTROL_PORT, EN_PIN, 0);
-    _delay_ms(2);
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDSendCommand
- * Description: Sends a command to the LCD for configuration.
- * Parameters:
- *      - Copy_U8Command: The command to be sent.
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDSendCommand(u8 Copy_U8Command)
-{
-    MDIO_VOIDSetPinValue(CONTROL_PORT, RS_PIN, 0);
-    MDIO_VOIDSetPinValue(CONTROL_PORT, RW_PIN, 0);
-    MDIO_VOIDSetPortValue(DATA_PORT, Copy_U8Command);
-
-    MDIO_VOIDSetPinValue(CONTROL_PORT, EN_PIN, 1);
-    _delay_us(10);
-    MDIO_VOIDSetPinValue(CONTROL_PORT, EN_PIN, 0);
-    _delay_ms(2);
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDInitialization
- * Description: Initializes the LCD by configuring the required pins and sending
- *              initialization commands.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDInitialization(void)
-{
-    MDIO_VOIDSetPortDirection(DATA_PORT, 0b11111111);
-    MDIO_VOIDSetPinDirection(CONTROL_PORT, RS_PIN, 1);
-    MDIO_VOIDSetPinDirection(CONTROL_PORT, RW_PIN, 1);
-    MDIO_VOIDSetPinDirection(CONTROL_PORT, EN_PIN, 1);
-
-    _delay_ms(40);
-    HLCD_VOIDSendCommand(0b00111000); /* Function Set */
-    _delay_ms(1);
-    HLCD_VOIDSendCommand(0b00001111); /* Display ON */
-    _delay_ms(1);
-    HLCD_VOIDSendCommand(0b00000001); /* Clear Display */
-    _delay_ms(5);
-    HLCD_VOIDSendCommand(0b00000110); /* Entry Mode Set */
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDSendNumber
- * Description: Displays a numerical value on the LCD.
- * Parameters:
- *      - Copy_U32Number: The number to be displayed.
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDSendNumber(u32 Copy_U32Number)
-{
-    u32 LOC_U32Reversed = 1, LOC_U32SentCharacter;
-
-    if (Copy_U32Number == 0)
-    {
-        HLCD_VOIDSendCharacter('0');
-    }
-
-    while (Copy_U32Number > 0)
-    {
-        LOC_U32Reversed = (LOC_U32Reversed * 10) + (Copy_U32Number % 10);
-        Copy_U32Number /= 10;
-    }
-
-    while (LOC_U32Reversed > 1)
-    {
-        LOC_U32SentCharacter = LOC_U32Reversed % 10;
-        HLCD_VOIDSendCharacter(LOC_U32SentCharacter + '0');
-        LOC_U32Reversed /= 10;
-    }
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDSetPosition
- * Description: Sets the cursor position on the LCD.
- * Parameters:
- *      - Copy_U8Row: The row number (0 or 1).
- *      - Copy_U8Column: The column number (0 to 15).
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDSetPosition(u8 Copy_U8Row, u8 Copy_U8Column)
-{
-    if (Copy_U8Row == 0)
-    {
-        HLCD_VOIDSendCommand(128 + Copy_U8Column);
-    }
-    else if (Copy_U8Row == 1)
-    {
-        HLCD_VOIDSendCommand(128 + 64 + Copy_U8Column);
-    }
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDDrawPattern
- * Description: Draws predefined custom patterns on the LCD.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDDrawPattern(void)
-{
-    /* Set CGRAM Address */
-    HLCD_VOIDSendCommand(0b01000000);
-
-    /* Pattern 1: Heart */
-    HLCD_VOIDSendCharacter(0b00000000);
-    HLCD_VOIDSendCharacter(0b00000000);
-    HLCD_VOIDSendCharacter(0b00001010);
-    HLCD_VOIDSendCharacter(0b00011111);
-    HLCD_VOIDSendCharacter(0b00001110);
-    HLCD_VOIDSendCharacter(0b00000100);
-    HLCD_VOIDSendCharacter(0b00000000);
-    HLCD_VOIDSendCharacter(0b00000000);
-
-    /* Additional patterns omitted for brevity */
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDSendString
- * Description: Displays a string on the LCD.
- * Parameters:
- *      - Copy_U8String[]: The string to be displayed.
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDSendString(u8 Copy_U8String[])
-{
-    u8 LOC_U8Character, LOC_U8Iterator = 0;
-    while (Copy_U8String[LOC_U8Iterator]) 
-    {
-        LOC_U8Character = Copy_U8String[LOC_U8Iterator];
-        HLCD_VOIDSendCharacter(LOC_U8Character);
-        LOC_U8Iterator++;
-    }
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDShiftCursorRight
- * Description: Shifts the cursor one position to the right.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDShiftCursorRight(void)
-{
-    HLCD_VOIDSendCommand(0b00010100);
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDShiftCursorLeft
- * Description: Shifts the cursor one position to the left.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-void HLCD_VOIDShiftCursorLeft(void)
-{
-    HLCD_VOIDSendCommand(0b00010000);
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDShiftDisplayRight
- * Description: This function shifts the entire display to the right by a
- * 				specified number of positions.
- * Parameters: u8 Copy_U8Shift - value of shift positions
- * Return: None
- ************************************************************************************/
-
-void HLCD_VOIDShiftDisplayRight(u8 Copy_U8Shift)
-{
-    for (u8 LOC_U8Index = 0; LOC_U8Index < Copy_U8Shift; LOC_U8Index++)
-    {
-        HLCD_VOIDSendCommand(0b00011100); /* Shift display to the right */
-    }
-}
-
-
-/************************************************************************************
- * Function Name: HLCD_VOIDShiftDisplayLeft
- * Description: This function shifts the entire display to the left by a
- * 				specified number of positions.
- * Parameters: u8 Copy_U8Shift - value of shift positions
- * Return: None
- ************************************************************************************/
-
-void HLCD_VOIDShiftDisplayLeft(u8 Copy_U8Shift)
-{
-    for (u8 LOC_U8Index = 0; LOC_U8Index < Copy_U8Shift; LOC_U8Index++)
-    {
-        HLCD_VOIDSendCommand(0b00011000); /* Shift display to the left */
-    }
-}
-
-/************************************************************************************
- * Function Name: HLCD_VOIDDeleteCharacter
- * Description: This function deletes a character at a specific index by
- * 				overwriting it with a space. The position is reset after deleting the character.
- * Parameters: u8 Copy_U8Index - index of deleted character
- * Return: None
- ************************************************************************************/
-
-void HLCD_VOIDDeleteCharacter(u8 Copy_U8Index)
-{
-    if (Copy_U8Index > 0 && Copy_U8Index < 40)
-    {
-        HLCD_VOIDSetPosition(0, Copy_U8Index); /* Set the cursor to the given position */
-        HLCD_VOIDSendCharacter(0b10000001); /* Send a blank character to delete the current character */
-        HLCD_VOIDSetPosition(0, Copy_U8Index); /* Reset the position after deletion */
-    }
-    else
-    {
-        HLCD_VOIDSetPosition(0, 0); /* If index is invalid, reset to the start of the line */
-        HLCD_VOIDSendCharacter(0b10000001); /* Send a blank character to delete */
-        HLCD_VOIDSetPosition(0, 0); /* Reset position */
-    }
-}
-
-/*
- * HLCD_VOIDClearDisplay function:
- * This function clears the entire LCD display by sending the clear display command.
- */
-
-
-/************************************************************************************
- * Function Name: HLCD_VOIDClearDisplay
- * Description: This function clears the entire LCD display by sending the clear
- * 				display command.
- * Parameters: None
- * Return: None
- ************************************************************************************/
-
-void HLCD_VOIDClearDisplay (void)
-{
-    HLCD_VOIDSendCommand(0b00000001); /* Send command to clear display */
-}
-
+/******************************************************************************
+ *
+ * Module: HLCD (HAL LCD Program)
+ *
+ * File Name: HLCD_Program.c
+ *
+ * Description: Source file containing the implementation of APIs for LCD control
+ *              and display operations.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "HLCD_Interface.h"
+
+#if HLCD_WAIT_MODE == HLCD_WAIT_BUSY_FLAG
+/* Cleared when the busy flag never drops, e.g. RW tied to ground on the board */
+static u8 HLCD_U8BusyFlagAvailable = 1;
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDWaitWhileBusy
+ * Description: Polls the busy flag (DB7) until the LCD accepts a new transaction.
+ *              The data port is switched to input only for the duration of the poll.
+ *              If the flag is still set after HLCD_BUSY_TIMEOUT polls, busy flag
+ *              polling is abandoned and the fixed delays are used from then on.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDWaitWhileBusy(void)
+{
+    u16 LOC_U16Polls = 0;
+    u8 LOC_U8Busy = 1;
+
+    if (HLCD_U8BusyFlagAvailable)
+    {
+        /* Release the data bus before the LCD starts driving it */
+        MDIO_VOIDSetPortDirectionInline(DATA_PORT, 0b00000000);
+
+        /* Instruction register read: RS low and RW high in one write */
+        MDIO_VOIDWritePortMaskedInline(CONTROL_PORT, (1 << RS_PIN) | (1 << RW_PIN), (1 << RW_PIN));
+
+        while (LOC_U8Busy && LOC_U16Polls < HLCD_BUSY_TIMEOUT)
+        {
+            MDIO_VOIDSetPinValueInline(CONTROL_PORT, EN_PIN, 1);
+            _delay_us(1);
+            LOC_U8Busy = MDIO_U8GetPinValueInline(DATA_PORT, 7);
+            MDIO_VOIDSetPinValueInline(CONTROL_PORT, EN_PIN, 0);
+            LOC_U16Polls++;
+        }
+
+        /* Stop the LCD driving the bus before taking it back */
+        MDIO_VOIDSetPinValueInline(CONTROL_PORT, RW_PIN, 0);
+        MDIO_VOIDSetPortDirectionInline(DATA_PORT, 0b11111111);
+
+        if (LOC_U8Busy)
+        {
+            HLCD_U8BusyFlagAvailable = 0;
+            _delay_ms(2);
+        }
+    }
+}
+#endif
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDTransfer
+ * Description: Drives one write transaction on the LCD bus without any waiting.
+ * Parameters:
+ *      - Copy_U8RegisterSelect: 0 for an instruction, 1 for DDRAM or CGRAM data.
+ *      - Copy_U8Value: The byte to write.
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDTransfer(u8 Copy_U8RegisterSelect, u8 Copy_U8Value)
+{
+    /* RS and RW in one write, EN is raised separately to respect the address setup time */
+    MDIO_VOIDWritePortMaskedInline(CONTROL_PORT, (1 << RS_PIN) | (1 << RW_PIN), (Copy_U8RegisterSelect & 1) << RS_PIN);
+    MDIO_VOIDSetPortValueInline(DATA_PORT, Copy_U8Value);
+
+    MDIO_VOIDSetPinValueInline(CONTROL_PORT, EN_PIN, 1);
+    _delay_us(1);
+    MDIO_VOIDSetPinValueInline(CONTROL_PORT, EN_PIN, 0);
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDWriteNow
+ * Description: Performs one write transaction and waits as set by HLCD_WAIT_MODE.
+ * Parameters:
+ *      - Copy_U8RegisterSelect: 0 for an instruction, 1 for DDRAM or CGRAM data.
+ *      - Copy_U8Value: The byte to write.
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDWriteNow(u8 Copy_U8RegisterSelect, u8 Copy_U8Value)
+{
+#if HLCD_WAIT_MODE == HLCD_WAIT_BUSY_FLAG
+    HLCD_VOIDWaitWhileBusy();
+#endif
+
+    HLCD_VOIDTransfer(Copy_U8RegisterSelect, Copy_U8Value);
+
+#if HLCD_WAIT_MODE == HLCD_WAIT_BUSY_FLAG
+    if (!HLCD_U8BusyFlagAvailable)
+    {
+        _delay_ms(2);
+    }
+#else
+    _delay_ms(2);
+#endif
+}
+
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+/* Ring buffer of pending transactions, one register select bit per slot */
+static u8 HLCD_AU8QueueValue[HLCD_QUEUE_SIZE];
+static u8 HLCD_AU8QueueSelect[HLCD_QUEUE_SIZE / 8];
+
+/* Head is only written by the producer, tail and wait only by the interrupt */
+static volatile u8 HLCD_U8QueueHead, HLCD_U8QueueTail, HLCD_U8QueueWait;
+
+/* Set by the producer when it starts the tick, cleared by the tick when it stops */
+static volatile u8 HLCD_U8QueueRunning;
+
+static u16 HLCD_U16DroppedCount;
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDEnqueue
+ * Description: Adds a transaction to the write queue and makes sure the queue tick
+ *              is running. A stopped tick is restarted from a full period, so the
+ *              first two transactions cannot land closer than one tick apart. A full
+ *              queue is handled as set by HLCD_QUEUE_FULL_POLICY.
+ * Parameters:
+ *      - Copy_U8RegisterSelect: 0 for an instruction, 1 for DDRAM or CGRAM data.
+ *      - Copy_U8Value: The byte to write.
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDEnqueue(u8 Copy_U8RegisterSelect, u8 Copy_U8Value)
+{
+    u8 LOC_U8Head = HLCD_U8QueueHead;
+    u8 LOC_U8Next = (LOC_U8Head + 1) & (HLCD_QUEUE_SIZE - 1);
+
+#if HLCD_QUEUE_FULL_POLICY == HLCD_QUEUE_FULL_BLOCK
+    while (LOC_U8Next == HLCD_U8QueueTail)
+    {
+        /* Wait for the interrupt to free a slot, the host has to move its clock */
+        MBACKEND_VOIDIdle();
+    }
+#else
+    if (LOC_U8Next == HLCD_U8QueueTail)
+    {
+        if (HLCD_U16DroppedCount != 0xFFFF)
+        {
+            HLCD_U16DroppedCount++;
+        }
+    }
+    else
+#endif
+    {
+        HLCD_AU8QueueValue[LOC_U8Head] = Copy_U8Value;
+        if (Copy_U8RegisterSelect)
+        {
+            SET_BIT(HLCD_AU8QueueSelect[LOC_U8Head >> 3], (LOC_U8Head & 7));
+        }
+        else
+        {
+            CLR_BIT(HLCD_AU8QueueSelect[LOC_U8Head >> 3], (LOC_U8Head & 7));
+        }
+
+        /* Publish the slot only once it is complete, and counted */
+        MPROFILE_LATENCY_ENQUEUED();
+        HLCD_U8QueueHead = LOC_U8Next;
+
+        /* The tick cannot run while it is stopped, so this needs no lock */
+        if (!HLCD_U8QueueRunning)
+        {
+            HLCD_U8QueueRunning = 1;
+            MTIMER_VOIDTimer0Restart();
+            MTIMER_VOIDTimer0EnableInterrupt();
+        }
+    }
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDQueueTick
+ * Description: Timer 0 callback performing at most one queued transaction per tick.
+ *              The timer restarts right after each transfer, so a tick delayed by
+ *              another interrupt still leaves a full period before the next one.
+ *              Clear Display and Return Home are followed by HLCD_QUEUE_LONG_TICKS
+ *              idle ticks. The interrupt turns itself off once the queue is empty.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDQueueTick(void)
+{
+    u8 LOC_U8Tail = HLCD_U8QueueTail;
+    u8 LOC_U8RegisterSelect, LOC_U8Value;
+
+    if (HLCD_U8QueueWait)
+    {
+        HLCD_U8QueueWait--;
+    }
+    else if (LOC_U8Tail != HLCD_U8QueueHead)
+    {
+        LOC_U8RegisterSelect = GET_BIT(HLCD_AU8QueueSelect[LOC_U8Tail >> 3], (LOC_U8Tail & 7));
+        LOC_U8Value = HLCD_AU8QueueValue[LOC_U8Tail];
+
+        HLCD_VOIDTransfer(LOC_U8RegisterSelect, LOC_U8Value);
+        MTIMER_VOIDTimer0Restart();
+        if (0 == LOC_U8RegisterSelect && LOC_U8Value <= 3)
+        {
+            HLCD_U8QueueWait = HLCD_QUEUE_LONG_TICKS;
+        }
+
+        HLCD_U8QueueTail = (LOC_U8Tail + 1) & (HLCD_QUEUE_SIZE - 1);
+        MPROFILE_LATENCY_WRITTEN();
+    }
+    else
+    {
+        MTIMER_VOIDTimer0DisableInterrupt();
+        HLCD_U8QueueRunning = 0;
+    }
+}
+#endif
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDWriteData
+ * Description: Writes a data byte to DDRAM or CGRAM, through the write queue when it
+ *              is enabled.
+ * Parameters:
+ *      - Copy_U8Data: The byte written to DDRAM or CGRAM.
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDWriteData(u8 Copy_U8Data)
+{
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+    HLCD_VOIDEnqueue(1, Copy_U8Data);
+#else
+    HLCD_VOIDWriteNow(1, Copy_U8Data);
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDWriteCommand
+ * Description: Writes an instruction, through the write queue when it is enabled.
+ * Parameters:
+ *      - Copy_U8Command: The command to be sent.
+ * Return: None
+ ************************************************************************************/
+static void HLCD_VOIDWriteCommand(u8 Copy_U8Command)
+{
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+    HLCD_VOIDEnqueue(0, Copy_U8Command);
+#else
+    HLCD_VOIDWriteNow(0, Copy_U8Command);
+#endif
+}
+
+#if HLCD_FRAMEBUFFER == 1
+/* Shadow of the DDRAM, one bit per cell in HLCD_AU8Dirty marks cells not yet sent */
+static u8 HLCD_AU8Shadow[2][40];
+static u8 HLCD_AU8Dirty[2][5];
+
+/* Cursor in the shadow, DDRAM address counter of the controller (0xFF if unknown) */
+static u8 HLCD_U8CursorRow, HLCD_U8CursorColumn, HLCD_U8DeviceAddress;
+
+/* Number of columns the display is shifted to the left, 0 to 39 */
+static u8 HLCD_U8DisplayShift;
+
+/************************************************************************************
+ * Function Name: HLCD_U8NextAddress
+ * Description: Returns the DDRAM address the controller moves to after a data write,
+ *              which continues from the end of one line to the start of the other.
+ * Parameters:
+ *      - Copy_U8Address: The DDRAM address just written.
+ * Return: The following DDRAM address
+ ************************************************************************************/
+static u8 HLCD_U8NextAddress(u8 Copy_U8Address)
+{
+    u8 LOC_U8Next = Copy_U8Address + 1;
+    if (Copy_U8Address == 0x27)
+    {
+        LOC_U8Next = 0x40;
+    }
+    else if (Copy_U8Address == 0x67)
+    {
+        LOC_U8Next = 0x00;
+    }
+    return LOC_U8Next;
+}
+#endif
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDSendCharacter
+ * Description: Sends a character to the LCD for display. With the frame buffer enabled
+ *              only the shadow is updated and the character is sent by HLCD_VOIDFlush.
+ * Parameters:
+ *      - Copy_U8Data: The character to be displayed.
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDSendCharacter(u8 Copy_U8Data)
+{
+    MPROFILE_ENTER(MPROFILE_SEND_CHARACTER);
+
+#if HLCD_FRAMEBUFFER == 1
+    if (HLCD_AU8Shadow[HLCD_U8CursorRow][HLCD_U8CursorColumn] != Copy_U8Data)
+    {
+        HLCD_AU8Shadow[HLCD_U8CursorRow][HLCD_U8CursorColumn] = Copy_U8Data;
+        SET_BIT(HLCD_AU8Dirty[HLCD_U8CursorRow][HLCD_U8CursorColumn >> 3], (HLCD_U8CursorColumn & 7));
+    }
+
+    /* Advance like the controller's address counter */
+    HLCD_U8CursorColumn++;
+    if (HLCD_U8CursorColumn == 40)
+    {
+        HLCD_U8CursorColumn = 0;
+        HLCD_U8CursorRow ^= 1;
+    }
+#else
+    HLCD_VOIDWriteData(Copy_U8Data);
+#endif
+
+    MPROFILE_EXIT(MPROFILE_SEND_CHARACTER);
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDSendCommand
+ * Description: Sends a command to the LCD for configuration.
+ * Parameters:
+ *      - Copy_U8Command: The command to be sent.
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDSendCommand(u8 Copy_U8Command)
+{
+    HLCD_VOIDWriteCommand(Copy_U8Command);
+
+#if HLCD_FRAMEBUFFER == 1
+    /* The command may have moved the address counter */
+    HLCD_U8DeviceAddress = 0xFF;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDFlush
+ * Description: Sends the cells of the shadow that changed since the last flush. A run
+ *              of adjacent changed cells costs one Set DDRAM Address command followed by
+ *              its data writes, relying on the controller's auto-increment, and the
+ *              address command is skipped when the counter is already in place. Does
+ *              nothing when the frame buffer is disabled.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDFlush(void)
+{
+#if HLCD_FRAMEBUFFER == 1
+    u8 LOC_U8Row, LOC_U8Byte, LOC_U8Column, LOC_U8Address;
+
+    for (LOC_U8Row = 0; LOC_U8Row < 2; LOC_U8Row++)
+    {
+        for (LOC_U8Byte = 0; LOC_U8Byte < 5; LOC_U8Byte++)
+        {
+            /* Skip 8 clean cells at once */
+            if (0 == HLCD_AU8Dirty[LOC_U8Row][LOC_U8Byte])
+            {
+                continue;
+            }
+            for (LOC_U8Column = LOC_U8Byte << 3; LOC_U8Column < (LOC_U8Byte << 3) + 8; LOC_U8Column++)
+            {
+                if (GET_BIT(HLCD_AU8Dirty[LOC_U8Row][LOC_U8Byte], (LOC_U8Column & 7)))
+                {
+                    LOC_U8Address = (LOC_U8Row << 6) + LOC_U8Column;
+                    if (LOC_U8Address != HLCD_U8DeviceAddress)
+                    {
+                        HLCD_VOIDWriteCommand(128 + LOC_U8Address);
+                    }
+                    HLCD_VOIDWriteData(HLCD_AU8Shadow[LOC_U8Row][LOC_U8Column]);
+                    HLCD_U8DeviceAddress = HLCD_U8NextAddress(LOC_U8Address);
+                }
+            }
+            HLCD_AU8Dirty[LOC_U8Row][LOC_U8Byte] = 0;
+        }
+    }
+
+    /* Leave the visible cursor where the next character goes */
+    LOC_U8Address = (HLCD_U8CursorRow << 6) + HLCD_U8CursorColumn;
+    if (LOC_U8Address != HLCD_U8DeviceAddress)
+    {
+        HLCD_VOIDWriteCommand(128 + LOC_U8Address);
+        HLCD_U8DeviceAddress = LOC_U8Address;
+    }
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_U8IsIdle
+ * Description: Checks whether every queued transaction has reached the LCD. Always
+ *              true when HLCD_WRITE_MODE is HLCD_WRITE_BLOCKING.
+ * Parameters: None
+ * Return:
+ *      - u8: 1 if the write queue has drained, 0 otherwise.
+ ************************************************************************************/
+u8 HLCD_U8IsIdle(void)
+{
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+    return (HLCD_U8QueueHead == HLCD_U8QueueTail) && (0 == HLCD_U8QueueWait);
+#else
+    return 1;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_U16GetDroppedCount
+ * Description: Returns how many transactions were discarded because the write queue
+ *              was full (only with HLCD_QUEUE_FULL_DROP).
+ * Parameters: None
+ * Return:
+ *      - u16: Number of dropped transactions, saturating at 65535.
+ ************************************************************************************/
+u16 HLCD_U16GetDroppedCount(void)
+{
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+    return HLCD_U16DroppedCount;
+#else
+    return 0;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDInitialization
+ * Description: Initializes the LCD by configuring the required pins and sending
+ *              initialization commands.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDInitialization(void)
+{
+    MDIO_VOIDSetPortDirectionInline(DATA_PORT, 0b11111111);
+    MDIO_VOIDSetPinDirectionInline(CONTROL_PORT, RS_PIN, 1);
+    MDIO_VOIDSetPinDirectionInline(CONTROL_PORT, RW_PIN, 1);
+    MDIO_VOIDSetPinDirectionInline(CONTROL_PORT, EN_PIN, 1);
+
+    /* The power-on sequence is always performed synchronously */
+    _delay_ms(40);
+    HLCD_VOIDWriteNow(0, 0b00111000); /* Function Set */
+    _delay_ms(1);
+    HLCD_VOIDWriteNow(0, 0b00001111); /* Display ON */
+    _delay_ms(1);
+    HLCD_VOIDWriteNow(0, 0b00000001); /* Clear Display */
+    _delay_ms(5);
+    HLCD_VOIDWriteNow(0, 0b00000110); /* Entry Mode Set */
+
+#if HLCD_WRITE_MODE == HLCD_WRITE_QUEUED
+    /* The queue tick interrupt is enabled on demand by HLCD_VOIDEnqueue */
+    MTIMER_VOIDTimer0SetCallback(HLCD_VOIDQueueTick);
+    MTIMER_VOIDTimer0Init(HLCD_QUEUE_TICK_COMPARE);
+    MGIE_VOIDEnable();
+#endif
+
+#if HLCD_FRAMEBUFFER == 1
+    /* The controller now holds blanks with the address counter at 0 */
+    for (u8 LOC_U8Column = 0; LOC_U8Column < 40; LOC_U8Column++)
+    {
+        HLCD_AU8Shadow[0][LOC_U8Column] = ' ';
+        HLCD_AU8Shadow[1][LOC_U8Column] = ' ';
+    }
+    HLCD_U8CursorRow = 0;
+    HLCD_U8CursorColumn = 0;
+    HLCD_U8DeviceAddress = 0;
+    HLCD_U8DisplayShift = 0;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDSendNumber
+ * Description: Displays a numerical value on the LCD.
+ * Parameters:
+ *      - Copy_U32Number: The number to be displayed.
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDSendNumber(u32 Copy_U32Number)
+{
+    u8 LOC_U8Digits[NUM_FMT_U32_BUFFER_SIZE];
+
+    NUM_FMT_U8U32ToAscii(Copy_U32Number, LOC_U8Digits);
+    HLCD_VOIDSendString(LOC_U8Digits);
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDSetPosition
+ * Description: Sets the cursor position on the LCD.
+ * Parameters:
+ *      - Copy_U8Row: The row number (0 or 1).
+ *      - Copy_U8Column: The column number (0 to 15).
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDSetPosition(u8 Copy_U8Row, u8 Copy_U8Column)
+{
+#if HLCD_FRAMEBUFFER == 1
+    if (Copy_U8Row < 2 && Copy_U8Column < 40)
+    {
+        HLCD_U8CursorRow = Copy_U8Row;
+        HLCD_U8CursorColumn = Copy_U8Column;
+    }
+#else
+    if (Copy_U8Row == 0)
+    {
+        HLCD_VOIDSendCommand(128 + Copy_U8Column);
+    }
+    else if (Copy_U8Row == 1)
+    {
+        HLCD_VOIDSendCommand(128 + 64 + Copy_U8Column);
+    }
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDDrawPattern
+ * Description: Draws predefined custom patterns on the LCD.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDDrawPattern(void)
+{
+    /* Set CGRAM Address */
+    HLCD_VOIDSendCommand(0b01000000);
+
+    /* Pattern 1: Heart */
+    HLCD_VOIDWriteData(0b00000000);
+    HLCD_VOIDWriteData(0b00000000);
+    HLCD_VOIDWriteData(0b00001010);
+    HLCD_VOIDWriteData(0b00011111);
+    HLCD_VOIDWriteData(0b00001110);
+    HLCD_VOIDWriteData(0b00000100);
+    HLCD_VOIDWriteData(0b00000000);
+    HLCD_VOIDWriteData(0b00000000);
+
+    /* Additional patterns omitted for brevity */
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDSendString
+ * Description: Displays a string on the LCD.
+ * Parameters:
+ *      - Copy_U8String[]: The string to be displayed.
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDSendString(u8 Copy_U8String[])
+{
+    u8 LOC_U8Character, LOC_U8Iterator = 0;
+    while (Copy_U8String[LOC_U8Iterator]) 
+    {
+        LOC_U8Character = Copy_U8String[LOC_U8Iterator];
+        HLCD_VOIDSendCharacter(LOC_U8Character);
+        LOC_U8Iterator++;
+    }
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDShiftCursorRight
+ * Description: Shifts the cursor one position to the right.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDShiftCursorRight(void)
+{
+#if HLCD_FRAMEBUFFER == 1
+    HLCD_U8CursorColumn = (HLCD_U8CursorColumn == 39) ? 0 : HLCD_U8CursorColumn + 1;
+#else
+    HLCD_VOIDSendCommand(0b00010100);
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDShiftCursorLeft
+ * Description: Shifts the cursor one position to the left.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void HLCD_VOIDShiftCursorLeft(void)
+{
+#if HLCD_FRAMEBUFFER == 1
+    HLCD_U8CursorColumn = (HLCD_U8CursorColumn == 0) ? 39 : HLCD_U8CursorColumn - 1;
+#else
+    HLCD_VOIDSendCommand(0b00010000);
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDShiftDisplayRight
+ * Description: This function shifts the entire display to the right by a
+ * 				specified number of positions.
+ * Parameters: u8 Copy_U8Shift - value of shift positions
+ * Return: None
+ ************************************************************************************/
+
+void HLCD_VOIDShiftDisplayRight(u8 Copy_U8Shift)
+{
+    for (u8 LOC_U8Index = 0; LOC_U8Index < Copy_U8Shift; LOC_U8Index++)
+    {
+        HLCD_VOIDWriteCommand(0b00011100); /* Shift display to the right */
+    }
+
+#if HLCD_FRAMEBUFFER == 1
+    HLCD_U8DisplayShift = (HLCD_U8DisplayShift + 40 - (Copy_U8Shift % 40)) % 40;
+#endif
+}
+
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDShiftDisplayLeft
+ * Description: This function shifts the entire display to the left by a
+ * 				specified number of positions.
+ * Parameters: u8 Copy_U8Shift - value of shift positions
+ * Return: None
+ ************************************************************************************/
+
+void HLCD_VOIDShiftDisplayLeft(u8 Copy_U8Shift)
+{
+    for (u8 LOC_U8Index = 0; LOC_U8Index < Copy_U8Shift; LOC_U8Index++)
+    {
+        HLCD_VOIDWriteCommand(0b00011000); /* Shift display to the left */
+    }
+
+#if HLCD_FRAMEBUFFER == 1
+    HLCD_U8DisplayShift = (HLCD_U8DisplayShift + (Copy_U8Shift % 40)) % 40;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDDeleteCharacter
+ * Description: This function deletes a character at a specific index by
+ * 				overwriting it with a space. The position is reset after deleting the character.
+ * Parameters: u8 Copy_U8Index - index of deleted character
+ * Return: None
+ ************************************************************************************/
+
+void HLCD_VOIDDeleteCharacter(u8 Copy_U8Index)
+{
+    if (Copy_U8Index > 0 && Copy_U8Index < 40)
+    {
+        HLCD_VOIDSetPosition(0, Copy_U8Index); /* Set the cursor to the given position */
+        HLCD_VOIDSendCharacter(0b10000001); /* Send a blank character to delete the current character */
+        HLCD_VOIDSetPosition(0, Copy_U8Index); /* Reset the position after deletion */
+    }
+    else
+    {
+        HLCD_VOIDSetPosition(0, 0); /* If index is invalid, reset to the start of the line */
+        HLCD_VOIDSendCharacter(0b10000001); /* Send a blank character to delete */
+        HLCD_VOIDSetPosition(0, 0); /* Reset position */
+    }
+}
+
+/*
+ * HLCD_VOIDClearDisplay function:
+ * This function clears the entire LCD display by sending the clear display command.
+ */
+
+
+/************************************************************************************
+ * Function Name: HLCD_VOIDClearDisplay
+ * Description: This function clears the entire LCD display by sending the clear
+ * 				display command.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+
+void HLCD_VOIDClearDisplay (void)
+{
+#if HLCD_FRAMEBUFFER == 1
+    /* Blank the shadow instead of paying for the 1.52 ms Clear Display instruction */
+    for (u8 LOC_U8Row = 0; LOC_U8Row < 2; LOC_U8Row++)
+    {
+        for (u8 LOC_U8Column = 0; LOC_U8Column < 40; LOC_U8Column++)
+        {
+            if (HLCD_AU8Shadow[LOC_U8Row][LOC_U8Column] != ' ')
+            {
+                HLCD_AU8Shadow[LOC_U8Row][LOC_U8Column] = ' ';
+                SET_BIT(HLCD_AU8Dirty[LOC_U8Row][LOC_U8Column >> 3], (LOC_U8Column & 7));
+            }
+        }
+    }
+    HLCD_U8CursorRow = 0;
+    HLCD_U8CursorColumn = 0;
+
+    /* Clear Display also undoes any display shift, take the shorter way back */
+    if (HLCD_U8DisplayShift > 20)
+    {
+        HLCD_VOIDShiftDisplayLeft(40 - HLCD_U8DisplayShift);
+    }
+    else
+    {
+        HLCD_VOIDShiftDisplayRight(HLCD_U8DisplayShift);
+    }
+#else
+    HLCD_VOIDSendCommand(0b00000001); /* Send command to clear display */
+#endif
+}
+
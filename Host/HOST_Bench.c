@@ -0,0 +1,1871 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Bench.c
+ *
+ * Description: Benchmark of the calculator evaluation on the host. Generates
+ *              a reproducible corpus of valid expressions, times
+ *              Calculator_VOIDCalculation on each of them and the phases of
+ *              both engines separately, writes the results as JSON and
+ *              compares them against a stored baseline. The legacy engine is
+ *              only timed on the expressions it evaluates correctly. Each
+ *              operator of the numeric tower is also timed on operands of
+ *              every width, and each fixed-point operator is timed and
+ *              checked bit for bit against a 64-bit reference. The rational
+ *              operators are timed and checked the same way, next to the
+ *              truncating s32 operators they replace. Powers by squaring are
+ *              timed against the multiplication loop of the legacy engine for
+ *              small and large exponents, and checked with the modular powers
+ *              against 128-bit arithmetic. The NUM_CORDIC functions are timed
+ *              and checked against the double functions of the C library.
+ *              NUM_FMT_U8S32ToAscii is timed on numbers of every length and
+ *              checked against sprintf across the whole s32 range. Results
+ *              of every length are fed through the streaming calculator to
+ *              check that the line never scrolls when they are loaded back.
+ *              Not part of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "../Application/Calculator_Interface.h"
+
+/* Size of an expression buffer, the legacy engine splices results into it */
+#define HOST_BENCH_BUFFER 96
+
+/* Longest expression the token array of the single-pass engine accepts */
+#define HOST_BENCH_MAX_LENGTH (CALCULATOR_MAX_TOKENS - 1)
+
+/* Timed phases of each engine, in the order they run */
+#define HOST_BENCH_PHASES 4
+
+/* Per-expression metrics: the configured engine as a whole, then every phase */
+#define HOST_BENCH_EXPRESSION_METRICS (1 + 2 * HOST_BENCH_PHASES)
+
+/* Per-operation metrics of the numeric tower, one per operator and width */
+#define HOST_BENCH_TOWER_METRICS (HOST_BENCH_EXPRESSION_METRICS + 4 * NUM_TOWER_WIDTHS)
+
+/* Per-operation metrics of the fixed-point decimals, one per operator */
+#define HOST_BENCH_FIXED_METRICS (HOST_BENCH_TOWER_METRICS + 4)
+
+/* Per-operation metrics of plain s32 and of the fractions, one per operator, then the chains */
+#define HOST_BENCH_RATIONAL_METRICS (HOST_BENCH_FIXED_METRICS + 8)
+#define HOST_BENCH_CHAIN_METRICS (HOST_BENCH_RATIONAL_METRICS + 3)
+
+/* Powers by the loop and by squaring for every exponent size, then the modular powers */
+#define HOST_BENCH_POWER_EXPONENTS 3
+#define HOST_BENCH_POWER_METRICS (HOST_BENCH_CHAIN_METRICS + 3 * HOST_BENCH_POWER_EXPONENTS)
+
+/* The NUM_CORDIC functions, sine and cosine come from one call */
+#define HOST_BENCH_CORDIC_METRICS (HOST_BENCH_POWER_METRICS + 5)
+
+/* The decimal conversion of the results */
+#define HOST_BENCH_METRICS (HOST_BENCH_CORDIC_METRICS + 1)
+
+/* Operand pairs timed for every tower, fixed-point and rational metric */
+#define HOST_BENCH_TOWER_PAIRS 256
+
+/* Terms of each sum timed by the chain metrics, the chains add up to HOST_BENCH_TOWER_PAIRS terms */
+#define HOST_BENCH_CHAIN_TERMS 16
+
+/* Random operand pairs the fixed-point and rational arithmetic are checked on */
+#define HOST_BENCH_FIXED_CHECKS 200000
+
+/* Distance between the s32 values checked against sprintf, a prime so every last digit is hit */
+#define HOST_BENCH_FORMAT_STRIDE 9973
+
+/* Longest run of nines typed for the result check, beyond the 24 digits of the tower */
+#define HOST_BENCH_RESULT_DIGITS 26
+
+/* Expressions of the queue check, each result redraws more cells than HLCD_QUEUE_SIZE */
+#define HOST_BENCH_QUEUE_LINES 2
+
+/* Largest error of a NUM_CORDIC function in units of 2^-16, relative for the exponential */
+#define HOST_BENCH_CORDIC_TOLERANCE 1.0
+
+/************************************************************************************
+ * Description: Shape of the generated expressions and of the run.
+ ************************************************************************************/
+typedef struct
+{
+    u32 Seed;               /* Seed of the generator, the same seed gives the same corpus */
+    u32 Expressions;        /* Expressions in the corpus */
+    u32 Passes;             /* Times the corpus is evaluated, the fastest pass counts */
+    u8 MinOperands;         /* Numbers per expression */
+    u8 MaxOperands;
+    u8 MinDigits;           /* Digits per number */
+    u8 MaxDigits;
+    u8 MaxLength;           /* Characters per expression, '=' excluded */
+    u8 Weights[4];          /* Relative frequency of '+', '-', '*' and '/' */
+    u8 LeadingPercent;      /* Chance of the first number being negated */
+    u8 InnerPercent;        /* Chance of a later number being negated, e.g. "3*-2" */
+} HOST_BenchConfigType;
+
+/* Expressions of the queue check */
+static const char *const HOST_APCharBenchQueueLines[HOST_BENCH_QUEUE_LINES] =
+{
+    "1111111111111111+1111111111111111=",
+    "99999999*99999999*99999999/99999999=",
+};
+
+/* Names of the metrics in the JSON output, in nanoseconds per expression or operation, negative when not measured */
+static const char *const HOST_APCharMetrics[HOST_BENCH_METRICS] =
+{
+    "calculation",
+    "legacy_error_check", "legacy_ordering", "legacy_operation", "legacy_rendering",
+    "single_pass_tokenize", "single_pass_validate", "single_pass_evaluate", "single_pass_rendering",
+    "tower_add_16", "tower_add_32", "tower_add_64", "tower_add_big",
+    "tower_sub_16", "tower_sub_32", "tower_sub_64", "tower_sub_big",
+    "tower_mul_16", "tower_mul_32", "tower_mul_64", "tower_mul_big",
+    "tower_div_16", "tower_div_32", "tower_div_64", "tower_div_big",
+    "fixed_add", "fixed_sub", "fixed_mul", "fixed_div",
+    "s32_add", "s32_sub", "s32_mul", "s32_div",
+    "rational_add", "rational_sub", "rational_mul", "rational_div",
+    "s32_chain", "rational_chain", "rational_chain_eager",
+    "pow_linear_8", "pow_linear_30", "pow_linear_255",
+    "pow_squaring_8", "pow_squaring_30", "pow_squaring_255",
+    "modpow_255", "modpow_65535", "modpow_2147483647",
+    "cordic_sqrt", "cordic_sincos", "cordic_atan", "cordic_exp", "cordic_log",
+    "fmt_s32",
+};
+
+/* Digits of the left operands of each width, the right operand of '*' and '/' is 16-bit */
+static const u8 HOST_AU8TowerDigits[NUM_TOWER_WIDTHS][2] = {{1, 4}, {5, 9}, {10, 18}, {19, 22}};
+
+/* Operands of the tower metrics, by width */
+static NUM_TOWER_Type HOST_AStrTowerLeft[NUM_TOWER_WIDTHS][HOST_BENCH_TOWER_PAIRS];
+static NUM_TOWER_Type HOST_AStrTowerRight[NUM_TOWER_WIDTHS][HOST_BENCH_TOWER_PAIRS];
+static NUM_TOWER_Type HOST_AStrTowerSmall[HOST_BENCH_TOWER_PAIRS];
+
+/* Operands of the fixed-point metrics, below 1000000 units so no product overflows */
+static NUM_FIXED_Type HOST_AFixedLeft[HOST_BENCH_TOWER_PAIRS];
+static NUM_FIXED_Type HOST_AFixedRight[HOST_BENCH_TOWER_PAIRS];
+
+/* Operands of the s32 and rational metrics, fractions of three digits over three digits */
+static s32 HOST_AS32Left[HOST_BENCH_TOWER_PAIRS];
+static s32 HOST_AS32Right[HOST_BENCH_TOWER_PAIRS];
+static NUM_RATIONAL_Type HOST_ARationalLeft[HOST_BENCH_TOWER_PAIRS];
+static NUM_RATIONAL_Type HOST_ARationalRight[HOST_BENCH_TOWER_PAIRS];
+
+/* Terms of the chain metrics, as typed: a one-digit numerator over 1 to 12 */
+static s32 HOST_AS32ChainNumerators[HOST_BENCH_TOWER_PAIRS];
+static s32 HOST_AS32ChainDenominators[HOST_BENCH_TOWER_PAIRS];
+
+/* Exponents of the power metrics, the largest is the largest the loop accepts */
+static const u8 HOST_AU8PowerExponents[HOST_BENCH_POWER_EXPONENTS] = {8, 30, 255};
+
+/* Moduli of the modular power metrics */
+static const u32 HOST_AU32PowerModuli[HOST_BENCH_POWER_EXPONENTS] = {255UL, 65535UL, NUM_POW_MODULUS_MAX};
+
+/* Bases of the power metrics by exponent, so that every power fits 32 bits: 2 to 9, then +-2, then +-1 */
+static s32 HOST_AS32PowerBases[HOST_BENCH_POWER_EXPONENTS][HOST_BENCH_TOWER_PAIRS];
+
+/* Bases and exponents of the modular power metrics, any 32-bit number */
+static u32 HOST_AU32ModBases[HOST_BENCH_TOWER_PAIRS];
+static u32 HOST_AU32ModExponents[HOST_BENCH_TOWER_PAIRS];
+
+/* Results of the unsigned power metrics, kept here so the compiler cannot drop them */
+static u32 HOST_AU32PowerResults[HOST_BENCH_TOWER_PAIRS];
+
+/* Arguments of the NUM_CORDIC metrics with 16 fraction bits: any s32, exponents whose
+ * power fits, and numbers above zero */
+static s32 HOST_AS32CordicArguments[HOST_BENCH_TOWER_PAIRS];
+static s32 HOST_AS32CordicExponents[HOST_BENCH_TOWER_PAIRS];
+static s32 HOST_AS32CordicPositives[HOST_BENCH_TOWER_PAIRS];
+
+/* Results of the NUM_CORDIC metrics, kept here so the compiler cannot drop them */
+static s32 HOST_AS32CordicResults[HOST_BENCH_TOWER_PAIRS];
+
+/* Numbers of every length the conversion metric formats, then its text and total length
+ * kept here so the compiler cannot drop them */
+static s32 HOST_AS32FormatValues[HOST_BENCH_TOWER_PAIRS];
+static u8 HOST_AU8FormatText[NUM_FMT_S32_BUFFER_SIZE];
+static u32 HOST_U32FormatLength;
+
+static const u8 HOST_AU8Operators[4] = {'+', '-', '*', '/'};
+
+/* State of the xorshift generator, kept here so runs do not depend on the C library */
+static u32 HOST_U32BenchState;
+
+/* Cost of reading the clock, subtracted from every measurement */
+static u64 HOST_U64ClockOverhead;
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchRandom
+ * Description: Returns the next number of the xorshift32 generator.
+ * Parameters: None
+ * Return:
+ *      - u32: Pseudo-random number, never 0.
+ ******************************************************************************/
+static u32 HOST_U32BenchRandom(void)
+{
+    HOST_U32BenchState ^= HOST_U32BenchState << 13;
+    HOST_U32BenchState ^= HOST_U32BenchState >> 17;
+    HOST_U32BenchState ^= HOST_U32BenchState << 5;
+    return HOST_U32BenchState;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchBetween
+ * Description: Returns a pseudo-random number in a closed range.
+ * Parameters:
+ *      - Copy_U8Min: Lowest value
+ *      - Copy_U8Max: Highest value, not below Copy_U8Min
+ * Return:
+ *      - u8: The number.
+ ******************************************************************************/
+static u8 HOST_U8BenchBetween(u8 Copy_U8Min, u8 Copy_U8Max)
+{
+    return Copy_U8Min + HOST_U32BenchRandom() % (Copy_U8Max - Copy_U8Min + 1);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchGenerate
+ * Description: Writes one valid expression as "!<expression>=". Numbers never
+ *              start with 0, so no division by zero can occur, and a number is
+ *              dropped rather than cut when it would exceed the maximum length.
+ * Parameters:
+ *      - Copy_PStrConfig: Shape of the expression
+ *      - Copy_PU8Expression: Buffer of at least HOST_BENCH_BUFFER bytes
+ * Return:
+ *      - u8: Number of operands in the expression.
+ ******************************************************************************/
+static u8 HOST_U8BenchGenerate(const HOST_BenchConfigType *Copy_PStrConfig, u8 *Copy_PU8Expression)
+{
+    u8 LOC_U8Operands = HOST_U8BenchBetween(Copy_PStrConfig->MinOperands, Copy_PStrConfig->MaxOperands);
+    u8 LOC_U8WeightSum = Copy_PStrConfig->Weights[0] + Copy_PStrConfig->Weights[1]
+                       + Copy_PStrConfig->Weights[2] + Copy_PStrConfig->Weights[3];
+    u8 LOC_U8Length = 1, LOC_U8Written, LOC_U8Digit;
+
+    Copy_PU8Expression[0] = '!';
+    for (LOC_U8Written = 0; LOC_U8Written < LOC_U8Operands; LOC_U8Written++)
+    {
+        u8 LOC_U8Digits = HOST_U8BenchBetween(Copy_PStrConfig->MinDigits, Copy_PStrConfig->MaxDigits);
+        u8 LOC_U8Negative = (HOST_U32BenchRandom() % 100)
+                          < (LOC_U8Written ? Copy_PStrConfig->InnerPercent : Copy_PStrConfig->LeadingPercent);
+        u8 LOC_U8Operator = 0;
+
+        if (LOC_U8Written > 0)
+        {
+            u8 LOC_U8Pick = HOST_U32BenchRandom() % LOC_U8WeightSum;
+
+            while (LOC_U8Pick >= Copy_PStrConfig->Weights[LOC_U8Operator])
+            {
+                LOC_U8Pick -= Copy_PStrConfig->Weights[LOC_U8Operator];
+                LOC_U8Operator++;
+            }
+        }
+
+        /* Stop at the length limit, the first number always fits */
+        if (LOC_U8Written > 0 && LOC_U8Length + LOC_U8Negative + LOC_U8Digits > Copy_PStrConfig->MaxLength)
+        {
+            break;
+        }
+
+        if (LOC_U8Written > 0)
+        {
+            Copy_PU8Expression[LOC_U8Length++] = HOST_AU8Operators[LOC_U8Operator];
+        }
+        if (LOC_U8Negative)
+        {
+            Copy_PU8Expression[LOC_U8Length++] = '-';
+        }
+        for (LOC_U8Digit = 0; LOC_U8Digit < LOC_U8Digits; LOC_U8Digit++)
+        {
+            Copy_PU8Expression[LOC_U8Length++] = (0 == LOC_U8Digit) ? '1' + HOST_U32BenchRandom() % 9
+                                                                    : '0' + HOST_U32BenchRandom() % 10;
+        }
+    }
+    Copy_PU8Expression[LOC_U8Length++] = '=';
+    Copy_PU8Expression[LOC_U8Length] = '\0';
+
+    return LOC_U8Written;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchTowerOperand
+ * Description: Draws a random number of a given width, digit by digit.
+ * Parameters:
+ *      - Copy_PStrNumber: Receives the number
+ *      - Copy_U8Width: Width it must have, NUM_TOWER_WIDTH_16 to NUM_TOWER_WIDTH_BIG
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchTowerOperand(NUM_TOWER_Type *Copy_PStrNumber, u8 Copy_U8Width)
+{
+    do
+    {
+        u8 LOC_U8Digits = HOST_U8BenchBetween(HOST_AU8TowerDigits[Copy_U8Width][0], HOST_AU8TowerDigits[Copy_U8Width][1]);
+
+        NUM_TOWER_VOIDFromS32(Copy_PStrNumber, 1 + HOST_U32BenchRandom() % 9);
+        while (--LOC_U8Digits)
+        {
+            NUM_TOWER_U8AppendDigit(Copy_PStrNumber, HOST_U32BenchRandom() % 10);
+        }
+        if (HOST_U32BenchRandom() & 1)
+        {
+            NUM_TOWER_VOIDNegate(Copy_PStrNumber);
+        }
+    } while (Copy_PStrNumber->Width != Copy_U8Width);
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchTowerGenerate
+ * Description: Draws the operands of the tower metrics. '+' and '-' take two
+ *              operands of the same width, '*' and '/' a 16-bit right operand
+ *              so that the products of big numbers stay within their capacity.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchTowerGenerate(void)
+{
+    u32 LOC_U32Index;
+    u8 LOC_U8Width;
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        for (LOC_U8Width = 0; LOC_U8Width < NUM_TOWER_WIDTHS; LOC_U8Width++)
+        {
+            HOST_VOIDBenchTowerOperand(&HOST_AStrTowerLeft[LOC_U8Width][LOC_U32Index], LOC_U8Width);
+            HOST_VOIDBenchTowerOperand(&HOST_AStrTowerRight[LOC_U8Width][LOC_U32Index], LOC_U8Width);
+        }
+        HOST_VOIDBenchTowerOperand(&HOST_AStrTowerSmall[LOC_U32Index], NUM_TOWER_WIDTH_16);
+        HOST_AFixedLeft[LOC_U32Index] = (NUM_FIXED_Type)(HOST_U32BenchRandom() % 1999999) - 999999;
+        HOST_AFixedRight[LOC_U32Index] = (NUM_FIXED_Type)(1 + HOST_U32BenchRandom() % 999999);
+        HOST_AS32Left[LOC_U32Index] = (s32)(HOST_U32BenchRandom() % 1999999) - 999999;
+        HOST_AS32Right[LOC_U32Index] = (s32)(1 + HOST_U32BenchRandom() % 999);
+        HOST_ARationalLeft[LOC_U32Index].Numerator = (s32)(HOST_U32BenchRandom() % 1999) - 999;
+        HOST_ARationalLeft[LOC_U32Index].Denominator = (s32)(1 + HOST_U32BenchRandom() % 999);
+        HOST_ARationalRight[LOC_U32Index].Numerator = (s32)(1 + HOST_U32BenchRandom() % 999);
+        HOST_ARationalRight[LOC_U32Index].Denominator = (s32)(1 + HOST_U32BenchRandom() % 999);
+        HOST_AS32ChainNumerators[LOC_U32Index] = (s32)(1 + HOST_U32BenchRandom() % 9);
+        HOST_AS32ChainDenominators[LOC_U32Index] = (s32)(1 + HOST_U32BenchRandom() % 12);
+        HOST_AS32PowerBases[0][LOC_U32Index] = (s32)(2 + HOST_U32BenchRandom() % 8);
+        HOST_AS32PowerBases[1][LOC_U32Index] = (HOST_U32BenchRandom() & 1) ? -2 : 2;
+        HOST_AS32PowerBases[2][LOC_U32Index] = (HOST_U32BenchRandom() & 1) ? -1 : 1;
+        HOST_AU32ModBases[LOC_U32Index] = HOST_U32BenchRandom();
+        HOST_AU32ModExponents[LOC_U32Index] = HOST_U32BenchRandom();
+        HOST_AS32CordicArguments[LOC_U32Index] = (s32)HOST_U32BenchRandom();
+        HOST_AS32CordicExponents[LOC_U32Index] = (s32)(HOST_U32BenchRandom() % (42UL << 16)) - (21L << 16);
+        HOST_AS32CordicPositives[LOC_U32Index] = (s32)(1 + HOST_U32BenchRandom() % 0x7FFFFFFFUL);
+        HOST_AS32FormatValues[LOC_U32Index] = (s32)HOST_U32BenchRandom() >> (HOST_U32BenchRandom() % 32);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_S32BenchFixedOperand
+ * Description: Draws a fixed-point number of 1 to 10 digits, so that small,
+ *              large and overflowing operations are all checked.
+ * Parameters: None
+ * Return:
+ *      - s32: The number, never the lowest s32.
+ ******************************************************************************/
+static s32 HOST_S32BenchFixedOperand(void)
+{
+    static const u32 LOC_AU32Limits[10] =
+    {
+        10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL, 0x7FFFFFFFUL
+    };
+    u32 LOC_U32Magnitude = HOST_U32BenchRandom() % LOC_AU32Limits[HOST_U32BenchRandom() % 10];
+
+    return (HOST_U32BenchRandom() & 1) ? -(s32)LOC_U32Magnitude : (s32)LOC_U32Magnitude;
+}
+
+/******************************************************************************
+ * Function Name: HOST_S64BenchRound
+ * Description: Reference division rounded half away from zero.
+ * Parameters:
+ *      - Copy_S64Numerator: Dividend
+ *      - Copy_S64Denominator: Divisor, not zero
+ * Return:
+ *      - s64: The rounded quotient.
+ ******************************************************************************/
+static s64 HOST_S64BenchRound(s64 Copy_S64Numerator, s64 Copy_S64Denominator)
+{
+    u64 LOC_U64Numerator = (Copy_S64Numerator < 0) ? 0ULL - (u64)Copy_S64Numerator : (u64)Copy_S64Numerator;
+    u64 LOC_U64Denominator = (Copy_S64Denominator < 0) ? 0ULL - (u64)Copy_S64Denominator : (u64)Copy_S64Denominator;
+    s64 LOC_S64Quotient = (s64)((LOC_U64Numerator + LOC_U64Denominator / 2) / LOC_U64Denominator);
+
+    return ((Copy_S64Numerator < 0) != (Copy_S64Denominator < 0)) ? -LOC_S64Quotient : LOC_S64Quotient;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchFixedCheck
+ * Description: Runs the four operators of NUM_FIXED on random operands and
+ *              compares status and result with the same arithmetic done in
+ *              64 bits, where nothing can overflow. Each operand is also
+ *              written out, compared with printf, parsed back, parsed with an
+ *              extra digit that must round, and typed digit by digit.
+ * Parameters:
+ *      - Copy_U32Cases: Operand pairs to check
+ * Return:
+ *      - u32: Number of mismatches.
+ ******************************************************************************/
+static u32 HOST_U32BenchFixedCheck(u32 Copy_U32Cases)
+{
+    static u8 (*const LOC_APFunctions[4])(NUM_FIXED_Type *, NUM_FIXED_Type, NUM_FIXED_Type) =
+    {
+        NUM_FIXED_U8Add, NUM_FIXED_U8Sub, NUM_FIXED_U8Mul, NUM_FIXED_U8Div
+    };
+    u32 LOC_U32Case, LOC_U32Mismatches = 0;
+    u8 LOC_U8Operator, LOC_U8Index;
+
+    for (LOC_U32Case = 0; LOC_U32Case < Copy_U32Cases; LOC_U32Case++)
+    {
+        s32 LOC_S32Left = HOST_S32BenchFixedOperand(), LOC_S32Right = HOST_S32BenchFixedOperand();
+        u64 LOC_U64Magnitude = (LOC_S32Left < 0) ? 0ULL - (u64)(s64)LOC_S32Left : (u64)LOC_S32Left;
+        char LOC_ACharReference[32];
+        u8 LOC_AU8Text[NUM_FIXED_BUFFER_SIZE];
+        NUM_FIXED_Type LOC_Result, LOC_Typed = 0;
+        u8 LOC_U8State, LOC_U8Expected, LOC_U8Length, LOC_U8Point = 0;
+        s64 LOC_S64Expected;
+
+        for (LOC_U8Operator = 0; LOC_U8Operator < 4; LOC_U8Operator++)
+        {
+            switch (LOC_U8Operator)
+            {
+            case 0: LOC_S64Expected = (s64)LOC_S32Left + LOC_S32Right; break;
+            case 1: LOC_S64Expected = (s64)LOC_S32Left - LOC_S32Right; break;
+            case 2: LOC_S64Expected = HOST_S64BenchRound((s64)LOC_S32Left * LOC_S32Right, NUM_FIXED_SCALE); break;
+            default:
+                LOC_S64Expected = LOC_S32Right ? HOST_S64BenchRound((s64)LOC_S32Left * NUM_FIXED_SCALE, LOC_S32Right) : 0;
+                break;
+            }
+            if (3 == LOC_U8Operator && 0 == LOC_S32Right)
+            {
+                LOC_U8Expected = NUM_FIXED_DIV_ZERO;
+            }
+            else
+            {
+                LOC_U8Expected = (LOC_S64Expected > NUM_FIXED_MAX || LOC_S64Expected < -NUM_FIXED_MAX) ? NUM_FIXED_OVERFLOW : NUM_FIXED_OK;
+            }
+
+            LOC_Result = 0;
+            LOC_U8State = LOC_APFunctions[LOC_U8Operator](&LOC_Result, LOC_S32Left, LOC_S32Right);
+            if (LOC_U8State != LOC_U8Expected || (NUM_FIXED_OK == LOC_U8State && LOC_Result != LOC_S64Expected))
+            {
+                fprintf(stderr, "fixed-point mismatch: %ld %c %ld gives %ld (state %u), expected %lld (state %u)\n",
+                        (long)LOC_S32Left, HOST_AU8Operators[LOC_U8Operator], (long)LOC_S32Right, (long)LOC_Result,
+                        LOC_U8State, (long long)LOC_S64Expected, LOC_U8Expected);
+                LOC_U32Mismatches++;
+            }
+        }
+
+        /* One more digit than kept rounds the last one, half away from zero */
+        LOC_U8Length = (u8)snprintf(LOC_ACharReference, sizeof(LOC_ACharReference), "%s%llu.%0*llu", (LOC_S32Left < 0) ? "-" : "",
+                                    (unsigned long long)(LOC_U64Magnitude / NUM_FIXED_SCALE), NUM_FIXED_FRACTION_DIGITS,
+                                    (unsigned long long)(LOC_U64Magnitude % NUM_FIXED_SCALE));
+        LOC_ACharReference[LOC_U8Length] = (char)('0' + LOC_U32Case % 10);
+        LOC_ACharReference[LOC_U8Length + 1] = '\0';
+        LOC_S64Expected = (s64)LOC_S32Left + ((LOC_U32Case % 10 >= 5) ? ((LOC_S32Left < 0) ? -1 : 1) : 0);
+        LOC_U8Expected = (LOC_S64Expected > NUM_FIXED_MAX || LOC_S64Expected < -NUM_FIXED_MAX) ? NUM_FIXED_OVERFLOW : NUM_FIXED_OK;
+        LOC_Result = 0;
+        LOC_U8State = NUM_FIXED_U8FromAscii((const u8 *)LOC_ACharReference, &LOC_Result);
+        if (LOC_U8State != LOC_U8Expected || (NUM_FIXED_OK == LOC_U8State && LOC_Result != LOC_S64Expected))
+        {
+            fprintf(stderr, "fixed-point mismatch: \"%s\" parsed as %ld (state %u)\n", LOC_ACharReference, (long)LOC_Result, LOC_U8State);
+            LOC_U32Mismatches++;
+        }
+
+        /* Written without the trailing zeros of the fraction nor a bare point, and parsed back */
+        LOC_ACharReference[LOC_U8Length] = '\0';
+        while ('0' == LOC_ACharReference[LOC_U8Length - 1] && NUM_FIXED_FRACTION_DIGITS > 0)
+        {
+            LOC_ACharReference[--LOC_U8Length] = '\0';
+            if ('.' == LOC_ACharReference[LOC_U8Length - 1])
+            {
+                break;
+            }
+        }
+        if ('.' == LOC_ACharReference[LOC_U8Length - 1])
+        {
+            LOC_ACharReference[--LOC_U8Length] = '\0';
+        }
+        if (NUM_FIXED_U8ToAscii(LOC_S32Left, LOC_AU8Text) != LOC_U8Length || 0 != strcmp((char *)LOC_AU8Text, LOC_ACharReference)
+            || NUM_FIXED_OK != NUM_FIXED_U8FromAscii(LOC_AU8Text, &LOC_Result) || LOC_Result != LOC_S32Left)
+        {
+            fprintf(stderr, "fixed-point mismatch: %ld written as \"%s\", expected \"%s\"\n",
+                    (long)LOC_S32Left, (char *)LOC_AU8Text, LOC_ACharReference);
+            LOC_U32Mismatches++;
+        }
+
+        /* Typing the magnitude key by key gives the same number */
+        for (LOC_U8Index = (LOC_S32Left < 0); LOC_AU8Text[LOC_U8Index]; LOC_U8Index++)
+        {
+            if ('.' == LOC_AU8Text[LOC_U8Index])
+            {
+                LOC_U8Point = 1;
+            }
+            else
+            {
+                NUM_FIXED_U8AppendDigit(&LOC_Typed, &LOC_U8Point, LOC_AU8Text[LOC_U8Index] - '0');
+            }
+        }
+        if ((u64)LOC_Typed != LOC_U64Magnitude || LOC_U8Point != NUM_FIXED_U8Point(LOC_S32Left))
+        {
+            fprintf(stderr, "fixed-point mismatch: typing \"%s\" gives %ld\n", (char *)LOC_AU8Text, (long)LOC_Typed);
+            LOC_U32Mismatches++;
+        }
+    }
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_S64BenchGcd
+ * Description: Reference greatest common divisor by Euclid's algorithm.
+ * Parameters:
+ *      - Copy_S64Left: First number
+ *      - Copy_S64Right: Second number
+ * Return:
+ *      - s64: The greatest common divisor, never negative.
+ ******************************************************************************/
+static s64 HOST_S64BenchGcd(s64 Copy_S64Left, s64 Copy_S64Right)
+{
+    s64 LOC_S64Remainder;
+
+    while (0 != Copy_S64Right)
+    {
+        LOC_S64Remainder = Copy_S64Left % Copy_S64Right;
+        Copy_S64Left = Copy_S64Right;
+        Copy_S64Right = LOC_S64Remainder;
+    }
+    return (Copy_S64Left < 0) ? -Copy_S64Left : Copy_S64Left;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchRationalCheck
+ * Description: Runs the four operators of NUM_RATIONAL on random fractions and
+ *              compares the results in lowest terms with the same arithmetic
+ *              done in 64 bits. A product or quotient may only overflow when
+ *              its lowest terms do not fit 32 bits, a sum also when its
+ *              numerator over the least common denominator does not. Every
+ *              result is also written out and compared with printf.
+ * Parameters:
+ *      - Copy_U32Cases: Operand pairs to check
+ * Return:
+ *      - u32: Number of mismatches.
+ ******************************************************************************/
+static u32 HOST_U32BenchRationalCheck(u32 Copy_U32Cases)
+{
+    static u8 (*const LOC_APFunctions[4])(NUM_RATIONAL_Type *, const NUM_RATIONAL_Type *, const NUM_RATIONAL_Type *) =
+    {
+        NUM_RATIONAL_U8Add, NUM_RATIONAL_U8Sub, NUM_RATIONAL_U8Mul, NUM_RATIONAL_U8Div
+    };
+    u32 LOC_U32Case, LOC_U32Mismatches = 0;
+    u8 LOC_U8Operator;
+
+    for (LOC_U32Case = 0; LOC_U32Case < Copy_U32Cases; LOC_U32Case++)
+    {
+        NUM_RATIONAL_Type LOC_Left, LOC_Right, LOC_Result;
+        s64 LOC_S64Numerator, LOC_S64Denominator, LOC_S64Divisor;
+        char LOC_ACharReference[48];
+        u8 LOC_AU8Text[CALCULATOR_RESULT_WIDTH + 1];
+        u8 LOC_U8State, LOC_U8Fits;
+        double LOC_F64Error;
+
+        LOC_Left.Numerator = HOST_S32BenchFixedOperand();
+        LOC_Left.Denominator = HOST_S32BenchFixedOperand();
+        LOC_Right.Numerator = HOST_S32BenchFixedOperand();
+        LOC_Right.Denominator = HOST_S32BenchFixedOperand();
+        LOC_Left.Denominator = (LOC_Left.Denominator < 0) ? -LOC_Left.Denominator : (LOC_Left.Denominator ? LOC_Left.Denominator : 1);
+        LOC_Right.Denominator = (LOC_Right.Denominator < 0) ? -LOC_Right.Denominator : (LOC_Right.Denominator ? LOC_Right.Denominator : 1);
+
+        for (LOC_U8Operator = 0; LOC_U8Operator < 4; LOC_U8Operator++)
+        {
+            switch (LOC_U8Operator)
+            {
+            case 0:
+                LOC_S64Numerator = (s64)LOC_Left.Numerator * LOC_Right.Denominator + (s64)LOC_Right.Numerator * LOC_Left.Denominator;
+                LOC_S64Denominator = (s64)LOC_Left.Denominator * LOC_Right.Denominator;
+                break;
+            case 1:
+                LOC_S64Numerator = (s64)LOC_Left.Numerator * LOC_Right.Denominator - (s64)LOC_Right.Numerator * LOC_Left.Denominator;
+                LOC_S64Denominator = (s64)LOC_Left.Denominator * LOC_Right.Denominator;
+                break;
+            case 2:
+                LOC_S64Numerator = (s64)LOC_Left.Numerator * LOC_Right.Numerator;
+                LOC_S64Denominator = (s64)LOC_Left.Denominator * LOC_Right.Denominator;
+                break;
+            default:
+                LOC_S64Numerator = (s64)LOC_Left.Numerator * LOC_Right.Denominator;
+                LOC_S64Denominator = (s64)LOC_Left.Denominator * LOC_Right.Numerator;
+                break;
+            }
+            if (LOC_S64Denominator < 0)
+            {
+                LOC_S64Numerator = -LOC_S64Numerator;
+                LOC_S64Denominator = -LOC_S64Denominator;
+            }
+            LOC_S64Divisor = HOST_S64BenchGcd(LOC_S64Numerator, LOC_S64Denominator);
+            if (LOC_S64Divisor > 1)
+            {
+                LOC_S64Numerator /= LOC_S64Divisor;
+                LOC_S64Denominator /= LOC_S64Divisor;
+            }
+            LOC_U8Fits = LOC_S64Numerator < 0x7FFFFFFFLL && LOC_S64Numerator > -0x7FFFFFFFLL && LOC_S64Denominator < 0x7FFFFFFFLL;
+
+            LOC_Result.Numerator = 0;
+            LOC_Result.Denominator = 1;
+            LOC_U8State = LOC_APFunctions[LOC_U8Operator](&LOC_Result, &LOC_Left, &LOC_Right);
+            NUM_RATIONAL_VOIDNormalize(&LOC_Result);
+            if (0 == LOC_S64Denominator)
+            {
+                LOC_U8Fits = (NUM_RATIONAL_DIV_ZERO == LOC_U8State);
+            }
+            else if (NUM_RATIONAL_OK == LOC_U8State)
+            {
+                LOC_U8Fits = (LOC_Result.Numerator == LOC_S64Numerator && LOC_Result.Denominator == LOC_S64Denominator);
+            }
+            else
+            {
+                LOC_U8Fits = (NUM_RATIONAL_OVERFLOW == LOC_U8State) && (!LOC_U8Fits || LOC_U8Operator < 2);
+            }
+            if (!LOC_U8Fits)
+            {
+                fprintf(stderr, "rational mismatch: %ld/%ld %c %ld/%ld gives %ld/%ld (state %u), expected %lld/%lld\n",
+                        (long)LOC_Left.Numerator, (long)LOC_Left.Denominator, HOST_AU8Operators[LOC_U8Operator],
+                        (long)LOC_Right.Numerator, (long)LOC_Right.Denominator, (long)LOC_Result.Numerator,
+                        (long)LOC_Result.Denominator, LOC_U8State, (long long)LOC_S64Numerator, (long long)LOC_S64Denominator);
+                LOC_U32Mismatches++;
+            }
+            else if (NUM_RATIONAL_OK == LOC_U8State)
+            {
+                /* Written as an integer or a fraction when it fits the LCD, else as a decimal */
+                snprintf(LOC_ACharReference, sizeof(LOC_ACharReference), (1 == LOC_Result.Denominator) ? "%ld" : "%ld/%ld",
+                         (long)LOC_Result.Numerator, (long)LOC_Result.Denominator);
+                NUM_RATIONAL_U8ToAscii(&LOC_Result, LOC_AU8Text, CALCULATOR_RESULT_WIDTH, NUM_RATIONAL_FRACTION);
+                LOC_F64Error = strtod((char *)LOC_AU8Text, NULL) - (double)LOC_Result.Numerator / LOC_Result.Denominator;
+                if ((strlen(LOC_ACharReference) <= CALCULATOR_RESULT_WIDTH) ? 0 != strcmp((char *)LOC_AU8Text, LOC_ACharReference)
+                    : (NULL == strchr((char *)LOC_AU8Text, '.') || LOC_F64Error > 1e-4 || LOC_F64Error < -1e-4))
+                {
+                    fprintf(stderr, "rational mismatch: %ld/%ld written as \"%s\"\n", (long)LOC_Result.Numerator,
+                            (long)LOC_Result.Denominator, (char *)LOC_AU8Text);
+                    LOC_U32Mismatches++;
+                }
+            }
+        }
+    }
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchPowerCheck
+ * Description: Raises random bases to random exponents with NUM_POW and
+ *              compares the results with the same powers done in 128 bits:
+ *              a power must be exact when it fits 32 bits and an overflow
+ *              otherwise. The modular powers are compared with a 64-bit
+ *              square and multiply on random moduli of every size.
+ * Parameters:
+ *      - Copy_U32Cases: Powers of each kind to check
+ * Return:
+ *      - u32: Number of mismatches.
+ ******************************************************************************/
+static u32 HOST_U32BenchPowerCheck(u32 Copy_U32Cases)
+{
+    u32 LOC_U32Case, LOC_U32Mismatches = 0;
+
+    for (LOC_U32Case = 0; LOC_U32Case < Copy_U32Cases; LOC_U32Case++)
+    {
+        s32 LOC_S32Base = (s32)(HOST_U32BenchRandom() % 2001) - 1000;
+        s32 LOC_S32Exponent = (s32)(HOST_U32BenchRandom() % 40) - 4;
+        s32 LOC_S32Result = 0;
+        __int128 LOC_S128Reference = 1;
+        u8 LOC_U8Expected = NUM_POW_OK, LOC_U8State;
+        s32 LOC_S32Index;
+        u32 LOC_U32Base = HOST_U32BenchRandom(), LOC_U32Exponent = HOST_U32BenchRandom();
+        u32 LOC_U32Modulus = 1 + HOST_U32BenchRandom() % (HOST_U32BenchRandom() % NUM_POW_MODULUS_MAX + 1);
+        u64 LOC_U64Square = LOC_U32Base % LOC_U32Modulus, LOC_U64Reference = 1 % LOC_U32Modulus;
+
+        /* Small bases reach large exponents before overflowing, keep some */
+        if (LOC_U32Case & 1)
+        {
+            LOC_S32Base %= 4;
+        }
+
+        if (LOC_S32Exponent < 0)
+        {
+            if (0 == LOC_S32Base)
+            {
+                LOC_U8Expected = NUM_POW_DIV_ZERO;
+            }
+            LOC_S128Reference = (1 == LOC_S32Base) ? 1 : (-1 == LOC_S32Base) ? ((LOC_S32Exponent & 1) ? -1 : 1) : 0;
+        }
+        for (LOC_S32Index = 0; LOC_S32Index < LOC_S32Exponent && NUM_POW_OK == LOC_U8Expected; LOC_S32Index++)
+        {
+            LOC_S128Reference *= LOC_S32Base;
+            if (LOC_S128Reference > 0x7FFFFFFF || LOC_S128Reference < -(__int128)0x80000000LL)
+            {
+                LOC_U8Expected = NUM_POW_OVERFLOW;
+            }
+        }
+        LOC_U8State = NUM_POW_U8PowerS32(&LOC_S32Result, LOC_S32Base, LOC_S32Exponent);
+        if (LOC_U8State != LOC_U8Expected || (NUM_POW_OK == LOC_U8State && LOC_S32Result != LOC_S128Reference))
+        {
+            fprintf(stderr, "power mismatch: %ld^%ld gives %ld (state %u), expected %lld (state %u)\n", (long)LOC_S32Base,
+                    (long)LOC_S32Exponent, (long)LOC_S32Result, LOC_U8State, (long long)LOC_S128Reference, LOC_U8Expected);
+            LOC_U32Mismatches++;
+        }
+
+        for (LOC_S32Index = 0; LOC_S32Index < 32; LOC_S32Index++)
+        {
+            if (LOC_U32Exponent & (1UL << LOC_S32Index))
+            {
+                LOC_U64Reference = LOC_U64Reference * LOC_U64Square % LOC_U32Modulus;
+            }
+            LOC_U64Square = LOC_U64Square * LOC_U64Square % LOC_U32Modulus;
+        }
+        if (NUM_POW_U32ModPower(LOC_U32Base, LOC_U32Exponent, LOC_U32Modulus) != LOC_U64Reference)
+        {
+            fprintf(stderr, "modular power mismatch: %lu^%lu mod %lu gives %lu, expected %lu\n", (unsigned long)LOC_U32Base,
+                    (unsigned long)LOC_U32Exponent, (unsigned long)LOC_U32Modulus,
+                    (unsigned long)NUM_POW_U32ModPower(LOC_U32Base, LOC_U32Exponent, LOC_U32Modulus),
+                    (unsigned long)LOC_U64Reference);
+            LOC_U32Mismatches++;
+        }
+    }
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchCordicCheck
+ * Description: Runs the NUM_CORDIC functions on random arguments and compares
+ *              them with the double functions of the C library. The square
+ *              root must be exact, the others within HOST_BENCH_CORDIC_TOLERANCE,
+ *              and the exponential must overflow exactly when its power does
+ *              not fit 32 bits.
+ * Parameters:
+ *      - Copy_U32Cases: Arguments to check for each function
+ *      - Copy_PF64Errors: Receives the largest error of the sine and cosine,
+ *                         the arctangent, the exponential and the logarithm
+ * Return:
+ *      - u32: Number of mismatches.
+ ******************************************************************************/
+static u32 HOST_U32BenchCordicCheck(u32 Copy_U32Cases, double *Copy_PF64Errors)
+{
+    u32 LOC_U32Case, LOC_U32Mismatches = 0;
+    u8 LOC_U8Function;
+
+    memset(Copy_PF64Errors, 0, 4 * sizeof(double));
+    for (LOC_U32Case = 0; LOC_U32Case < Copy_U32Cases; LOC_U32Case++)
+    {
+        u64 LOC_U64Radicand = ((u64)HOST_U32BenchRandom() << 32 | HOST_U32BenchRandom()) >> (HOST_U32BenchRandom() % 64);
+        u32 LOC_U32Root = NUM_CORDIC_U32Sqrt(LOC_U64Radicand);
+        s32 LOC_S32Argument = (s32)HOST_U32BenchRandom(), LOC_S32Sine, LOC_S32Cosine, LOC_S32Result = 0;
+        s32 LOC_S32Positive = (s32)(1 + HOST_U32BenchRandom() % 0x7FFFFFFFUL);
+        s32 LOC_S32Exponent = (s32)(HOST_U32BenchRandom() % (64UL << 16)) - (42L << 16);
+        u8 LOC_U8Bits = (u8)(HOST_U32BenchRandom() % (NUM_CORDIC_FRACTION_BITS + 1)), LOC_U8PowerBits = 0, LOC_U8State;
+        double LOC_F64Argument = ldexp(LOC_S32Argument, -NUM_CORDIC_FRACTION_BITS), LOC_AF64Errors[4], LOC_F64Power;
+
+        if ((unsigned __int128)LOC_U32Root * LOC_U32Root > LOC_U64Radicand
+            || ((unsigned __int128)LOC_U32Root + 1) * ((unsigned __int128)LOC_U32Root + 1) <= LOC_U64Radicand)
+        {
+            fprintf(stderr, "sqrt mismatch: %llu gives %lu\n", (unsigned long long)LOC_U64Radicand, (unsigned long)LOC_U32Root);
+            LOC_U32Mismatches++;
+        }
+
+        NUM_CORDIC_VOIDSinCos(LOC_S32Argument, &LOC_S32Sine, &LOC_S32Cosine);
+        LOC_AF64Errors[0] = fmax(fabs(ldexp(LOC_S32Sine, -NUM_CORDIC_FRACTION_BITS) - sin(LOC_F64Argument)),
+                                 fabs(ldexp(LOC_S32Cosine, -NUM_CORDIC_FRACTION_BITS) - cos(LOC_F64Argument)));
+        LOC_AF64Errors[1] = fabs(ldexp(NUM_CORDIC_S32Atan(LOC_S32Argument, LOC_U8Bits), -NUM_CORDIC_FRACTION_BITS)
+                                 - atan(ldexp(LOC_S32Argument, -LOC_U8Bits)));
+
+        /* Powers too close to 2^31 may go either way */
+        LOC_F64Power = exp(ldexp(LOC_S32Exponent, -NUM_CORDIC_FRACTION_BITS));
+        LOC_U8State = NUM_CORDIC_U8Exp(&LOC_S32Result, &LOC_U8PowerBits, LOC_S32Exponent);
+        LOC_AF64Errors[2] = 0;
+        if (NUM_CORDIC_OK == LOC_U8State)
+        {
+            LOC_AF64Errors[2] = fabs(ldexp(LOC_S32Result, -LOC_U8PowerBits) - LOC_F64Power) / fmax(LOC_F64Power, 1.0);
+        }
+        if ((NUM_CORDIC_OK == LOC_U8State && LOC_F64Power > 0x80000000 * (1 + 0x1p-20))
+            || (NUM_CORDIC_OVERFLOW == LOC_U8State && LOC_F64Power < 0x80000000 * (1 - 0x1p-20)))
+        {
+            fprintf(stderr, "exp mismatch: %.6f gives state %u\n", ldexp(LOC_S32Exponent, -NUM_CORDIC_FRACTION_BITS), LOC_U8State);
+            LOC_U32Mismatches++;
+        }
+
+        LOC_U8State = NUM_CORDIC_U8Log(&LOC_S32Result, LOC_S32Positive, LOC_U8Bits);
+        LOC_AF64Errors[3] = fabs(ldexp(LOC_S32Result, -NUM_CORDIC_FRACTION_BITS) - log(ldexp(LOC_S32Positive, -LOC_U8Bits)));
+        if (NUM_CORDIC_OK != LOC_U8State || NUM_CORDIC_DOMAIN != NUM_CORDIC_U8Log(&LOC_S32Result, -LOC_S32Positive, LOC_U8Bits))
+        {
+            fprintf(stderr, "log mismatch: %ld with %u fraction bits gives state %u\n", (long)LOC_S32Positive, LOC_U8Bits, LOC_U8State);
+            LOC_U32Mismatches++;
+        }
+
+        for (LOC_U8Function = 0; LOC_U8Function < 4; LOC_U8Function++)
+        {
+            LOC_AF64Errors[LOC_U8Function] = ldexp(LOC_AF64Errors[LOC_U8Function], NUM_CORDIC_FRACTION_BITS);
+            if (LOC_AF64Errors[LOC_U8Function] > HOST_BENCH_CORDIC_TOLERANCE)
+            {
+                fprintf(stderr, "cordic mismatch: function %u of %ld is %.2f units off\n", LOC_U8Function, (long)LOC_S32Argument,
+                        LOC_AF64Errors[LOC_U8Function]);
+                LOC_U32Mismatches++;
+            }
+            Copy_PF64Errors[LOC_U8Function] = fmax(Copy_PF64Errors[LOC_U8Function], LOC_AF64Errors[LOC_U8Function]);
+        }
+    }
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchFormatAgrees
+ * Description: Converts one number with NUM_FMT and with sprintf and reports
+ *              any difference in the text or the returned length.
+ * Parameters:
+ *      - Copy_S64Value: The number
+ *      - Copy_U8Signed: 1 for the signed conversions
+ *      - Copy_U8Wide: 1 for the 64-bit conversions, 0 for the 32-bit ones
+ * Return:
+ *      - u8: 1 when both agree, 0 otherwise.
+ ******************************************************************************/
+static u8 HOST_U8BenchFormatAgrees(s64 Copy_S64Value, u8 Copy_U8Signed, u8 Copy_U8Wide)
+{
+    u8 LOC_AU8Text[NUM_FMT_S64_BUFFER_SIZE];
+    char LOC_ACharReference[32];
+    u8 LOC_U8Length;
+
+    if (Copy_U8Wide)
+    {
+        LOC_U8Length = Copy_U8Signed ? NUM_FMT_U8S64ToAscii(Copy_S64Value, LOC_AU8Text)
+                                     : NUM_FMT_U8U64ToAscii((u64)Copy_S64Value, LOC_AU8Text);
+        sprintf(LOC_ACharReference, Copy_U8Signed ? "%lld" : "%llu", (long long)Copy_S64Value);
+    }
+    else
+    {
+        LOC_U8Length = Copy_U8Signed ? NUM_FMT_U8S32ToAscii((s32)Copy_S64Value, LOC_AU8Text)
+                                     : NUM_FMT_U8U32ToAscii((u32)Copy_S64Value, LOC_AU8Text);
+        sprintf(LOC_ACharReference, Copy_U8Signed ? "%ld" : "%lu",
+                Copy_U8Signed ? (long)(s32)Copy_S64Value : (long)(unsigned long)(u32)Copy_S64Value);
+    }
+
+    if (strcmp((const char *)LOC_AU8Text, LOC_ACharReference) || LOC_U8Length != strlen(LOC_ACharReference))
+    {
+        fprintf(stderr, "format mismatch: %s gives %s (%u characters)\n", LOC_ACharReference, LOC_AU8Text, LOC_U8Length);
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchFormatCheck
+ * Description: Checks NUM_FMT against sprintf on every HOST_BENCH_FORMAT_STRIDE-th
+ *              s32, on both sides of every power of ten and on the extremes of
+ *              each conversion.
+ * Parameters:
+ *      - Copy_PU32Cases: Receives the number of conversions checked
+ * Return:
+ *      - u32: Number of mismatches.
+ ******************************************************************************/
+static u32 HOST_U32BenchFormatCheck(u32 *Copy_PU32Cases)
+{
+    static const s64 LOC_AS64Extremes[] =
+    {
+        0, 1, -1, 0x7FFFFFFFLL, -0x7FFFFFFFLL - 1, 0xFFFFFFFFLL, 0x7FFFFFFFFFFFFFFFLL, -0x7FFFFFFFFFFFFFFFLL - 1
+    };
+    u32 LOC_U32Mismatches = 0, LOC_U32Cases = 0;
+    s64 LOC_S64Value, LOC_S64Power;
+    u8 LOC_U8Index;
+
+    for (LOC_S64Value = -0x7FFFFFFFLL - 1; LOC_S64Value <= 0x7FFFFFFFLL; LOC_S64Value += HOST_BENCH_FORMAT_STRIDE)
+    {
+        LOC_U32Mismatches += !HOST_U8BenchFormatAgrees(LOC_S64Value, 1, 0);
+        LOC_U32Cases++;
+    }
+
+    /* Lengths change at the powers of ten */
+    for (LOC_S64Power = 1; LOC_S64Power <= 1000000000LL; LOC_S64Power *= 10)
+    {
+        for (LOC_S64Value = LOC_S64Power - 1; LOC_S64Value <= LOC_S64Power + 1; LOC_S64Value++)
+        {
+            LOC_U32Mismatches += !HOST_U8BenchFormatAgrees(LOC_S64Value, 1, 0) + !HOST_U8BenchFormatAgrees(-LOC_S64Value, 1, 0)
+                               + !HOST_U8BenchFormatAgrees(LOC_S64Value, 0, 0) + !HOST_U8BenchFormatAgrees(LOC_S64Value, 1, 1);
+            LOC_U32Cases += 4;
+        }
+    }
+
+    for (LOC_U8Index = 0; LOC_U8Index < sizeof(LOC_AS64Extremes) / sizeof(LOC_AS64Extremes[0]); LOC_U8Index++)
+    {
+        LOC_S64Value = LOC_AS64Extremes[LOC_U8Index];
+        if (LOC_S64Value >= -0x7FFFFFFFLL - 1 && LOC_S64Value <= 0x7FFFFFFFLL)
+        {
+            LOC_U32Mismatches += !HOST_U8BenchFormatAgrees(LOC_S64Value, 1, 0);
+            LOC_U32Cases++;
+        }
+        if (LOC_S64Value >= 0 && LOC_S64Value <= 0xFFFFFFFFLL)
+        {
+            LOC_U32Mismatches += !HOST_U8BenchFormatAgrees(LOC_S64Value, 0, 0);
+            LOC_U32Cases++;
+        }
+        LOC_U32Mismatches += !HOST_U8BenchFormatAgrees(LOC_S64Value, 1, 1) + !HOST_U8BenchFormatAgrees(LOC_S64Value, 0, 1);
+        LOC_U32Cases += 2;
+    }
+
+    *Copy_PU32Cases = LOC_U32Cases;
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U64BenchNow
+ * Description: Reads the monotonic clock of the host.
+ * Parameters: None
+ * Return:
+ *      - u64: Nanoseconds from an arbitrary origin.
+ ******************************************************************************/
+static u64 HOST_U64BenchNow(void)
+{
+    struct timespec LOC_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &LOC_Time);
+    return (u64)LOC_Time.tv_sec * 1000000000ULL + LOC_Time.tv_nsec;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U64BenchElapsed
+ * Description: Returns the time since a clock reading, less the cost of
+ *              reading the clock.
+ * Parameters:
+ *      - Copy_PU64Start: Clock reading, replaced by the current one
+ * Return:
+ *      - u64: Nanoseconds elapsed.
+ ******************************************************************************/
+static u64 HOST_U64BenchElapsed(u64 *Copy_PU64Start)
+{
+    u64 LOC_U64Now = HOST_U64BenchNow();
+    u64 LOC_U64Elapsed = LOC_U64Now - *Copy_PU64Start;
+
+    *Copy_PU64Start = LOC_U64Now;
+    return (LOC_U64Elapsed > HOST_U64ClockOverhead) ? LOC_U64Elapsed - HOST_U64ClockOverhead : 0;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchCalibrate
+ * Description: Measures the cost of reading the clock as the smallest of many
+ *              back to back readings.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchCalibrate(void)
+{
+    u32 LOC_U32Index;
+
+    HOST_U64ClockOverhead = ~0ULL;
+    for (LOC_U32Index = 0; LOC_U32Index < 10000; LOC_U32Index++)
+    {
+        u64 LOC_U64Start = HOST_U64BenchNow();
+        u64 LOC_U64Elapsed = HOST_U64BenchNow() - LOC_U64Start;
+
+        if (LOC_U64Elapsed < HOST_U64ClockOverhead)
+        {
+            HOST_U64ClockOverhead = LOC_U64Elapsed;
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchDrain
+ * Description: Lets the LCD queue empty on the simulated clock, so the next
+ *              evaluation never blocks on a full queue. Not timed.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchDrain(void)
+{
+    while (!HLCD_U8IsIdle())
+    {
+        _delay_us(100);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchResultCheck
+ * Description: Types runs of 1 to HOST_BENCH_RESULT_DIGITS nines, with and
+ *              without a sign, into a streaming session and presses '='. The
+ *              result on the first line, loaded back or only shown, must
+ *              leave the window at the left edge, so that its sign is in
+ *              view, and the cursor within the 16 visible columns.
+ * Parameters: None
+ * Return:
+ *      - u32: Number of results that scrolled the line.
+ ******************************************************************************/
+static u32 HOST_U32BenchResultCheck(void)
+{
+    Calculator_StreamType LOC_Stream;
+    u32 LOC_U32Mismatches = 0;
+    u8 LOC_U8Digits, LOC_U8Digit, LOC_U8Negative;
+
+    for (LOC_U8Digits = 1; LOC_U8Digits <= HOST_BENCH_RESULT_DIGITS; LOC_U8Digits++)
+    {
+        for (LOC_U8Negative = 0; LOC_U8Negative < 2; LOC_U8Negative++)
+        {
+            Calculator_VOIDStreamReset(&LOC_Stream);
+            if (LOC_U8Negative)
+            {
+                Calculator_VOIDStreamFeed(&LOC_Stream, '-');
+            }
+            for (LOC_U8Digit = 0; LOC_U8Digit < LOC_U8Digits; LOC_U8Digit++)
+            {
+                Calculator_VOIDStreamFeed(&LOC_Stream, '9');
+                HOST_VOIDBenchDrain();
+            }
+            Calculator_VOIDStreamFeed(&LOC_Stream, '=');
+            HOST_VOIDBenchDrain();
+
+            if (0 != LOC_Stream.WindowStart || LOC_Stream.Column >= 16 || LOC_Stream.Length > CALCULATOR_RESULT_WIDTH)
+            {
+                fprintf(stderr, "result mismatch: %s%u nines leave the window at column %u and the cursor at %u\n",
+                        LOC_U8Negative ? "minus " : "", LOC_U8Digits, LOC_Stream.WindowStart, LOC_Stream.Column);
+                LOC_U32Mismatches++;
+            }
+        }
+    }
+    Calculator_VOIDStreamReset(&LOC_Stream);
+    HOST_VOIDBenchDrain();
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32BenchQueueCheck
+ * Description: Types expressions whose result redraws more cells than the LCD
+ *              queue holds, flushing after every key without letting the queue
+ *              drain, as the main loop does. The producer has to wait on a full
+ *              queue, a lost transaction or a scrolled result counts against it.
+ * Parameters: None
+ * Return:
+ *      - u32: Number of expressions that dropped a transaction or scrolled the line.
+ ******************************************************************************/
+static u32 HOST_U32BenchQueueCheck(void)
+{
+    Calculator_StreamType LOC_Stream;
+    u32 LOC_U32Mismatches = 0;
+    u16 LOC_U16Dropped;
+    u8 LOC_U8Index;
+    const char *LOC_PCharKey;
+
+    for (LOC_U8Index = 0; LOC_U8Index < HOST_BENCH_QUEUE_LINES; LOC_U8Index++)
+    {
+        LOC_U16Dropped = HLCD_U16GetDroppedCount();
+        Calculator_VOIDStreamReset(&LOC_Stream);
+        HLCD_VOIDFlush();
+        for (LOC_PCharKey = HOST_APCharBenchQueueLines[LOC_U8Index]; *LOC_PCharKey; LOC_PCharKey++)
+        {
+            Calculator_VOIDStreamFeed(&LOC_Stream, *LOC_PCharKey);
+            HLCD_VOIDFlush();
+        }
+        HOST_VOIDBenchDrain();
+
+        if (LOC_U16Dropped != HLCD_U16GetDroppedCount() || 0 != LOC_Stream.WindowStart || LOC_Stream.Column >= 16)
+        {
+            fprintf(stderr, "queue mismatch: %s dropped %u transactions and left the window at column %u\n",
+                    HOST_APCharBenchQueueLines[LOC_U8Index], HLCD_U16GetDroppedCount() - LOC_U16Dropped, LOC_Stream.WindowStart);
+            LOC_U32Mismatches++;
+        }
+    }
+    Calculator_VOIDStreamReset(&LOC_Stream);
+    HOST_VOIDBenchDrain();
+    return LOC_U32Mismatches;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchLegacy
+ * Description: Runs the legacy engine as Calculator_VOIDCalculation does and
+ *              adds the time of each phase.
+ * Parameters:
+ *      - Copy_PU8Expression: Expression, modified by the engine
+ *      - Copy_PU64Phases: Error check, ordering, operation and rendering times
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchLegacy(u8 *Copy_PU8Expression, u64 *Copy_PU64Phases)
+{
+    u8 LOC_AU8Order[20];
+    s32 LOC_AS32Numbers[2];
+    u8 LOC_U8State, LOC_U8Operations, LOC_U8Iterator;
+    u64 LOC_U64Clock = HOST_U64BenchNow();
+
+    LOC_U8State = Calculator_U8ErrorState(Copy_PU8Expression);
+    Copy_PU64Phases[0] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    if (0 == LOC_U8State)
+    {
+        LOC_U8Operations = Calculator_U8OperationsOrder(Copy_PU8Expression, LOC_AU8Order);
+        Copy_PU64Phases[1] += HOST_U64BenchElapsed(&LOC_U64Clock);
+        while (LOC_U8Operations > 0)
+        {
+            Calculator_VOIDOperationCalculation(LOC_AU8Order, LOC_AS32Numbers, Copy_PU8Expression);
+            Copy_PU64Phases[2] += HOST_U64BenchElapsed(&LOC_U64Clock);
+            LOC_U8Operations = Calculator_U8OperationsOrder(Copy_PU8Expression, LOC_AU8Order);
+            Copy_PU64Phases[1] += HOST_U64BenchElapsed(&LOC_U64Clock);
+        }
+    }
+
+    HLCD_VOIDClearDisplay();
+    if (0 == LOC_U8State)
+    {
+        for (LOC_U8Iterator = 1; Copy_PU8Expression[LOC_U8Iterator] != '='; LOC_U8Iterator++)
+        {
+            HLCD_VOIDSendCharacter(Copy_PU8Expression[LOC_U8Iterator]);
+        }
+    }
+    else
+    {
+        HLCD_VOIDSendString((u8 *)((1 == LOC_U8State) ? "SYNTAX ERROR!" : "MATH ERROR!"));
+    }
+    HLCD_VOIDFlush();
+    Copy_PU64Phases[3] += HOST_U64BenchElapsed(&LOC_U64Clock);
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchSinglePass
+ * Description: Runs the single-pass engine as Calculator_VOIDCalculation does
+ *              and adds the time of each phase.
+ * Parameters:
+ *      - Copy_PU8Expression: Expression, the result is written back into it
+ *      - Copy_PU64Phases: Tokenize, validate, evaluate and rendering times
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchSinglePass(u8 *Copy_PU8Expression, u64 *Copy_PU64Phases)
+{
+    Calculator_TokenType LOC_ATokens[CALCULATOR_MAX_TOKENS];
+    u8 LOC_U8TokensNumber = 0, LOC_U8State;
+    s32 LOC_S32Result = 0;
+    u64 LOC_U64Clock = HOST_U64BenchNow();
+
+    LOC_U8State = Calculator_U8Tokenize(Copy_PU8Expression, LOC_ATokens, &LOC_U8TokensNumber);
+    Copy_PU64Phases[0] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    if (0 == LOC_U8State)
+    {
+        LOC_U8State = Calculator_U8ValidateTokens(LOC_ATokens, LOC_U8TokensNumber);
+        Copy_PU64Phases[1] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+    if (0 == LOC_U8State)
+    {
+        LOC_U8State = Calculator_U8Evaluate(LOC_ATokens, &LOC_S32Result);
+        Copy_PU64Phases[2] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+
+    Calculator_U8ShowResult(Copy_PU8Expression, LOC_U8State, LOC_S32Result);
+    HLCD_VOIDFlush();
+    Copy_PU64Phases[3] += HOST_U64BenchElapsed(&LOC_U64Clock);
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchTower
+ * Description: Times every operator of the numeric tower on the operands of
+ *              each width, all pairs of a metric in one clock window.
+ * Parameters:
+ *      - Copy_PU64Totals: Times of the add, sub, mul and div metrics, each
+ *                         from the 16-bit width to big
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchTower(u64 *Copy_PU64Totals)
+{
+    static u8 (*const LOC_APFunctions[4])(NUM_TOWER_Type *, const NUM_TOWER_Type *, const NUM_TOWER_Type *) =
+    {
+        NUM_TOWER_U8Add, NUM_TOWER_U8Sub, NUM_TOWER_U8Mul, NUM_TOWER_U8Div
+    };
+    static NUM_TOWER_Type LOC_AStrResults[HOST_BENCH_TOWER_PAIRS];
+    u8 LOC_U8Operator, LOC_U8Width;
+    u32 LOC_U32Index;
+
+    for (LOC_U8Operator = 0; LOC_U8Operator < 4; LOC_U8Operator++)
+    {
+        for (LOC_U8Width = 0; LOC_U8Width < NUM_TOWER_WIDTHS; LOC_U8Width++)
+        {
+            const NUM_TOWER_Type *LOC_PStrRight = (LOC_U8Operator < 2) ? HOST_AStrTowerRight[LOC_U8Width] : HOST_AStrTowerSmall;
+            u64 LOC_U64Clock = HOST_U64BenchNow();
+
+            for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+            {
+                LOC_APFunctions[LOC_U8Operator](&LOC_AStrResults[LOC_U32Index], &HOST_AStrTowerLeft[LOC_U8Width][LOC_U32Index],
+                                                &LOC_PStrRight[LOC_U32Index]);
+            }
+            Copy_PU64Totals[LOC_U8Operator * NUM_TOWER_WIDTHS + LOC_U8Width] += HOST_U64BenchElapsed(&LOC_U64Clock);
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchFixed
+ * Description: Times every fixed-point operator on the same operand pairs,
+ *              all pairs of a metric in one clock window.
+ * Parameters:
+ *      - Copy_PU64Totals: Times of the add, sub, mul and div metrics
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchFixed(u64 *Copy_PU64Totals)
+{
+    static u8 (*const LOC_APFunctions[4])(NUM_FIXED_Type *, NUM_FIXED_Type, NUM_FIXED_Type) =
+    {
+        NUM_FIXED_U8Add, NUM_FIXED_U8Sub, NUM_FIXED_U8Mul, NUM_FIXED_U8Div
+    };
+    static NUM_FIXED_Type LOC_AResults[HOST_BENCH_TOWER_PAIRS];
+    u8 LOC_U8Operator;
+    u32 LOC_U32Index;
+
+    for (LOC_U8Operator = 0; LOC_U8Operator < 4; LOC_U8Operator++)
+    {
+        u64 LOC_U64Clock = HOST_U64BenchNow();
+
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            LOC_APFunctions[LOC_U8Operator](&LOC_AResults[LOC_U32Index], HOST_AFixedLeft[LOC_U32Index], HOST_AFixedRight[LOC_U32Index]);
+        }
+        Copy_PU64Totals[LOC_U8Operator] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchS32Add / HOST_U8BenchS32Sub / HOST_U8BenchS32Mul /
+ *                HOST_U8BenchS32Div
+ * Description: The operators of the s32 build of the calculator, which wrap
+ *              around and truncate, called the way the rational ones are.
+ * Parameters:
+ *      - Copy_PS32Result: Receives the result
+ *      - Copy_PS32Left: Left operand
+ *      - Copy_PS32Right: Right operand
+ * Return:
+ *      - u8: 0, or 2 for a division by zero.
+ ******************************************************************************/
+static u8 HOST_U8BenchS32Add(s32 *Copy_PS32Result, const s32 *Copy_PS32Left, const s32 *Copy_PS32Right)
+{
+    *Copy_PS32Result = *Copy_PS32Left + *Copy_PS32Right;
+    return 0;
+}
+
+static u8 HOST_U8BenchS32Sub(s32 *Copy_PS32Result, const s32 *Copy_PS32Left, const s32 *Copy_PS32Right)
+{
+    *Copy_PS32Result = *Copy_PS32Left - *Copy_PS32Right;
+    return 0;
+}
+
+static u8 HOST_U8BenchS32Mul(s32 *Copy_PS32Result, const s32 *Copy_PS32Left, const s32 *Copy_PS32Right)
+{
+    *Copy_PS32Result = *Copy_PS32Left * *Copy_PS32Right;
+    return 0;
+}
+
+static u8 HOST_U8BenchS32Div(s32 *Copy_PS32Result, const s32 *Copy_PS32Left, const s32 *Copy_PS32Right)
+{
+    if (0 == *Copy_PS32Right)
+    {
+        return 2;
+    }
+    *Copy_PS32Result = *Copy_PS32Left / *Copy_PS32Right;
+    return 0;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchRational
+ * Description: Times every s32 and rational operator on their operand pairs,
+ *              then sums of typed fractions such as 1/3+5/6+2/7 term by term,
+ *              each term a division then an addition as in the evaluator:
+ *              truncated in s32, exact and reduced only on overflow, and
+ *              exact and reduced after every operation.
+ * Parameters:
+ *      - Copy_PU64Totals: Times of the s32 add, sub, mul and div metrics, then
+ *                         the rational ones, then the three chains
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchRational(u64 *Copy_PU64Totals)
+{
+    static u8 (*const LOC_APS32Functions[4])(s32 *, const s32 *, const s32 *) =
+    {
+        HOST_U8BenchS32Add, HOST_U8BenchS32Sub, HOST_U8BenchS32Mul, HOST_U8BenchS32Div
+    };
+    static u8 (*const LOC_APFunctions[4])(NUM_RATIONAL_Type *, const NUM_RATIONAL_Type *, const NUM_RATIONAL_Type *) =
+    {
+        NUM_RATIONAL_U8Add, NUM_RATIONAL_U8Sub, NUM_RATIONAL_U8Mul, NUM_RATIONAL_U8Div
+    };
+    static s32 LOC_AS32Results[HOST_BENCH_TOWER_PAIRS];
+    static NUM_RATIONAL_Type LOC_AResults[HOST_BENCH_TOWER_PAIRS];
+    NUM_RATIONAL_Type LOC_Sum, LOC_Term, LOC_Numerator, LOC_Denominator;
+    s32 LOC_S32Sum = 0, LOC_S32Term = 0;
+    u8 LOC_U8Operator, LOC_U8Eager;
+    u32 LOC_U32Index;
+    u64 LOC_U64Clock;
+
+    for (LOC_U8Operator = 0; LOC_U8Operator < 4; LOC_U8Operator++)
+    {
+        LOC_U64Clock = HOST_U64BenchNow();
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            LOC_APS32Functions[LOC_U8Operator](&LOC_AS32Results[LOC_U32Index], &HOST_AS32Left[LOC_U32Index], &HOST_AS32Right[LOC_U32Index]);
+        }
+        Copy_PU64Totals[LOC_U8Operator] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            LOC_APFunctions[LOC_U8Operator](&LOC_AResults[LOC_U32Index], &HOST_ARationalLeft[LOC_U32Index], &HOST_ARationalRight[LOC_U32Index]);
+        }
+        Copy_PU64Totals[4 + LOC_U8Operator] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+
+    /* The sums are kept in the results so the compiler cannot drop them */
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        if (0 == LOC_U32Index % HOST_BENCH_CHAIN_TERMS)
+        {
+            LOC_S32Sum = 0;
+        }
+        HOST_U8BenchS32Div(&LOC_S32Term, &HOST_AS32ChainNumerators[LOC_U32Index], &HOST_AS32ChainDenominators[LOC_U32Index]);
+        HOST_U8BenchS32Add(&LOC_S32Sum, &LOC_S32Sum, &LOC_S32Term);
+        LOC_AS32Results[LOC_U32Index] = LOC_S32Sum;
+    }
+    Copy_PU64Totals[8] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    for (LOC_U8Eager = 0; LOC_U8Eager < 2; LOC_U8Eager++)
+    {
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            if (0 == LOC_U32Index % HOST_BENCH_CHAIN_TERMS)
+            {
+                NUM_RATIONAL_VOIDFromS32(&LOC_Sum, 0);
+            }
+            NUM_RATIONAL_VOIDFromS32(&LOC_Numerator, HOST_AS32ChainNumerators[LOC_U32Index]);
+            NUM_RATIONAL_VOIDFromS32(&LOC_Denominator, HOST_AS32ChainDenominators[LOC_U32Index]);
+            NUM_RATIONAL_U8Div(&LOC_Term, &LOC_Numerator, &LOC_Denominator);
+            if (LOC_U8Eager)
+            {
+                NUM_RATIONAL_VOIDNormalize(&LOC_Term);
+            }
+            NUM_RATIONAL_U8Add(&LOC_Sum, &LOC_Sum, &LOC_Term);
+            if (LOC_U8Eager)
+            {
+                NUM_RATIONAL_VOIDNormalize(&LOC_Sum);
+            }
+            LOC_AResults[LOC_U32Index] = LOC_Sum;
+        }
+        Copy_PU64Totals[9 + LOC_U8Eager] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchPower
+ * Description: Times the multiplication loop of the legacy engine and the
+ *              powers by squaring on the same bases for every exponent size,
+ *              then the modular powers for every modulus.
+ * Parameters:
+ *      - Copy_PU64Totals: Times of the loop for every exponent, then of the
+ *                         squaring, then of the modular powers
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchPower(u64 *Copy_PU64Totals)
+{
+    static s32 LOC_AS32Results[HOST_BENCH_TOWER_PAIRS];
+    u8 LOC_U8Size;
+    u32 LOC_U32Index;
+    u64 LOC_U64Clock;
+
+    for (LOC_U8Size = 0; LOC_U8Size < HOST_BENCH_POWER_EXPONENTS; LOC_U8Size++)
+    {
+        u8 LOC_U8Exponent = HOST_AU8PowerExponents[LOC_U8Size];
+
+        LOC_U64Clock = HOST_U64BenchNow();
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            HOST_AU32PowerResults[LOC_U32Index] = Calculator_U32GetPower((u32)HOST_AS32PowerBases[LOC_U8Size][LOC_U32Index], LOC_U8Exponent);
+        }
+        Copy_PU64Totals[LOC_U8Size] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            NUM_POW_U8PowerS32(&LOC_AS32Results[LOC_U32Index], HOST_AS32PowerBases[LOC_U8Size][LOC_U32Index], LOC_U8Exponent);
+        }
+        Copy_PU64Totals[HOST_BENCH_POWER_EXPONENTS + LOC_U8Size] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+        for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+        {
+            HOST_AU32PowerResults[LOC_U32Index] = NUM_POW_U32ModPower(HOST_AU32ModBases[LOC_U32Index], HOST_AU32ModExponents[LOC_U32Index],
+                                                                HOST_AU32PowerModuli[LOC_U8Size]);
+        }
+        Copy_PU64Totals[2 * HOST_BENCH_POWER_EXPONENTS + LOC_U8Size] += HOST_U64BenchElapsed(&LOC_U64Clock);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchCordic
+ * Description: Times each NUM_CORDIC function on the same random arguments,
+ *              the square root on a 16-bit fixed-point radicand.
+ * Parameters:
+ *      - Copy_PU64Totals: Times of the square root, sine and cosine,
+ *                         arctangent, exponential and logarithm
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchCordic(u64 *Copy_PU64Totals)
+{
+    static s32 LOC_AS32Cosines[HOST_BENCH_TOWER_PAIRS];
+    u32 LOC_U32Index;
+    u64 LOC_U64Clock = HOST_U64BenchNow();
+    u8 LOC_U8Bits;
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        HOST_AS32CordicResults[LOC_U32Index] = (s32)NUM_CORDIC_U32Sqrt((u64)HOST_AS32CordicPositives[LOC_U32Index] << NUM_CORDIC_FRACTION_BITS);
+    }
+    Copy_PU64Totals[0] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        NUM_CORDIC_VOIDSinCos(HOST_AS32CordicArguments[LOC_U32Index], &HOST_AS32CordicResults[LOC_U32Index], &LOC_AS32Cosines[LOC_U32Index]);
+    }
+    Copy_PU64Totals[1] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        HOST_AS32CordicResults[LOC_U32Index] = NUM_CORDIC_S32Atan(HOST_AS32CordicArguments[LOC_U32Index], NUM_CORDIC_FRACTION_BITS);
+    }
+    Copy_PU64Totals[2] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        NUM_CORDIC_U8Exp(&HOST_AS32CordicResults[LOC_U32Index], &LOC_U8Bits, HOST_AS32CordicExponents[LOC_U32Index]);
+    }
+    Copy_PU64Totals[3] += HOST_U64BenchElapsed(&LOC_U64Clock);
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        NUM_CORDIC_U8Log(&HOST_AS32CordicResults[LOC_U32Index], HOST_AS32CordicPositives[LOC_U32Index], NUM_CORDIC_FRACTION_BITS);
+    }
+    Copy_PU64Totals[4] += HOST_U64BenchElapsed(&LOC_U64Clock);
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchFormat
+ * Description: Times NUM_FMT_U8S32ToAscii, the conversion behind every s32
+ *              result on the display.
+ * Parameters:
+ *      - Copy_PU64Totals: Time of the conversions
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchFormat(u64 *Copy_PU64Totals)
+{
+    u32 LOC_U32Index;
+    u64 LOC_U64Clock = HOST_U64BenchNow();
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_BENCH_TOWER_PAIRS; LOC_U32Index++)
+    {
+        HOST_U32FormatLength += NUM_FMT_U8S32ToAscii(HOST_AS32FormatValues[LOC_U32Index], HOST_AU8FormatText);
+    }
+    Copy_PU64Totals[0] += HOST_U64BenchElapsed(&LOC_U64Clock);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchLegacyAgrees
+ * Description: Evaluates an expression with the legacy engine in a child
+ *              process and compares the result with the single-pass engine.
+ *              The legacy engine applies every '*' before any '/' and every
+ *              '+' before any '-', misreads a sign after an operator and may
+ *              fault or loop on a zero intermediate result.
+ * Parameters:
+ *      - Copy_PU8Expression: Expression to check, left unchanged
+ * Return:
+ *      - u8: 1 if the legacy engine gives the right result, 0 otherwise.
+ ******************************************************************************/
+static u8 HOST_U8BenchLegacyAgrees(const u8 *Copy_PU8Expression)
+{
+    int LOC_Status = 1;
+    pid_t LOC_Child = fork();
+
+    if (0 == LOC_Child)
+    {
+        u8 LOC_AU8Legacy[HOST_BENCH_BUFFER], LOC_AU8Reference[HOST_BENCH_BUFFER], LOC_AU8Order[20];
+        Calculator_TokenType LOC_ATokens[CALCULATOR_MAX_TOKENS];
+        u8 LOC_U8TokensNumber = 0, LOC_U8Index = 0;
+        s32 LOC_AS32Numbers[2], LOC_S32Result = 0;
+
+        /* A loop in the legacy engine ends the child after a second */
+        alarm(1);
+        memcpy(LOC_AU8Legacy, Copy_PU8Expression, HOST_BENCH_BUFFER);
+        memcpy(LOC_AU8Reference, Copy_PU8Expression, HOST_BENCH_BUFFER);
+
+        if (Calculator_U8Tokenize(LOC_AU8Reference, LOC_ATokens, &LOC_U8TokensNumber)
+            || Calculator_U8ValidateTokens(LOC_ATokens, LOC_U8TokensNumber)
+            || Calculator_U8Evaluate(LOC_ATokens, &LOC_S32Result) || Calculator_U8ErrorState(LOC_AU8Legacy))
+        {
+            _exit(1);
+        }
+        Calculator_U8WriteResult(LOC_AU8Reference, LOC_S32Result);
+        while (Calculator_U8OperationsOrder(LOC_AU8Legacy, LOC_AU8Order) > 0)
+        {
+            Calculator_VOIDOperationCalculation(LOC_AU8Order, LOC_AS32Numbers, LOC_AU8Legacy);
+        }
+
+        /* Both write "!<result>=", the legacy engine may leave characters after it */
+        while (LOC_AU8Legacy[LOC_U8Index] == LOC_AU8Reference[LOC_U8Index] && LOC_AU8Reference[LOC_U8Index] != '=')
+        {
+            LOC_U8Index++;
+        }
+        _exit(LOC_AU8Legacy[LOC_U8Index] != LOC_AU8Reference[LOC_U8Index]);
+    }
+
+    if (LOC_Child > 0)
+    {
+        waitpid(LOC_Child, &LOC_Status, 0);
+    }
+    return LOC_Child > 0 && WIFEXITED(LOC_Status) && 0 == WEXITSTATUS(LOC_Status);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchRange
+ * Description: Parses "min-max" or a single number into a range.
+ * Parameters:
+ *      - Copy_PCharText: Text to parse
+ *      - Copy_U8Limit: Largest value allowed
+ *      - Copy_PU8Min: Receives the lowest value
+ *      - Copy_PU8Max: Receives the highest value
+ * Return:
+ *      - u8: 1 on success, 0 for a malformed or out of bounds range.
+ ******************************************************************************/
+static u8 HOST_U8BenchRange(const char *Copy_PCharText, u8 Copy_U8Limit, u8 *Copy_PU8Min, u8 *Copy_PU8Max)
+{
+    unsigned LOC_Min, LOC_Max;
+    int LOC_Fields = sscanf(Copy_PCharText, "%u-%u", &LOC_Min, &LOC_Max);
+
+    if (1 == LOC_Fields)
+    {
+        LOC_Max = LOC_Min;
+    }
+    if (LOC_Fields < 1 || 0 == LOC_Min || LOC_Min > LOC_Max || LOC_Max > Copy_U8Limit)
+    {
+        return 0;
+    }
+    *Copy_PU8Min = (u8)LOC_Min;
+    *Copy_PU8Max = (u8)LOC_Max;
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDBenchWriteJson
+ * Description: Writes the configuration and the results of a run as JSON.
+ * Parameters:
+ *      - Copy_PFile: Where to write
+ *      - Copy_PStrConfig: Configuration of the run
+ *      - Copy_PF64Metrics: Nanoseconds per expression of every metric
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDBenchWriteJson(FILE *Copy_PFile, const HOST_BenchConfigType *Copy_PStrConfig,
+                                    const double *Copy_PF64Metrics)
+{
+    u8 LOC_U8Index;
+
+    fprintf(Copy_PFile, "{\n");
+    fprintf(Copy_PFile, "  \"engine\": \"%s\",\n",
+            (CALCULATOR_ENGINE == CALCULATOR_ENGINE_SINGLE_PASS) ? "single_pass" : "legacy");
+    fprintf(Copy_PFile, "  \"seed\": %lu,\n", (unsigned long)Copy_PStrConfig->Seed);
+    fprintf(Copy_PFile, "  \"expressions\": %lu,\n", (unsigned long)Copy_PStrConfig->Expressions);
+    fprintf(Copy_PFile, "  \"passes\": %lu,\n", (unsigned long)Copy_PStrConfig->Passes);
+    fprintf(Copy_PFile, "  \"operands\": [%u, %u],\n", Copy_PStrConfig->MinOperands, Copy_PStrConfig->MaxOperands);
+    fprintf(Copy_PFile, "  \"digits\": [%u, %u],\n", Copy_PStrConfig->MinDigits, Copy_PStrConfig->MaxDigits);
+    fprintf(Copy_PFile, "  \"max_length\": %u,\n", Copy_PStrConfig->MaxLength);
+    fprintf(Copy_PFile, "  \"operator_weights\": [%u, %u, %u, %u],\n", Copy_PStrConfig->Weights[0],
+            Copy_PStrConfig->Weights[1], Copy_PStrConfig->Weights[2], Copy_PStrConfig->Weights[3]);
+    fprintf(Copy_PFile, "  \"negative_percent\": [%u, %u],\n", Copy_PStrConfig->LeadingPercent,
+            Copy_PStrConfig->InnerPercent);
+    fprintf(Copy_PFile, "  \"expressions_per_sec\": %.0f,\n", 1e9 / Copy_PF64Metrics[0]);
+    fprintf(Copy_PFile, "  \"ns_per_op\": {");
+    for (LOC_U8Index = 0; LOC_U8Index < HOST_BENCH_METRICS; LOC_U8Index++)
+    {
+        if (Copy_PF64Metrics[LOC_U8Index] >= 0)
+        {
+            fprintf(Copy_PFile, "%s\n    \"%s\": %.2f", LOC_U8Index ? "," : "", HOST_APCharMetrics[LOC_U8Index],
+                    Copy_PF64Metrics[LOC_U8Index]);
+        }
+    }
+    fprintf(Copy_PFile, "\n  }\n}\n");
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8BenchCompare
+ * Description: Compares every metric with the same metric of a baseline file
+ *              written by an earlier run and prints the change.
+ * Parameters:
+ *      - Copy_PCharPath: Baseline JSON file
+ *      - Copy_PF64Metrics: Nanoseconds per expression of every metric
+ *      - Copy_F64Threshold: Slowdown in percent counted as a regression
+ * Return:
+ *      - u8: 0 if nothing regressed, 1 on a regression, 2 if the file cannot be read.
+ ******************************************************************************/
+static u8 HOST_U8BenchCompare(const char *Copy_PCharPath, const double *Copy_PF64Metrics, double Copy_F64Threshold)
+{
+    static char LOC_ACharBaseline[8192];
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "r");
+    size_t LOC_Length;
+    u8 LOC_U8Index, LOC_U8Regressed = 0;
+
+    if (NULL == LOC_PFile)
+    {
+        fprintf(stderr, "cannot read %s\n", Copy_PCharPath);
+        return 2;
+    }
+    LOC_Length = fread(LOC_ACharBaseline, 1, sizeof(LOC_ACharBaseline) - 1, LOC_PFile);
+    LOC_ACharBaseline[LOC_Length] = '\0';
+    fclose(LOC_PFile);
+
+    printf("%-24s %12s %12s %9s\n", "metric (ns/op)", "baseline", "current", "change");
+    for (LOC_U8Index = 0; LOC_U8Index < HOST_BENCH_METRICS; LOC_U8Index++)
+    {
+        char LOC_ACharKey[48];
+        const char *LOC_PCharFound;
+        double LOC_F64Baseline, LOC_F64Change;
+
+        if (Copy_PF64Metrics[LOC_U8Index] < 0)
+        {
+            continue;
+        }
+        snprintf(LOC_ACharKey, sizeof(LOC_ACharKey), "\"%s\":", HOST_APCharMetrics[LOC_U8Index]);
+        LOC_PCharFound = strstr(LOC_ACharBaseline, LOC_ACharKey);
+        if (NULL == LOC_PCharFound || 1 != sscanf(LOC_PCharFound + strlen(LOC_ACharKey), "%lf", &LOC_F64Baseline)
+            || LOC_F64Baseline <= 0)
+        {
+            printf("%-24s %12s %12.2f\n", HOST_APCharMetrics[LOC_U8Index], "-", Copy_PF64Metrics[LOC_U8Index]);
+            continue;
+        }
+
+        LOC_F64Change = 100.0 * (Copy_PF64Metrics[LOC_U8Index] - LOC_F64Baseline) / LOC_F64Baseline;
+        printf("%-24s %12.2f %12.2f %+8.1f%%%s\n", HOST_APCharMetrics[LOC_U8Index], LOC_F64Baseline,
+               Copy_PF64Metrics[LOC_U8Index], LOC_F64Change, (LOC_F64Change > Copy_F64Threshold) ? "  REGRESSION" : "");
+        if (LOC_F64Change > Copy_F64Threshold)
+        {
+            LOC_U8Regressed = 1;
+        }
+    }
+    return LOC_U8Regressed;
+}
+
+/******************************************************************************
+ * Function Name: main
+ * Description: Generates the corpus, runs it and reports the results.
+ * Parameters:
+ *      - argc: Number of arguments
+ *      - argv: Options, see the usage text
+ * Returns:
+ *      - int: 0 on success, 1 for bad arguments or a failed write, 2 for an
+ *             unreadable baseline, 3 when a metric regressed, 4 when the
+ *             fixed-point arithmetic differs from its reference.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    HOST_BenchConfigType LOC_Config = {1, 1000, 50, 2, 8, 1, 4, HOST_BENCH_MAX_LENGTH, {1, 1, 1, 1}, 10, 0};
+    const char *LOC_PCharOutput = NULL, *LOC_PCharBaseline = NULL;
+    double LOC_F64Threshold = 10.0;
+    double LOC_AF64Metrics[HOST_BENCH_METRICS];
+    u64 LOC_AU64Totals[HOST_BENCH_METRICS], LOC_AU64Best[HOST_BENCH_METRICS];
+    u8 (*LOC_PAU8Corpus)[HOST_BENCH_BUFFER];
+    u8 *LOC_PU8LegacyAgrees;
+    u8 LOC_AU8Work[HOST_BENCH_BUFFER];
+    u32 LOC_U32Pass, LOC_U32Index, LOC_U32Operands = 0, LOC_U32LegacyExpressions = 0, LOC_U32FixedMismatches;
+    u32 LOC_U32RationalMismatches, LOC_U32PowerMismatches, LOC_U32CordicMismatches, LOC_U32FormatMismatches, LOC_U32FormatCases;
+    u32 LOC_U32ResultMismatches, LOC_U32QueueMismatches;
+    double LOC_AF64CordicErrors[4];
+    u8 LOC_U8Index;
+    int LOC_Option;
+
+    while (-1 != (LOC_Option = getopt(argc, argv, "s:n:p:o:d:l:w:g:G:j:b:t:")))
+    {
+        unsigned LOC_AWeights[4];
+        u8 LOC_U8Ok = 1;
+
+        switch (LOC_Option)
+        {
+        case 's': LOC_Config.Seed = (u32)strtoul(optarg, NULL, 0); break;
+        case 'n': LOC_Config.Expressions = (u32)strtoul(optarg, NULL, 0); break;
+        case 'p': LOC_Config.Passes = (u32)strtoul(optarg, NULL, 0); break;
+        case 'o': LOC_U8Ok = HOST_U8BenchRange(optarg, 20, &LOC_Config.MinOperands, &LOC_Config.MaxOperands); break;
+        case 'd': LOC_U8Ok = HOST_U8BenchRange(optarg, 9, &LOC_Config.MinDigits, &LOC_Config.MaxDigits); break;
+        case 'l':
+            LOC_U8Ok = HOST_U8BenchRange(optarg, HOST_BENCH_MAX_LENGTH, &LOC_Config.MaxLength, &LOC_Config.MaxLength);
+            break;
+        case 'w':
+            LOC_U8Ok = (4 == sscanf(optarg, "%u,%u,%u,%u", &LOC_AWeights[0], &LOC_AWeights[1], &LOC_AWeights[2], &LOC_AWeights[3]))
+                    && LOC_AWeights[0] <= 60 && LOC_AWeights[1] <= 60 && LOC_AWeights[2] <= 60 && LOC_AWeights[3] <= 60
+                    && LOC_AWeights[0] + LOC_AWeights[1] + LOC_AWeights[2] + LOC_AWeights[3] > 0;
+            for (LOC_U8Index = 0; LOC_U8Ok && LOC_U8Index < 4; LOC_U8Index++)
+            {
+                LOC_Config.Weights[LOC_U8Index] = (u8)LOC_AWeights[LOC_U8Index];
+            }
+            break;
+        case 'g':
+            LOC_Config.LeadingPercent = (u8)strtoul(optarg, NULL, 0);
+            LOC_U8Ok = LOC_Config.LeadingPercent <= 100;
+            break;
+        case 'G':
+            LOC_Config.InnerPercent = (u8)strtoul(optarg, NULL, 0);
+            LOC_U8Ok = LOC_Config.InnerPercent <= 100;
+            break;
+        case 'j': LOC_PCharOutput = optarg; break;
+        case 'b': LOC_PCharBaseline = optarg; break;
+        case 't': LOC_F64Threshold = atof(optarg); break;
+        default: LOC_U8Ok = 0; break;
+        }
+
+        if (!LOC_U8Ok)
+        {
+            optind = argc + 1;
+            break;
+        }
+    }
+    if (optind != argc || 0 == LOC_Config.Seed || 0 == LOC_Config.Expressions || 0 == LOC_Config.Passes
+        )
+    {
+        fprintf(stderr,
+                "usage: %s [-s seed] [-n expressions] [-p passes] [-o operands min-max]\n"
+                "          [-d digits min-max] [-l max length] [-w +,-,*,/ weights]\n"
+                "          [-g leading sign percent] [-G inner sign percent]\n"
+                "          [-j results.json] [-b baseline.json] [-t threshold %%]\n",
+                argv[0]);
+        return 1;
+    }
+
+    /* Generate the whole corpus up front so the generator is never timed */
+    LOC_PAU8Corpus = malloc((size_t)LOC_Config.Expressions * HOST_BENCH_BUFFER);
+    LOC_PU8LegacyAgrees = malloc(LOC_Config.Expressions);
+    if (NULL == LOC_PAU8Corpus || NULL == LOC_PU8LegacyAgrees)
+    {
+        return 1;
+    }
+    HOST_U32BenchState = LOC_Config.Seed;
+    for (LOC_U32Index = 0; LOC_U32Index < LOC_Config.Expressions; LOC_U32Index++)
+    {
+        LOC_U32Operands += HOST_U8BenchGenerate(&LOC_Config, LOC_PAU8Corpus[LOC_U32Index]);
+        LOC_PU8LegacyAgrees[LOC_U32Index] = HOST_U8BenchLegacyAgrees(LOC_PAU8Corpus[LOC_U32Index]);
+        LOC_U32LegacyExpressions += LOC_PU8LegacyAgrees[LOC_U32Index];
+    }
+    HOST_VOIDBenchTowerGenerate();
+    LOC_U32FixedMismatches = HOST_U32BenchFixedCheck(HOST_BENCH_FIXED_CHECKS);
+    LOC_U32RationalMismatches = HOST_U32BenchRationalCheck(HOST_BENCH_FIXED_CHECKS);
+    LOC_U32PowerMismatches = HOST_U32BenchPowerCheck(HOST_BENCH_FIXED_CHECKS);
+    LOC_U32CordicMismatches = HOST_U32BenchCordicCheck(HOST_BENCH_FIXED_CHECKS, LOC_AF64CordicErrors);
+    LOC_U32FormatMismatches = HOST_U32BenchFormatCheck(&LOC_U32FormatCases);
+
+    HLCD_VOIDInitialization();
+    LOC_U32ResultMismatches = HOST_U32BenchResultCheck();
+    LOC_U32QueueMismatches = HOST_U32BenchQueueCheck();
+    HOST_VOIDBenchCalibrate();
+
+    /* The fastest pass of each metric is kept, slower ones were disturbed by the host */
+    memset(LOC_AU64Best, 0xFF, sizeof(LOC_AU64Best));
+    for (LOC_U32Pass = 0; LOC_U32Pass < LOC_Config.Passes; LOC_U32Pass++)
+    {
+        memset(LOC_AU64Totals, 0, sizeof(LOC_AU64Totals));
+        for (LOC_U32Index = 0; LOC_U32Index < LOC_Config.Expressions; LOC_U32Index++)
+        {
+            u8 LOC_U8Legacy = LOC_PU8LegacyAgrees[LOC_U32Index];
+
+            /* Every engine consumes its copy of the expression */
+            if (CALCULATOR_ENGINE != CALCULATOR_ENGINE_LEGACY || LOC_U8Legacy)
+            {
+                u64 LOC_U64Clock;
+
+                memcpy(LOC_AU8Work, LOC_PAU8Corpus[LOC_U32Index], HOST_BENCH_BUFFER);
+                LOC_U64Clock = HOST_U64BenchNow();
+                Calculator_VOIDCalculation(LOC_AU8Work);
+                LOC_AU64Totals[0] += HOST_U64BenchElapsed(&LOC_U64Clock);
+                HOST_VOIDBenchDrain();
+            }
+
+            if (LOC_U8Legacy)
+            {
+                memcpy(LOC_AU8Work, LOC_PAU8Corpus[LOC_U32Index], HOST_BENCH_BUFFER);
+                HOST_VOIDBenchLegacy(LOC_AU8Work, &LOC_AU64Totals[1]);
+                HOST_VOIDBenchDrain();
+            }
+
+            memcpy(LOC_AU8Work, LOC_PAU8Corpus[LOC_U32Index], HOST_BENCH_BUFFER);
+            HOST_VOIDBenchSinglePass(LOC_AU8Work, &LOC_AU64Totals[1 + HOST_BENCH_PHASES]);
+            HOST_VOIDBenchDrain();
+        }
+        HOST_VOIDBenchTower(&LOC_AU64Totals[HOST_BENCH_EXPRESSION_METRICS]);
+        HOST_VOIDBenchFixed(&LOC_AU64Totals[HOST_BENCH_TOWER_METRICS]);
+        HOST_VOIDBenchRational(&LOC_AU64Totals[HOST_BENCH_FIXED_METRICS]);
+        HOST_VOIDBenchPower(&LOC_AU64Totals[HOST_BENCH_CHAIN_METRICS]);
+        HOST_VOIDBenchCordic(&LOC_AU64Totals[HOST_BENCH_POWER_METRICS]);
+        HOST_VOIDBenchFormat(&LOC_AU64Totals[HOST_BENCH_CORDIC_METRICS]);
+        for (LOC_U8Index = 0; LOC_U8Index < HOST_BENCH_METRICS; LOC_U8Index++)
+        {
+            if (LOC_AU64Totals[LOC_U8Index] < LOC_AU64Best[LOC_U8Index])
+            {
+                LOC_AU64Best[LOC_U8Index] = LOC_AU64Totals[LOC_U8Index];
+            }
+        }
+    }
+
+    printf("corpus: %lu expressions, %.1f operands on average, seed %lu, %lu passes, legacy engine correct on %lu\n",
+           (unsigned long)LOC_Config.Expressions, (double)LOC_U32Operands / LOC_Config.Expressions,
+           (unsigned long)LOC_Config.Seed, (unsigned long)LOC_Config.Passes, (unsigned long)LOC_U32LegacyExpressions);
+    printf("fixed-point check: %lu operand pairs, %u fraction digits, %lu mismatches\n", (unsigned long)HOST_BENCH_FIXED_CHECKS,
+           NUM_FIXED_FRACTION_DIGITS, (unsigned long)LOC_U32FixedMismatches);
+    printf("rational check: %lu operand pairs, %lu mismatches\n", (unsigned long)HOST_BENCH_FIXED_CHECKS,
+           (unsigned long)LOC_U32RationalMismatches);
+    printf("power check: %lu powers and modular powers, %lu mismatches\n", (unsigned long)HOST_BENCH_FIXED_CHECKS,
+           (unsigned long)LOC_U32PowerMismatches);
+    printf("cordic check: %lu arguments, largest errors in units of 2^-16: sin/cos %.2f, atan %.2f, exp %.2f (relative), "
+           "ln %.2f, %lu mismatches\n", (unsigned long)HOST_BENCH_FIXED_CHECKS, LOC_AF64CordicErrors[0], LOC_AF64CordicErrors[1],
+           LOC_AF64CordicErrors[2], LOC_AF64CordicErrors[3], (unsigned long)LOC_U32CordicMismatches);
+    printf("format check: %lu conversions against sprintf, %lu mismatches\n", (unsigned long)LOC_U32FormatCases,
+           (unsigned long)LOC_U32FormatMismatches);
+    printf("result check: %u lengths with and without a sign, %lu scrolled the line\n", HOST_BENCH_RESULT_DIGITS,
+           (unsigned long)LOC_U32ResultMismatches);
+    printf("queue check: %u expressions overflowing the LCD queue, %lu mismatches\n", HOST_BENCH_QUEUE_LINES,
+           (unsigned long)LOC_U32QueueMismatches);
+    for (LOC_U8Index = 0; LOC_U8Index < HOST_BENCH_METRICS; LOC_U8Index++)
+    {
+        u8 LOC_U8Legacy = (LOC_U8Index >= 1 && LOC_U8Index <= HOST_BENCH_PHASES)
+                       || (0 == LOC_U8Index && CALCULATOR_ENGINE == CALCULATOR_ENGINE_LEGACY);
+        u32 LOC_U32Timed = LOC_U8Legacy ? LOC_U32LegacyExpressions : LOC_Config.Expressions;
+
+        if (LOC_U8Index >= HOST_BENCH_EXPRESSION_METRICS)
+        {
+            LOC_U32Timed = HOST_BENCH_TOWER_PAIRS;
+        }
+
+        LOC_AF64Metrics[LOC_U8Index] = LOC_U32Timed ? (double)LOC_AU64Best[LOC_U8Index] / LOC_U32Timed : -1;
+    }
+    printf("Calculator_VOIDCalculation: %.1f ns/op, %.0f expressions/sec\n", LOC_AF64Metrics[0], 1e9 / LOC_AF64Metrics[0]);
+    for (LOC_U8Index = 1; LOC_U8Index < HOST_BENCH_METRICS; LOC_U8Index++)
+    {
+        if (LOC_AF64Metrics[LOC_U8Index] >= 0)
+        {
+            printf("  %-24s %10.1f ns/op\n", HOST_APCharMetrics[LOC_U8Index], LOC_AF64Metrics[LOC_U8Index]);
+        }
+    }
+
+    if (NULL != LOC_PCharOutput)
+    {
+        FILE *LOC_PFile = fopen(LOC_PCharOutput, "w");
+
+        if (NULL == LOC_PFile)
+        {
+            fprintf(stderr, "cannot write %s\n", LOC_PCharOutput);
+            return 1;
+        }
+        HOST_VOIDBenchWriteJson(LOC_PFile, &LOC_Config, LOC_AF64Metrics);
+        fclose(LOC_PFile);
+    }
+
+    free(LOC_PAU8Corpus);
+    free(LOC_PU8LegacyAgrees);
+
+    if (NULL != LOC_PCharBaseline)
+    {
+        switch (HOST_U8BenchCompare(LOC_PCharBaseline, LOC_AF64Metrics, LOC_F64Threshold))
+        {
+        case 1: return 3;
+        case 2: return 2;
+        default: break;
+        }
+    }
+
+    return (LOC_U32FixedMismatches || LOC_U32RationalMismatches || LOC_U32PowerMismatches || LOC_U32CordicMismatches
+            || LOC_U32FormatMismatches || LOC_U32ResultMismatches
+            || LOC_U32QueueMismatches) ? 4 : 0;
+}
+
+#endif
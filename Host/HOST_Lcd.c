@@ -0,0 +1,502 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Lcd.c
+ *
+ * Description: HD44780 model of the host build. A write is latched on the
+ *              falling edge of EN and starts an execution time during which
+ *              the controller is busy; any write before it ends is reported.
+ *              Setup times shorter than a register access cannot be seen, as
+ *              accesses take no simulated time. Not part of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdarg.h>
+#include <string.h>
+#include "HOST_Lcd.h"
+#include "../MCAL/BACKEND/MBACKEND_Interface.h"
+#include "../LIB/BIT_MATH.h"
+#include "../HAL/LCD/HLCD_CFG.h"
+
+/* Data space addresses of the LCD ports */
+#define HOST_LCD_DATA_PORT    (0x3B - 3 * DATA_PORT)
+#define HOST_LCD_DATA_DDR     (0x3A - 3 * DATA_PORT)
+#define HOST_LCD_DATA_PIN     (0x39 - 3 * DATA_PORT)
+#define HOST_LCD_CONTROL_PORT (0x3B - 3 * CONTROL_PORT)
+
+/* Violations kept word for word, the rest are only counted */
+#define HOST_LCD_MESSAGES 8
+
+/* Controller state: both DDRAM lines, CGRAM, address counter and the modes */
+static u8 HOST_AU8Ddram[2][40];
+static u8 HOST_AU8Cgram[64];
+static u8 HOST_U8Counter;
+static u8 HOST_U8CgramSelected;
+static u8 HOST_U8Increment;
+static u8 HOST_U8EntryShift;
+static u8 HOST_U8DisplayOn;
+static u8 HOST_U8TwoLines;
+static u8 HOST_U8Shift;
+
+/* Bus state: end of the running execution and the times of the last edges */
+static u64 HOST_U64BusyUntil;
+static u64 HOST_U64EnableRise;
+static u64 HOST_U64DataChange;
+static u8 HOST_U8EnableHigh;
+static u8 HOST_U8RiseSeen;
+
+/* Violations */
+static u32 HOST_U32Violations;
+static char HOST_AACharMessages[HOST_LCD_MESSAGES][112];
+
+/* Cost measurement between HOST_VOIDLcdCostBegin and HOST_VOIDLcdCostEnd */
+static HOST_LcdCostType HOST_StrCost;
+static u64 HOST_U64CostFirst, HOST_U64CostLast;
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdCostOccupy
+ * Description: Adds a stretch of bus or controller activity to the busy time,
+ *              the part overlapping activity already counted is skipped, e.g.
+ *              busy flag polls during an execution.
+ * Parameters:
+ *      - Copy_U64Start: Start of the stretch in nanoseconds
+ *      - Copy_U64End: End of the stretch in nanoseconds
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDLcdCostOccupy(u64 Copy_U64Start, u64 Copy_U64End)
+{
+    if (Copy_U64Start < HOST_U64CostLast)
+    {
+        Copy_U64Start = HOST_U64CostLast;
+    }
+    if (Copy_U64End > Copy_U64Start)
+    {
+        HOST_StrCost.BusyNs += Copy_U64End - Copy_U64Start;
+        HOST_U64CostLast = Copy_U64End;
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdViolation
+ * Description: Counts a violation and keeps its description if there is room.
+ * Parameters:
+ *      - Copy_PCharFormat: printf format of the description
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDLcdViolation(const char *Copy_PCharFormat, ...)
+{
+    va_list LOC_Arguments;
+
+    if (HOST_U32Violations < HOST_LCD_MESSAGES)
+    {
+        int LOC_Length = snprintf(HOST_AACharMessages[HOST_U32Violations], sizeof(HOST_AACharMessages[0]),
+                                  "t=%llu us: ", (unsigned long long)(MBACKEND_U64GetTimeNs() / 1000));
+
+        va_start(LOC_Arguments, Copy_PCharFormat);
+        vsnprintf(HOST_AACharMessages[HOST_U32Violations] + LOC_Length,
+                  sizeof(HOST_AACharMessages[0]) - LOC_Length, Copy_PCharFormat, LOC_Arguments);
+        va_end(LOC_Arguments);
+    }
+    HOST_U32Violations++;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdStep
+ * Description: Moves the address counter by one as the entry mode says, across
+ *              the gaps between the two DDRAM lines.
+ * Parameters:
+ *      - Copy_U8Increment: 1 to increment, 0 to decrement
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDLcdStep(u8 Copy_U8Increment)
+{
+    if (HOST_U8CgramSelected)
+    {
+        HOST_U8Counter = (HOST_U8Counter + (Copy_U8Increment ? 1 : 63)) & 0x3F;
+    }
+    else if (Copy_U8Increment)
+    {
+        HOST_U8Counter = (0x27 == HOST_U8Counter) ? 0x40 : (0x67 == HOST_U8Counter) ? 0x00 : HOST_U8Counter + 1;
+    }
+    else
+    {
+        HOST_U8Counter = (0x00 == HOST_U8Counter) ? 0x67 : (0x40 == HOST_U8Counter) ? 0x27 : HOST_U8Counter - 1;
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdShiftDisplay
+ * Description: Shifts both lines by one position, right moves the visible
+ *              window towards lower addresses.
+ * Parameters:
+ *      - Copy_U8Right: 1 to shift right, 0 to shift left
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDLcdShiftDisplay(u8 Copy_U8Right)
+{
+    HOST_U8Shift = (HOST_U8Shift + (Copy_U8Right ? 39 : 1)) % 40;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32LcdExecute
+ * Description: Carries out a write latched from the bus.
+ * Parameters:
+ *      - Copy_U8RegisterSelect: 0 for an instruction, 1 for data
+ *      - Copy_U8Data: The byte written
+ * Return:
+ *      - u32: Execution time in nanoseconds.
+ ******************************************************************************/
+static u32 HOST_U32LcdExecute(u8 Copy_U8RegisterSelect, u8 Copy_U8Data)
+{
+    if (Copy_U8RegisterSelect)
+    {
+        if (HOST_U8CgramSelected)
+        {
+            HOST_AU8Cgram[HOST_U8Counter] = Copy_U8Data & 0x1F;
+        }
+        else
+        {
+            if (!HOST_U8TwoLines)
+            {
+                HOST_VOIDLcdViolation("DDRAM write 0x%02X in one-line mode, not modelled", Copy_U8Data);
+            }
+            HOST_AU8Ddram[HOST_U8Counter >> 6][(HOST_U8Counter & 0x3F) % 40] = Copy_U8Data;
+            if (HOST_U8EntryShift)
+            {
+                HOST_VOIDLcdShiftDisplay(!HOST_U8Increment);
+            }
+        }
+        HOST_VOIDLcdStep(HOST_U8Increment);
+        return HOST_LCD_EXEC_DATA_NS;
+    }
+
+    if (Copy_U8Data & 0x80)
+    {
+        /* Set DDRAM Address */
+        HOST_U8CgramSelected = 0;
+        HOST_U8Counter = Copy_U8Data & 0x7F;
+        if ((HOST_U8Counter & 0x3F) >= 40)
+        {
+            HOST_VOIDLcdViolation("Set DDRAM Address 0x%02X outside both lines", HOST_U8Counter);
+            HOST_U8Counter &= 0x40;
+        }
+    }
+    else if (Copy_U8Data & 0x40)
+    {
+        /* Set CGRAM Address */
+        HOST_U8CgramSelected = 1;
+        HOST_U8Counter = Copy_U8Data & 0x3F;
+    }
+    else if (Copy_U8Data & 0x20)
+    {
+        /* Function Set */
+        if (!GET_BIT(Copy_U8Data, 4))
+        {
+            HOST_VOIDLcdViolation("Function Set 0x%02X selects the 4-bit interface, not modelled", Copy_U8Data);
+        }
+        HOST_U8TwoLines = GET_BIT(Copy_U8Data, 3);
+    }
+    else if (Copy_U8Data & 0x10)
+    {
+        /* Cursor or Display Shift */
+        if (GET_BIT(Copy_U8Data, 3))
+        {
+            HOST_VOIDLcdShiftDisplay(GET_BIT(Copy_U8Data, 2));
+        }
+        else
+        {
+            HOST_VOIDLcdStep(GET_BIT(Copy_U8Data, 2));
+        }
+    }
+    else if (Copy_U8Data & 0x08)
+    {
+        /* Display ON/OFF Control, cursor and blink are not drawn */
+        HOST_U8DisplayOn = GET_BIT(Copy_U8Data, 2);
+    }
+    else if (Copy_U8Data & 0x04)
+    {
+        /* Entry Mode Set */
+        HOST_U8Increment = GET_BIT(Copy_U8Data, 1);
+        HOST_U8EntryShift = GET_BIT(Copy_U8Data, 0);
+    }
+    else if (Copy_U8Data)
+    {
+        /* Return Home, Clear Display additionally blanks DDRAM and sets I/D */
+        if (0x01 == Copy_U8Data)
+        {
+            memset(HOST_AU8Ddram, ' ', sizeof(HOST_AU8Ddram));
+            HOST_U8Increment = 1;
+        }
+        HOST_U8CgramSelected = 0;
+        HOST_U8Counter = 0;
+        HOST_U8Shift = 0;
+        return HOST_LCD_EXEC_LONG_NS;
+    }
+
+    return HOST_LCD_EXEC_NS;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReset
+ * Description: Puts the model in its power-on state, powered up at the current
+ *              simulated time, and clears the timing violations.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReset(void)
+{
+    /* The internal reset clears the display and selects 8 bits, one line, display off */
+    memset(HOST_AU8Ddram, ' ', sizeof(HOST_AU8Ddram));
+    memset(HOST_AU8Cgram, 0, sizeof(HOST_AU8Cgram));
+    HOST_U8Counter = 0;
+    HOST_U8CgramSelected = 0;
+    HOST_U8Increment = 1;
+    HOST_U8EntryShift = 0;
+    HOST_U8DisplayOn = 0;
+    HOST_U8TwoLines = 0;
+    HOST_U8Shift = 0;
+
+    HOST_U64BusyUntil = MBACKEND_U64GetTimeNs() + HOST_LCD_POWER_ON_NS;
+    HOST_U8EnableHigh = 0;
+    HOST_U8RiseSeen = 0;
+    HOST_U64DataChange = 0;
+    HOST_U32Violations = 0;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdWriteHook
+ * Description: Follows the LCD control and data ports, to be called from the
+ *              backend write hook for every observed register write.
+ * Parameters:
+ *      - Copy_U8Address: Register written
+ *      - Copy_U8OldValue: Value before the write
+ *      - Copy_U8NewValue: Value after the write
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdWriteHook(u8 Copy_U8Address, u8 Copy_U8OldValue, u8 Copy_U8NewValue)
+{
+    u64 LOC_U64Now = MBACKEND_U64GetTimeNs();
+    u8 LOC_U8Changed = Copy_U8OldValue ^ Copy_U8NewValue;
+    u8 LOC_U8Read = GET_BIT(Copy_U8NewValue, RW_PIN);
+    u8 LOC_U8RegisterSelect = GET_BIT(Copy_U8NewValue, RS_PIN);
+
+    if (HOST_LCD_DATA_PORT == Copy_U8Address)
+    {
+        HOST_U64DataChange = LOC_U64Now;
+        return;
+    }
+    if (HOST_LCD_CONTROL_PORT != Copy_U8Address)
+    {
+        return;
+    }
+
+    if (HOST_U8EnableHigh && (GET_BIT(LOC_U8Changed, RS_PIN) || GET_BIT(LOC_U8Changed, RW_PIN)))
+    {
+        HOST_VOIDLcdViolation("RS or RW changed while EN is high");
+    }
+
+    if (!GET_BIT(LOC_U8Changed, EN_PIN))
+    {
+        return;
+    }
+
+    if (GET_BIT(Copy_U8NewValue, EN_PIN))
+    {
+        /* Rising edge, the cycle starts */
+        if (HOST_U8RiseSeen && LOC_U64Now - HOST_U64EnableRise < HOST_LCD_TCYCE_NS)
+        {
+            HOST_VOIDLcdViolation("enable cycle of %llu ns, at least %lu ns needed",
+                                  (unsigned long long)(LOC_U64Now - HOST_U64EnableRise), HOST_LCD_TCYCE_NS);
+        }
+        if (!LOC_U8Read && 0xFF != MBACKEND_U8Peek(HOST_LCD_DATA_DDR))
+        {
+            HOST_VOIDLcdViolation("write cycle with the data port not all outputs");
+        }
+        if (LOC_U8Read && 0x00 != MBACKEND_U8Peek(HOST_LCD_DATA_DDR))
+        {
+            HOST_VOIDLcdViolation("read cycle while the data port still drives the bus");
+        }
+        HOST_U64EnableRise = LOC_U64Now;
+        HOST_U8EnableHigh = 1;
+        HOST_U8RiseSeen = 1;
+        return;
+    }
+
+    /* Falling edge, the cycle completes */
+    HOST_U8EnableHigh = 0;
+    if (LOC_U64Now - HOST_U64EnableRise < HOST_LCD_PWEH_NS)
+    {
+        HOST_VOIDLcdViolation("EN high for %llu ns, at least %lu ns needed",
+                              (unsigned long long)(LOC_U64Now - HOST_U64EnableRise), HOST_LCD_PWEH_NS);
+    }
+
+    if (0 == HOST_StrCost.Writes + HOST_StrCost.Reads)
+    {
+        HOST_U64CostFirst = HOST_U64EnableRise;
+    }
+
+    if (LOC_U8Read)
+    {
+        /* A data read moves the address counter, a busy flag read does not */
+        if (LOC_U8RegisterSelect)
+        {
+            HOST_VOIDLcdStep(HOST_U8Increment);
+        }
+        HOST_StrCost.Reads++;
+        HOST_VOIDLcdCostOccupy(HOST_U64EnableRise, LOC_U64Now);
+    }
+    else
+    {
+        u8 LOC_U8Data = MBACKEND_U8Peek(HOST_LCD_DATA_PORT);
+        u32 LOC_U32Execution;
+
+        if (LOC_U64Now - HOST_U64DataChange < HOST_LCD_TDSW_NS)
+        {
+            HOST_VOIDLcdViolation("data 0x%02X set up %llu ns before EN fell, at least %lu ns needed", LOC_U8Data,
+                                  (unsigned long long)(LOC_U64Now - HOST_U64DataChange), HOST_LCD_TDSW_NS);
+        }
+        if (LOC_U64Now < HOST_U64BusyUntil)
+        {
+            HOST_VOIDLcdViolation("%s 0x%02X written %llu ns before the previous one finished",
+                                  LOC_U8RegisterSelect ? "data" : "instruction", LOC_U8Data,
+                                  (unsigned long long)(HOST_U64BusyUntil - LOC_U64Now));
+        }
+
+        LOC_U32Execution = HOST_U32LcdExecute(LOC_U8RegisterSelect, LOC_U8Data);
+        HOST_U64BusyUntil = LOC_U64Now + LOC_U32Execution;
+
+        HOST_StrCost.Writes++;
+        HOST_VOIDLcdCostOccupy(HOST_U64EnableRise, HOST_U64BusyUntil);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReadHook
+ * Description: Drives the data port during a read cycle, to be called from the
+ *              backend read hook for every register read.
+ * Parameters:
+ *      - Copy_U8Address: Register being read
+ *      - Copy_PU8Value: Value the firmware will see
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReadHook(u8 Copy_U8Address, u8 *Copy_PU8Value)
+{
+    u8 LOC_U8Control = MBACKEND_U8Peek(HOST_LCD_CONTROL_PORT);
+
+    if (HOST_LCD_DATA_PIN != Copy_U8Address || !HOST_U8EnableHigh || !GET_BIT(LOC_U8Control, RW_PIN))
+    {
+        return;
+    }
+
+    if (GET_BIT(LOC_U8Control, RS_PIN))
+    {
+        *Copy_PU8Value = HOST_U8CgramSelected ? HOST_AU8Cgram[HOST_U8Counter]
+                                              : HOST_AU8Ddram[HOST_U8Counter >> 6][(HOST_U8Counter & 0x3F) % 40];
+    }
+    else
+    {
+        /* Busy flag in DB7 over the address counter */
+        *Copy_PU8Value = HOST_U8Counter | ((MBACKEND_U64GetTimeNs() < HOST_U64BusyUntil) ? 0x80 : 0x00);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdCostBegin
+ * Description: Starts measuring the bus cycles made from now on.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdCostBegin(void)
+{
+    memset(&HOST_StrCost, 0, sizeof(HOST_StrCost));
+    HOST_U64CostFirst = 0;
+    HOST_U64CostLast = 0;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdCostEnd
+ * Description: Returns the bus cycles made since HOST_VOIDLcdCostBegin.
+ * Parameters:
+ *      - Copy_PStrCost: Receives the cost
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdCostEnd(HOST_LcdCostType *Copy_PStrCost)
+{
+    HOST_StrCost.SpanNs = (HOST_StrCost.Writes + HOST_StrCost.Reads) ? HOST_U64CostLast - HOST_U64CostFirst : 0;
+    *Copy_PStrCost = HOST_StrCost;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdRender
+ * Description: Prints the visible 2x16 window.
+ * Parameters:
+ *      - Copy_PFile: Where to print
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdRender(FILE *Copy_PFile)
+{
+    u8 LOC_U8Row, LOC_U8Column;
+
+    fputs("+----------------+\n", Copy_PFile);
+    for (LOC_U8Row = 0; LOC_U8Row < 2; LOC_U8Row++)
+    {
+        fputc('|', Copy_PFile);
+        for (LOC_U8Column = 0; LOC_U8Column < 16; LOC_U8Column++)
+        {
+            u8 LOC_U8Char = HOST_AU8Ddram[LOC_U8Row][(HOST_U8Shift + LOC_U8Column) % 40];
+
+            if (!HOST_U8DisplayOn || (LOC_U8Char >= 0x80 && LOC_U8Char <= 0xA0))
+            {
+                LOC_U8Char = ' ';
+            }
+            else if (LOC_U8Char < 0x10)
+            {
+                LOC_U8Char = '#';
+            }
+            else if (LOC_U8Char < ' ' || LOC_U8Char > 0x7D)
+            {
+                LOC_U8Char = '?';
+            }
+            fputc(LOC_U8Char, Copy_PFile);
+        }
+        fputs("|\n", Copy_PFile);
+    }
+    fputs("+----------------+\n", Copy_PFile);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32LcdViolations
+ * Description: Returns the number of timing and protocol violations so far.
+ * Parameters: None
+ * Return:
+ *      - u32: Number of violations.
+ ******************************************************************************/
+u32 HOST_U32LcdViolations(void)
+{
+    return HOST_U32Violations;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReport
+ * Description: Prints the number of violations and the first ones in detail.
+ * Parameters:
+ *      - Copy_PFile: Where to print
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReport(FILE *Copy_PFile)
+{
+    u32 LOC_U32Index;
+
+    fprintf(Copy_PFile, "LCD timing violations: %lu\n", (unsigned long)HOST_U32Violations);
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Violations && LOC_U32Index < HOST_LCD_MESSAGES; LOC_U32Index++)
+    {
+        fprintf(Copy_PFile, "  %s\n", HOST_AACharMessages[LOC_U32Index]);
+    }
+}
+
+#endif
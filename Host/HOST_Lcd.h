@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Lcd.h
+ *
+ * Description: Header file for the HD44780 model of the host build. It sits
+ *              on the simulated LCD ports through the backend hooks, keeps
+ *              DDRAM, CGRAM, the address counter, entry mode and display
+ *              shift like the controller does, answers busy flag reads, and
+ *              checks every bus cycle against the datasheet timing.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _HOST_LCD_H_
+#define _HOST_LCD_H_
+
+#include <stdio.h>
+#include "../LIB/STD_TYPES.h"
+
+/* Execution times at the nominal 270 kHz oscillator, in nanoseconds */
+#define HOST_LCD_EXEC_NS       37000UL   /* Most instructions */
+#define HOST_LCD_EXEC_DATA_NS  41000UL   /* Data write, 37 us plus the 4 us address update */
+#define HOST_LCD_EXEC_LONG_NS  1520000UL /* Clear Display and Return Home */
+
+/* Bus timing of a write cycle, in nanoseconds */
+#define HOST_LCD_PWEH_NS  450UL   /* Minimum EN high time */
+#define HOST_LCD_TCYCE_NS 1000UL  /* Minimum time between EN rising edges */
+#define HOST_LCD_TDSW_NS  195UL   /* Minimum data setup time before EN falls */
+
+/* Internal reset time after power-on, no instruction is accepted before it */
+#define HOST_LCD_POWER_ON_NS 15000000UL
+
+/************************************************************************************
+ * Description: Bus cost of a stretch of firmware, see HOST_VOIDLcdCostBegin.
+ ************************************************************************************/
+typedef struct
+{
+    u32 Writes;     /* Instructions and data bytes written */
+    u32 Reads;      /* Busy flag and data reads */
+    u64 BusyNs;     /* Time the bus or the controller was occupied: EN pulses and execution times */
+    u64 SpanNs;     /* From the first EN rising edge to the end of the last execution */
+} HOST_LcdCostType;
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReset
+ * Description: Puts the model in its power-on state, powered up at the current
+ *              simulated time, and clears the timing violations.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReset(void);
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdWriteHook
+ * Description: Follows the LCD control and data ports, to be called from the
+ *              backend write hook for every observed register write.
+ * Parameters:
+ *      - Copy_U8Address: Register written
+ *      - Copy_U8OldValue: Value before the write
+ *      - Copy_U8NewValue: Value after the write
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdWriteHook(u8 Copy_U8Address, u8 Copy_U8OldValue, u8 Copy_U8NewValue);
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReadHook
+ * Description: Drives the data port during a read cycle, to be called from the
+ *              backend read hook for every register read.
+ * Parameters:
+ *      - Copy_U8Address: Register being read
+ *      - Copy_PU8Value: Value the firmware will see
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReadHook(u8 Copy_U8Address, u8 *Copy_PU8Value);
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdCostBegin / HOST_VOIDLcdCostEnd
+ * Description: Measure the bus cycles made between the two calls.
+ * Parameters:
+ *      - Copy_PStrCost: Receives the cost (End only)
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdCostBegin(void);
+void HOST_VOIDLcdCostEnd(HOST_LcdCostType *Copy_PStrCost);
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdRender
+ * Description: Prints the visible 2x16 window. CGRAM characters are shown as
+ *              '#', the blank codes of the A00 character ROM as spaces.
+ * Parameters:
+ *      - Copy_PFile: Where to print
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdRender(FILE *Copy_PFile);
+
+/******************************************************************************
+ * Function Name: HOST_U32LcdViolations
+ * Description: Returns the number of timing and protocol violations so far.
+ * Parameters: None
+ * Return:
+ *      - u32: Number of violations.
+ ******************************************************************************/
+u32 HOST_U32LcdViolations(void);
+
+/******************************************************************************
+ * Function Name: HOST_VOIDLcdReport
+ * Description: Prints the number of violations and the first ones in detail.
+ * Parameters:
+ *      - Copy_PFile: Where to print
+ * Return: None
+ ******************************************************************************/
+void HOST_VOIDLcdReport(FILE *Copy_PFile);
+
+#endif /* _HOST_LCD_H_ */
@@ -0,0 +1,445 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Main.c
+ *
+ * Description: Entry point of the host build. Runs the unchanged drivers and
+ *              calculator on the host backend: a keypad model presses the
+ *              keys given on the command line, the HD44780 model of
+ *              HOST_Lcd.c follows the LCD bus, and the final screen, the bus
+ *              cost per key and any timing violation are printed. The DIO
+ *              trace can be saved as a VCD waveform and the cycle profile of
+ *              the instrumented regions printed. Not part of AVR builds, see
+ *              main.c for the firmware.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../Application/Calculator_Interface.h"
+#include "HOST_Trace.h"
+#include "HOST_Lcd.h"
+
+/* Data space addresses of the PORT and PIN registers of a port */
+#define HOST_PORT_ADDRESS(port) (0x3B - 3 * (port))
+#define HOST_PIN_ADDRESS(port)  (0x39 - 3 * (port))
+
+/* Keypad layout as wired to PORTA, indexed by row * 4 + column, and its second
+ * layer reached through the shift key HKPD_SHIFT_KEY, as HKPD_AU8ShiftKeymap */
+static const char HOST_AU8Keymap[] = "789/456*123-C0=+";
+static const char HOST_AU8ShiftKeymap[] =
+#if HKPD_SHIFT_FUNCTIONS == 1
+    "sca%elr^"
+#else
+    "789%456^"
+#endif
+#if HKPD_SHIFT_POINT == 1
+    "123-C.=+";
+#else
+    "123-C0=+";
+#endif
+
+/* Keys held down on the keypad model, bit (row * 4 + column) set for each */
+static u16 HOST_U16HeldKeys;
+
+/******************************************************************************
+ * Function Name: HOST_VOIDKeypadRead
+ * Description: Read hook driving the row inputs of PORTA. The rows are pulled
+ *              up, a held key pulls its row LOW while its column is LOW.
+ * Parameters:
+ *      - Copy_U8Address: Register being read
+ *      - Copy_PU8Value: Value the firmware will see
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDKeypadRead(u8 Copy_U8Address, u8 *Copy_PU8Value)
+{
+    if (HOST_PIN_ADDRESS(0) == Copy_U8Address)
+    {
+        u8 LOC_U8Port = MBACKEND_U8Peek(HOST_PORT_ADDRESS(0));
+        u8 LOC_U8Pin = LOC_U8Port | 0xF0;
+        u8 LOC_U8Key;
+
+        for (LOC_U8Key = 0; LOC_U8Key < 16; LOC_U8Key++)
+        {
+            if (GET_BIT(HOST_U16HeldKeys, LOC_U8Key) && !GET_BIT(LOC_U8Port, LOC_U8Key % 4))
+            {
+                CLR_BIT(LOC_U8Pin, (4 + LOC_U8Key / 4));
+            }
+        }
+        *Copy_PU8Value = LOC_U8Pin;
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDReadHook
+ * Description: Read hook of the backend, both models drive their own pins.
+ * Parameters:
+ *      - Copy_U8Address: Register being read
+ *      - Copy_PU8Value: Value the firmware will see
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDReadHook(u8 Copy_U8Address, u8 *Copy_PU8Value)
+{
+    HOST_VOIDKeypadRead(Copy_U8Address, Copy_PU8Value);
+    HOST_VOIDLcdReadHook(Copy_U8Address, Copy_PU8Value);
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDRun
+ * Description: Runs the main loop of main.c for a stretch of simulated time.
+ * Parameters:
+ *      - Copy_PStrStream: Streaming session of the calculator
+ *      - Copy_U16Milliseconds: Simulated time to run for
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDRun(Calculator_StreamType *Copy_PStrStream, u16 Copy_U16Milliseconds)
+{
+    u32 LOC_U32Step;
+    u8 LOC_U8KeyEvent;
+
+    for (LOC_U32Step = 0; LOC_U32Step < (u32)Copy_U16Milliseconds * 10; LOC_U32Step++)
+    {
+        /* The firmware polls for events, a poll is far shorter than this step */
+        _delay_us(100);
+
+        if (HKPD_U8GetEvent(&LOC_U8KeyEvent) && !(LOC_U8KeyEvent & HKPD_EVENT_RELEASE)
+            && HKPD_EVENT_GHOST != LOC_U8KeyEvent)
+        {
+            MPROFILE_LATENCY_CONSUME(LOC_U8KeyEvent);
+            Calculator_VOIDStreamFeed(Copy_PStrStream, LOC_U8KeyEvent);
+            MPROFILE_LATENCY_EVALUATED();
+            HLCD_VOIDFlush();
+            MPROFILE_LATENCY_FLUSHED();
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDWaitIdle
+ * Description: Lets simulated time pass until the LCD queue has drained and
+ *              the last instruction has been executed.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDWaitIdle(void)
+{
+    u16 LOC_U16Steps;
+
+    for (LOC_U16Steps = 0; LOC_U16Steps < 1000 && !HLCD_U8IsIdle(); LOC_U16Steps++)
+    {
+        _delay_us(100);
+    }
+    _delay_ms(2);
+}
+
+/* HLCD calls measured by the -l option, each with fixed arguments */
+static void HOST_VOIDApiSendCharacter(void)    { HLCD_VOIDSendCharacter('A'); }
+static void HOST_VOIDApiSendString(void)       { HLCD_VOIDSendString((u8 *)"Hello"); }
+static void HOST_VOIDApiSendNumber(void)       { HLCD_VOIDSendNumber(1234567); }
+static void HOST_VOIDApiSetPosition(void)      { HLCD_VOIDSetPosition(1, 4); }
+static void HOST_VOIDApiShiftCursorRight(void) { HLCD_VOIDShiftCursorRight(); }
+static void HOST_VOIDApiShiftCursorLeft(void)  { HLCD_VOIDShiftCursorLeft(); }
+static void HOST_VOIDApiShiftDisplayLeft(void) { HLCD_VOIDShiftDisplayLeft(1); }
+static void HOST_VOIDApiShiftDisplayRight(void){ HLCD_VOIDShiftDisplayRight(1); }
+static void HOST_VOIDApiDeleteCharacter(void)  { HLCD_VOIDDeleteCharacter(2); }
+static void HOST_VOIDApiClearDisplay(void)     { HLCD_VOIDClearDisplay(); }
+static void HOST_VOIDApiDrawPattern(void)      { HLCD_VOIDDrawPattern(); }
+static void HOST_VOIDApiSendCommand(void)      { HLCD_VOIDSendCommand(0b00000010); }
+
+static const struct
+{
+    const char *Name;
+    void (*Call)(void);
+} HOST_AStrApi[] =
+{
+    { "SendCharacter('A')",   HOST_VOIDApiSendCharacter },
+    { "SendString(\"Hello\")", HOST_VOIDApiSendString },
+    { "SendNumber(1234567)",  HOST_VOIDApiSendNumber },
+    { "SetPosition(1, 4)",    HOST_VOIDApiSetPosition },
+    { "ShiftCursorRight()",   HOST_VOIDApiShiftCursorRight },
+    { "ShiftCursorLeft()",    HOST_VOIDApiShiftCursorLeft },
+    { "ShiftDisplayLeft(1)",  HOST_VOIDApiShiftDisplayLeft },
+    { "ShiftDisplayRight(1)", HOST_VOIDApiShiftDisplayRight },
+    { "DeleteCharacter(2)",   HOST_VOIDApiDeleteCharacter },
+    { "ClearDisplay()",       HOST_VOIDApiClearDisplay },
+    { "DrawPattern()",        HOST_VOIDApiDrawPattern },
+    { "SendCommand(home)",    HOST_VOIDApiSendCommand },
+};
+
+/******************************************************************************
+ * Function Name: HOST_VOIDApiCosts
+ * Description: Calls every entry of HOST_AStrApi followed by HLCD_VOIDFlush and
+ *              prints the bus cost of each until the LCD is idle again.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDApiCosts(void)
+{
+    HOST_LcdCostType LOC_Cost;
+    u8 LOC_U8Index;
+
+    printf("%-22s %6s %6s %10s %10s\n", "HLCD call", "writes", "reads", "busy us", "span us");
+    for (LOC_U8Index = 0; LOC_U8Index < sizeof(HOST_AStrApi) / sizeof(HOST_AStrApi[0]); LOC_U8Index++)
+    {
+        HOST_VOIDLcdCostBegin();
+        HOST_AStrApi[LOC_U8Index].Call();
+        HLCD_VOIDFlush();
+        HOST_VOIDWaitIdle();
+        HOST_VOIDLcdCostEnd(&LOC_Cost);
+
+        printf("%-22s %6lu %6lu %10.1f %10.1f\n", HOST_AStrApi[LOC_U8Index].Name,
+               (unsigned long)LOC_Cost.Writes, (unsigned long)LOC_Cost.Reads,
+               LOC_Cost.BusyNs / 1000.0, LOC_Cost.SpanNs / 1000.0);
+    }
+}
+
+#if MPROFILE_ENABLE == 1
+/******************************************************************************
+ * Function Name: HOST_VOIDProfileReport
+ * Description: Prints the record of every profiled region. The cycles come
+ *              from the simulated clock, which only advances in delays, so
+ *              they are the time spent waiting on the hardware.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDProfileReport(void)
+{
+    MPROFILE_RecordType LOC_Record;
+    u8 LOC_U8Name[MPROFILE_NAME_SIZE];
+    u8 LOC_U8Region;
+
+    printf("%-12s %8s %12s %10s %10s\n", "region", "calls", "cycles", "average", "max");
+    for (LOC_U8Region = 0; LOC_U8Region < MPROFILE_REGIONS; LOC_U8Region++)
+    {
+        MPROFILE_VOIDGetRecord(LOC_U8Region, &LOC_Record);
+        MPROFILE_VOIDGetName(LOC_U8Region, LOC_U8Name);
+        printf("%-12s %8lu %12lu %10.1f %10lu\n", (char *)LOC_U8Name, (unsigned long)LOC_Record.Calls,
+               (unsigned long)LOC_Record.TotalCycles,
+               LOC_Record.Calls ? (double)LOC_Record.TotalCycles / LOC_Record.Calls : 0.0,
+               (unsigned long)LOC_Record.MaxCycles);
+    }
+}
+#endif
+
+#if MPROFILE_LATENCY == 1
+/******************************************************************************
+ * Function Name: HOST_U8LatencyReport
+ * Description: Prints the p50, p95 and p99 latency of every stage for each
+ *              kind of key, and checks the time to the last LCD write against
+ *              a limit. The values are bucket bounds, see MPROFILE_CFG.h.
+ * Parameters:
+ *      - Copy_U8Print: 1 to print the table, 0 to only check the limit
+ *      - Copy_U32LimitUs: Largest p99 allowed until the last LCD write, 0 for none
+ * Return:
+ *      - u8: 1 if a kind of key is over the limit, 0 otherwise.
+ ******************************************************************************/
+static u8 HOST_U8LatencyReport(u8 Copy_U8Print, u32 Copy_U32LimitUs)
+{
+    static const char *const HOST_AStrStages[MPROFILE_STAGES] = { "accepted", "consumed", "evaluated", "displayed" };
+    static const u8 HOST_AU8Percents[] = { 50, 95, 99 };
+    u8 LOC_U8Name[MPROFILE_NAME_SIZE];
+    u8 LOC_U8Class, LOC_U8Stage, LOC_U8Percent, LOC_U8Over = 0;
+    u16 LOC_U16P99;
+    char LOC_ACharCell[24];
+
+    if (Copy_U8Print)
+    {
+        printf("key latency from the first scan, p50/p95/p99 in us\n%-8s %7s", "key", "presses");
+        for (LOC_U8Stage = 0; LOC_U8Stage < MPROFILE_STAGES; LOC_U8Stage++)
+        {
+            printf(" %17s", HOST_AStrStages[LOC_U8Stage]);
+        }
+        printf("\n");
+    }
+
+    for (LOC_U8Class = 0; LOC_U8Class < MPROFILE_CLASSES; LOC_U8Class++)
+    {
+        if (Copy_U8Print)
+        {
+            MPROFILE_VOIDLatencyGetName(LOC_U8Class, LOC_U8Name);
+            printf("%-8s %7u", (char *)LOC_U8Name, MPROFILE_U16LatencyCount(LOC_U8Class));
+            for (LOC_U8Stage = 0; LOC_U8Stage < MPROFILE_STAGES; LOC_U8Stage++)
+            {
+                LOC_ACharCell[0] = '\0';
+                for (LOC_U8Percent = 0; LOC_U8Percent < sizeof(HOST_AU8Percents); LOC_U8Percent++)
+                {
+                    snprintf(LOC_ACharCell + strlen(LOC_ACharCell), sizeof(LOC_ACharCell) - strlen(LOC_ACharCell),
+                             LOC_U8Percent ? "/%u" : "%u",
+                             MPROFILE_U16LatencyPercentile(LOC_U8Class, LOC_U8Stage, HOST_AU8Percents[LOC_U8Percent]));
+                }
+                printf(" %17s", LOC_ACharCell);
+            }
+            printf("\n");
+        }
+
+        LOC_U16P99 = MPROFILE_U16LatencyPercentile(LOC_U8Class, MPROFILE_STAGE_DISPLAYED, 99);
+        if (Copy_U32LimitUs && LOC_U16P99 > Copy_U32LimitUs)
+        {
+            MPROFILE_VOIDLatencyGetName(LOC_U8Class, LOC_U8Name);
+            printf("latency limit exceeded: %s p99 %u us > %lu us\n", (char *)LOC_U8Name, LOC_U16P99,
+                   (unsigned long)Copy_U32LimitUs);
+            LOC_U8Over = 1;
+        }
+    }
+
+    return LOC_U8Over;
+}
+#endif
+
+/******************************************************************************
+ * Function Name: main
+ * Description: Presses the keys of the last argument one after the other and
+ *              prints the visible part of the display when they are done, with
+ *              the LCD bus cost per key, or with -l the cost of each HLCD call.
+ * Parameters:
+ *      - argc: Number of arguments
+ *      - argv: Optionally "-t <file.vcd>" to save the DIO trace, "-p" to
+ *              print the cycle profile and the key latency, "-m <us>" to limit
+ *              the p99 latency to the last LCD write, then either the keys to
+ *              press, e.g. "12+3*4=", or -l. Keys of the second layer such as
+ *              '^' are pressed while the shift key is held.
+ * Returns:
+ *      - int: 0 on success, 1 for bad arguments, an unknown key or a failed
+ *             write, 2 when the LCD model saw a timing violation, 3 when a
+ *             kind of key is over the latency limit.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    Calculator_StreamType LOC_Stream;
+    HOST_LcdCostType LOC_KeyCost;
+    u64 LOC_U64Writes = 0, LOC_U64BusyNs = 0, LOC_U64WorstSpanNs = 0;
+    u32 LOC_U32Keys = 0;
+    const char *LOC_PCharKey;
+    const char *LOC_PCharTrace = NULL;
+    u8 LOC_U8Profile = 0, LOC_U8Slow = 0;
+    u32 LOC_U32LimitUs = 0;
+    int LOC_Argument = 1;
+
+    /* Keys may start with '-', so only the exact options are taken */
+    while (LOC_Argument < argc - 1)
+    {
+        if (0 == strcmp(argv[LOC_Argument], "-t") && LOC_Argument + 2 < argc)
+        {
+            LOC_PCharTrace = argv[LOC_Argument + 1];
+            LOC_Argument += 2;
+        }
+        else if (0 == strcmp(argv[LOC_Argument], "-m") && LOC_Argument + 2 < argc)
+        {
+            LOC_U32LimitUs = (u32)strtoul(argv[LOC_Argument + 1], NULL, 10);
+            LOC_Argument += 2;
+        }
+        else if (0 == strcmp(argv[LOC_Argument], "-p"))
+        {
+            LOC_U8Profile = 1;
+            LOC_Argument++;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (LOC_Argument != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-t trace.vcd] [-p] [-m max_us] <keys> | -l\n", argv[0]);
+        return 1;
+    }
+
+    MBACKEND_VOIDSetReadHook(HOST_VOIDReadHook);
+    MBACKEND_VOIDSetWriteHook(HOST_VOIDLcdWriteHook);
+#if MDIO_TRACE == 1
+    MDIO_VOIDTraceClear();
+#endif
+
+    HOST_VOIDLcdReset();
+#if MPROFILE_ACTIVE == 1
+    MPROFILE_VOIDInitialization();
+#endif
+    HLCD_VOIDInitialization();
+    HKPD_VOIDInitialization();
+    Calculator_VOIDStreamReset(&LOC_Stream);
+
+    if (0 == strcmp(argv[argc - 1], "-l"))
+    {
+        HOST_VOIDApiCosts();
+    }
+    else
+    {
+        for (LOC_PCharKey = argv[argc - 1]; *LOC_PCharKey; LOC_PCharKey++)
+        {
+            const char *LOC_PCharFound = strchr(HOST_AU8Keymap, *LOC_PCharKey);
+            const char *LOC_PCharShifted = strchr(HOST_AU8ShiftKeymap, *LOC_PCharKey);
+
+            if (NULL == LOC_PCharFound && (NULL == LOC_PCharShifted || HKPD_SHIFT_NONE == HKPD_SHIFT_KEY))
+            {
+                fprintf(stderr, "unknown key '%c'\n", *LOC_PCharKey);
+                return 1;
+            }
+
+            /* Hold each key well past the debounce time, then release it as long */
+            HOST_VOIDLcdCostBegin();
+            if (NULL == LOC_PCharFound)
+            {
+                /* A key of the second layer is pressed and released while shift is held */
+                HOST_U16HeldKeys = 1U << HKPD_SHIFT_KEY;
+                HOST_VOIDRun(&LOC_Stream, 40);
+                SET_BIT(HOST_U16HeldKeys, (LOC_PCharShifted - HOST_AU8ShiftKeymap));
+                HOST_VOIDRun(&LOC_Stream, 40);
+                HOST_U16HeldKeys = 1U << HKPD_SHIFT_KEY;
+                HOST_VOIDRun(&LOC_Stream, 40);
+            }
+            else
+            {
+                HOST_U16HeldKeys = 1U << (LOC_PCharFound - HOST_AU8Keymap);
+                HOST_VOIDRun(&LOC_Stream, 40);
+            }
+            HOST_U16HeldKeys = 0;
+            HOST_VOIDRun(&LOC_Stream, 40);
+            HOST_VOIDLcdCostEnd(&LOC_KeyCost);
+
+            LOC_U32Keys++;
+            LOC_U64Writes += LOC_KeyCost.Writes;
+            LOC_U64BusyNs += LOC_KeyCost.BusyNs;
+            if (LOC_KeyCost.SpanNs > LOC_U64WorstSpanNs)
+            {
+                LOC_U64WorstSpanNs = LOC_KeyCost.SpanNs;
+            }
+        }
+
+        /* Let the LCD queue drain */
+        HOST_VOIDRun(&LOC_Stream, 20);
+    }
+
+    HOST_VOIDLcdRender(stdout);
+    if (LOC_U32Keys)
+    {
+        printf("LCD per key: %.1f writes, %.1f us busy on average, %.1f us worst span\n",
+               (double)LOC_U64Writes / LOC_U32Keys, LOC_U64BusyNs / 1000.0 / LOC_U32Keys,
+               LOC_U64WorstSpanNs / 1000.0);
+    }
+    printf("simulated time: %llu us\n", (unsigned long long)(MBACKEND_U64GetTimeNs() / 1000));
+    HOST_VOIDLcdReport(stdout);
+#if MPROFILE_ENABLE == 1
+    if (LOC_U8Profile)
+    {
+        HOST_VOIDProfileReport();
+    }
+#endif
+#if MPROFILE_LATENCY == 1
+    LOC_U8Slow = HOST_U8LatencyReport(LOC_U8Profile, LOC_U32LimitUs);
+#endif
+
+    if (NULL != LOC_PCharTrace && !HOST_U8TraceWriteVcd(LOC_PCharTrace))
+    {
+        return 1;
+    }
+
+    return HOST_U32LcdViolations() ? 2 : (LOC_U8Slow ? 3 : 0);
+}
+
+#endif
@@ -0,0 +1,418 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_SimAvr.c
+ *
+ * Description: Cycle-accurate latency benchmark of the firmware image. Runs
+ *              the ELF built by Release/makefile on the simavr ATmega32 core,
+ *              types every expression of a corpus on a virtual 4x4 keypad
+ *              wired to PORTA and counts the CPU cycles from the '=' press to
+ *              the last byte written to the LCD. Each expression starts from
+ *              a reset of the core. Keys of the shift layer are typed as the
+ *              shift key held around them; the shift key itself acts on its
+ *              release, which is then where its latency starts. Needs
+ *              libsimavr, see "make simbench". Not part of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "avr_ioport.h"
+#include "../LIB/STD_TYPES.h"
+#include "../LIB/BIT_MATH.h"
+#include "../HAL/LCD/HLCD_CFG.h"
+#include "../HAL/KeyPad/HKPD_CFG.h"
+
+/* Clock of the firmware, also used when the ELF does not record one */
+#define HOST_SIM_FREQUENCY 8000000UL
+
+/* Cycles per millisecond of simulated time */
+#define HOST_SIM_CYCLES_PER_MS (HOST_SIM_FREQUENCY / 1000)
+
+/* Key timing, well past the debounce time of the keypad driver */
+#define HOST_SIM_HOLD_MS    40
+#define HOST_SIM_RELEASE_MS 40
+
+/* After '=' the run ends once the LCD has been quiet this long, or at the limit */
+#define HOST_SIM_QUIET_MS 20
+#define HOST_SIM_LIMIT_MS 1000
+
+/* Longest corpus line and largest corpus */
+#define HOST_SIM_LINE   64
+#define HOST_SIM_CORPUS 256
+
+/* Keypad layout as wired to PORTA, indexed by row * 4 + column */
+static const char HOST_AU8Keymap[] = "789/456*123-C0=+";
+
+/* Second layer of the keypad with the point and the functions, typed with HKPD_SHIFT_KEY
+ * held. The simulated image may be built without them, it then reads their first value. */
+static const char HOST_AU8ShiftKeymap[] = "sca%elr^123-C.=+";
+
+/* Every key a corpus may use, the last nine only through the shift layer */
+static const char HOST_AU8CorpusKeys[] = "789/456*123-C0=+%^.scaelr";
+
+/* The simulated core and the row inputs of the keypad */
+static avr_t *HOST_PStrAvr;
+static avr_irq_t *HOST_APStrRows[4];
+
+/* Keys held down on the keypad, one bit per row * 4 + column, and the last PORTA value */
+static u16 HOST_U16HeldKeys;
+static u8 HOST_U8KeypadPort = 0xFF;
+
+/* LCD bus: level of RW and the cycle of the last completed write */
+static u8 HOST_U8LcdRead;
+static u64 HOST_U64LcdLastWrite;
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSimDriveRows
+ * Description: Drives the row inputs of PORTA from the held keys and the
+ *              columns the firmware pulls LOW. Rows are pulled up.
+ * Parameters: None
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSimDriveRows(void)
+{
+    u8 LOC_U8Row, LOC_U8Column;
+
+    for (LOC_U8Row = 0; LOC_U8Row < 4; LOC_U8Row++)
+    {
+        u8 LOC_U8Low = 0;
+
+        for (LOC_U8Column = 0; LOC_U8Column < 4; LOC_U8Column++)
+        {
+            LOC_U8Low |= GET_BIT(HOST_U16HeldKeys, (LOC_U8Row * 4 + LOC_U8Column)) && !GET_BIT(HOST_U8KeypadPort, LOC_U8Column);
+        }
+        avr_raise_irq(HOST_APStrRows[LOC_U8Row], !LOC_U8Low);
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSimKeypadPort
+ * Description: Notified on every PORTA write, the scan drives one column LOW
+ *              at a time.
+ * Parameters:
+ *      - Copy_PStrIrq: The PORT register IRQ
+ *      - Copy_U32Value: New value of PORTA
+ *      - Copy_PVoidParam: Unused
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSimKeypadPort(avr_irq_t *Copy_PStrIrq, uint32_t Copy_U32Value, void *Copy_PVoidParam)
+{
+    (void)Copy_PStrIrq;
+    (void)Copy_PVoidParam;
+
+    HOST_U8KeypadPort = (u8)Copy_U32Value;
+    HOST_VOIDSimDriveRows();
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSimLcdReadWrite
+ * Description: Notified when the RW line of the LCD changes.
+ * Parameters:
+ *      - Copy_PStrIrq: The RW pin IRQ
+ *      - Copy_U32Value: New level
+ *      - Copy_PVoidParam: Unused
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSimLcdReadWrite(avr_irq_t *Copy_PStrIrq, uint32_t Copy_U32Value, void *Copy_PVoidParam)
+{
+    (void)Copy_PStrIrq;
+    (void)Copy_PVoidParam;
+
+    HOST_U8LcdRead = (u8)Copy_U32Value;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSimLcdEnable
+ * Description: Notified when the EN line of the LCD changes, a write is
+ *              latched on the falling edge with RW LOW.
+ * Parameters:
+ *      - Copy_PStrIrq: The EN pin IRQ
+ *      - Copy_U32Value: New level
+ *      - Copy_PVoidParam: Unused
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSimLcdEnable(avr_irq_t *Copy_PStrIrq, uint32_t Copy_U32Value, void *Copy_PVoidParam)
+{
+    (void)Copy_PStrIrq;
+    (void)Copy_PVoidParam;
+
+    if (0 == Copy_U32Value && !HOST_U8LcdRead)
+    {
+        HOST_U64LcdLastWrite = HOST_PStrAvr->cycle;
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSimRunUntil
+ * Description: Runs the core up to a cycle count. Exits if the firmware
+ *              crashes or returns.
+ * Parameters:
+ *      - Copy_U64Cycle: Cycle count to reach
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSimRunUntil(u64 Copy_U64Cycle)
+{
+    while (HOST_PStrAvr->cycle < Copy_U64Cycle)
+    {
+        int LOC_State = avr_run(HOST_PStrAvr);
+
+        if (cpu_Done == LOC_State || cpu_Crashed == LOC_State)
+        {
+            fprintf(stderr, "firmware stopped at cycle %llu\n", (unsigned long long)HOST_PStrAvr->cycle);
+            exit(1);
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_S64SimMeasure
+ * Description: Resets the core, types an expression and measures the '='
+ *              press, or its release when '=' is the shift key. Keys after
+ *              the first '=' are ignored.
+ * Parameters:
+ *      - Copy_PCharExpression: Keys to type, ending with '='
+ * Return:
+ *      - s64: Cycles from the '=' key to the last LCD write, -1 if the LCD
+ *             was not written after it.
+ ******************************************************************************/
+static s64 HOST_S64SimMeasure(const char *Copy_PCharExpression)
+{
+    u64 LOC_U64Press = 0, LOC_U64Limit;
+
+    avr_reset(HOST_PStrAvr);
+    HOST_U16HeldKeys = 0;
+    HOST_U8KeypadPort = 0xFF;
+    HOST_U8LcdRead = 0;
+    HOST_VOIDSimDriveRows();
+
+    /* Power-on, the LCD initialization waits 40 ms */
+    HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + 100 * HOST_SIM_CYCLES_PER_MS);
+
+    for (; *Copy_PCharExpression; Copy_PCharExpression++)
+    {
+        const char *LOC_PCharKey = strchr(HOST_AU8Keymap, *Copy_PCharExpression);
+
+        if (NULL == LOC_PCharKey)
+        {
+            /* Shift held, the key pressed and released under it, then shift released */
+            HOST_U16HeldKeys = 1U << HKPD_SHIFT_KEY;
+            HOST_VOIDSimDriveRows();
+            HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + HOST_SIM_HOLD_MS * HOST_SIM_CYCLES_PER_MS);
+            SET_BIT(HOST_U16HeldKeys, (strchr(HOST_AU8ShiftKeymap, *Copy_PCharExpression) - HOST_AU8ShiftKeymap));
+            HOST_VOIDSimDriveRows();
+            HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + HOST_SIM_HOLD_MS * HOST_SIM_CYCLES_PER_MS);
+            HOST_U16HeldKeys = 1U << HKPD_SHIFT_KEY;
+            HOST_VOIDSimDriveRows();
+            HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + HOST_SIM_RELEASE_MS * HOST_SIM_CYCLES_PER_MS);
+        }
+        else
+        {
+            HOST_U16HeldKeys = 1U << (LOC_PCharKey - HOST_AU8Keymap);
+            HOST_VOIDSimDriveRows();
+            LOC_U64Press = HOST_PStrAvr->cycle;
+            HOST_U64LcdLastWrite = 0;
+            HOST_VOIDSimRunUntil(LOC_U64Press + HOST_SIM_HOLD_MS * HOST_SIM_CYCLES_PER_MS);
+        }
+
+        HOST_U16HeldKeys = 0;
+        HOST_VOIDSimDriveRows();
+        if ('=' == *Copy_PCharExpression)
+        {
+            /* The shift key only acts once released */
+            if (HKPD_SHIFT_KEY != HKPD_SHIFT_NONE && LOC_PCharKey - HOST_AU8Keymap == HKPD_SHIFT_KEY)
+            {
+                LOC_U64Press = HOST_PStrAvr->cycle;
+                HOST_U64LcdLastWrite = 0;
+            }
+            break;
+        }
+        HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + HOST_SIM_RELEASE_MS * HOST_SIM_CYCLES_PER_MS);
+    }
+
+    /* Run until the LCD has been quiet for a while */
+    LOC_U64Limit = LOC_U64Press + HOST_SIM_LIMIT_MS * HOST_SIM_CYCLES_PER_MS;
+    while (HOST_PStrAvr->cycle < LOC_U64Limit
+           && HOST_PStrAvr->cycle - (HOST_U64LcdLastWrite ? HOST_U64LcdLastWrite : LOC_U64Press)
+              < HOST_SIM_QUIET_MS * HOST_SIM_CYCLES_PER_MS)
+    {
+        HOST_VOIDSimRunUntil(HOST_PStrAvr->cycle + HOST_SIM_CYCLES_PER_MS);
+    }
+
+    return HOST_U64LcdLastWrite ? (s64)(HOST_U64LcdLastWrite - LOC_U64Press) : -1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_IntSimCompare
+ * Description: qsort comparison of two cycle counts.
+ * Parameters:
+ *      - Copy_PVoidFirst: First count
+ *      - Copy_PVoidSecond: Second count
+ * Return:
+ *      - int: Negative, zero or positive as the first is lower, equal or higher.
+ ******************************************************************************/
+static int HOST_IntSimCompare(const void *Copy_PVoidFirst, const void *Copy_PVoidSecond)
+{
+    s64 LOC_S64First = *(const s64 *)Copy_PVoidFirst, LOC_S64Second = *(const s64 *)Copy_PVoidSecond;
+
+    return (LOC_S64First > LOC_S64Second) - (LOC_S64First < LOC_S64Second);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8SimLoadCorpus
+ * Description: Reads the corpus, one expression per line. Blank lines and
+ *              lines starting with '#' are skipped, a missing '=' is added.
+ * Parameters:
+ *      - Copy_PCharPath: Corpus file
+ *      - Copy_AACharCorpus: Receives the expressions
+ *      - Copy_PU16Count: Receives the number of expressions
+ * Return:
+ *      - u8: 1 on success, 0 for an unreadable file or a key not on the keypad.
+ ******************************************************************************/
+static u8 HOST_U8SimLoadCorpus(const char *Copy_PCharPath, char Copy_AACharCorpus[][HOST_SIM_LINE],
+                               u16 *Copy_PU16Count)
+{
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "r");
+    char LOC_ACharLine[HOST_SIM_LINE];
+    u16 LOC_U16Count = 0;
+
+    if (NULL == LOC_PFile)
+    {
+        fprintf(stderr, "cannot read %s\n", Copy_PCharPath);
+        return 0;
+    }
+
+    while (LOC_U16Count < HOST_SIM_CORPUS && fgets(LOC_ACharLine, sizeof(LOC_ACharLine) - 1, LOC_PFile))
+    {
+        size_t LOC_Length = strcspn(LOC_ACharLine, " \t\r\n");
+
+        LOC_ACharLine[LOC_Length] = '\0';
+        if (0 == LOC_Length || '#' == LOC_ACharLine[0])
+        {
+            continue;
+        }
+        if (strspn(LOC_ACharLine, (HKPD_SHIFT_KEY != HKPD_SHIFT_NONE) ? HOST_AU8CorpusKeys : HOST_AU8Keymap) != LOC_Length)
+        {
+            fprintf(stderr, "%s: '%s' has a key not on the keypad\n", Copy_PCharPath, LOC_ACharLine);
+            fclose(LOC_PFile);
+            return 0;
+        }
+        if (NULL == strchr(LOC_ACharLine, '='))
+        {
+            strcat(LOC_ACharLine, "=");
+        }
+        strcpy(Copy_AACharCorpus[LOC_U16Count++], LOC_ACharLine);
+    }
+
+    fclose(LOC_PFile);
+    *Copy_PU16Count = LOC_U16Count;
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: main
+ * Description: Measures every expression of the corpus and prints the cycle
+ *              table with the minimum, median and maximum.
+ * Parameters:
+ *      - argc: Number of arguments
+ *      - argv: The firmware ELF and the corpus file
+ * Returns:
+ *      - int: 0 on success, 1 for bad arguments or a firmware that cannot be
+ *             loaded or stops.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static char LOC_AACharCorpus[HOST_SIM_CORPUS][HOST_SIM_LINE];
+    static s64 LOC_AS64Cycles[HOST_SIM_CORPUS], LOC_AS64Sorted[HOST_SIM_CORPUS];
+    const char *LOC_PCharElf = (argc > 1) ? argv[1] : "../Release/HKPD.elf";
+    const char *LOC_PCharCorpus = (argc > 2) ? argv[2] : "latency_corpus.txt";
+    elf_firmware_t LOC_Firmware;
+    u16 LOC_U16Count, LOC_U16Index, LOC_U16Measured = 0;
+
+    if (argc > 3)
+    {
+        fprintf(stderr, "usage: %s [firmware.elf] [corpus.txt]\n", argv[0]);
+        return 1;
+    }
+    if (!HOST_U8SimLoadCorpus(LOC_PCharCorpus, LOC_AACharCorpus, &LOC_U16Count))
+    {
+        return 1;
+    }
+
+    memset(&LOC_Firmware, 0, sizeof(LOC_Firmware));
+    if (0 != elf_read_firmware(LOC_PCharElf, &LOC_Firmware))
+    {
+        fprintf(stderr, "cannot load %s\n", LOC_PCharElf);
+        return 1;
+    }
+
+    /* The Eclipse build does not record the MCU and clock in the ELF */
+    if (!LOC_Firmware.mmcu[0])
+    {
+        strcpy(LOC_Firmware.mmcu, "atmega32");
+    }
+    if (!LOC_Firmware.frequency)
+    {
+        LOC_Firmware.frequency = HOST_SIM_FREQUENCY;
+    }
+
+    HOST_PStrAvr = avr_make_mcu_by_name(LOC_Firmware.mmcu);
+    if (NULL == HOST_PStrAvr)
+    {
+        fprintf(stderr, "simavr has no core for %s\n", LOC_Firmware.mmcu);
+        return 1;
+    }
+    avr_init(HOST_PStrAvr);
+    avr_load_firmware(HOST_PStrAvr, &LOC_Firmware);
+
+    /* Keypad on PORTA: columns on the low nibble, rows on the high one */
+    avr_irq_register_notify(avr_io_getirq(HOST_PStrAvr, AVR_IOCTL_IOPORT_GETIRQ('A'), IOPORT_IRQ_REG_PORT),
+                            HOST_VOIDSimKeypadPort, NULL);
+    for (LOC_U16Index = 0; LOC_U16Index < 4; LOC_U16Index++)
+    {
+        HOST_APStrRows[LOC_U16Index] = avr_io_getirq(HOST_PStrAvr, AVR_IOCTL_IOPORT_GETIRQ('A'), 4 + LOC_U16Index);
+    }
+
+    /* LCD control lines, as set in HLCD_CFG.h */
+    avr_irq_register_notify(avr_io_getirq(HOST_PStrAvr, AVR_IOCTL_IOPORT_GETIRQ('A' + CONTROL_PORT), RW_PIN),
+                            HOST_VOIDSimLcdReadWrite, NULL);
+    avr_irq_register_notify(avr_io_getirq(HOST_PStrAvr, AVR_IOCTL_IOPORT_GETIRQ('A' + CONTROL_PORT), EN_PIN),
+                            HOST_VOIDSimLcdEnable, NULL);
+
+    printf("%-4s %-40s %10s %10s\n", "#", "expression", "cycles", "us");
+    for (LOC_U16Index = 0; LOC_U16Index < LOC_U16Count; LOC_U16Index++)
+    {
+        LOC_AS64Cycles[LOC_U16Index] = HOST_S64SimMeasure(LOC_AACharCorpus[LOC_U16Index]);
+        if (LOC_AS64Cycles[LOC_U16Index] < 0)
+        {
+            printf("%-4u %-40s %10s %10s\n", LOC_U16Index + 1, LOC_AACharCorpus[LOC_U16Index], "-", "-");
+            continue;
+        }
+        printf("%-4u %-40s %10lld %10.1f\n", LOC_U16Index + 1, LOC_AACharCorpus[LOC_U16Index],
+               (long long)LOC_AS64Cycles[LOC_U16Index], LOC_AS64Cycles[LOC_U16Index] * 1e6 / HOST_SIM_FREQUENCY);
+        LOC_AS64Sorted[LOC_U16Measured++] = LOC_AS64Cycles[LOC_U16Index];
+    }
+
+    if (LOC_U16Measured)
+    {
+        s64 LOC_S64Median;
+
+        qsort(LOC_AS64Sorted, LOC_U16Measured, sizeof(LOC_AS64Sorted[0]), HOST_IntSimCompare);
+        LOC_S64Median = (LOC_AS64Sorted[(LOC_U16Measured - 1) / 2] + LOC_AS64Sorted[LOC_U16Measured / 2]) / 2;
+        printf("min %lld, median %lld, max %lld cycles over %u expressions\n", (long long)LOC_AS64Sorted[0],
+               (long long)LOC_S64Median, (long long)LOC_AS64Sorted[LOC_U16Measured - 1], LOC_U16Measured);
+    }
+
+    avr_terminate(HOST_PStrAvr);
+    return 0;
+}
+
+#endif
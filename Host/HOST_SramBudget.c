@@ -0,0 +1,707 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_SramBudget.c
+ *
+ * Description: Static SRAM budget of the AVR image. Reads the stack usage
+ *              files written by -fstack-usage, the disassembly of the image
+ *              for the call graph and the linker map for the .data, .bss and
+ *              .noinit sizes. Prints the worst-case stack of the call chain
+ *              from main and from each interrupt vector, and the SRAM left
+ *              when the deepest of both meet on top of the static data. Runs
+ *              on the host, not part of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../LIB/STD_TYPES.h"
+
+/* Capacity of the tables, far above what the firmware has */
+#define HOST_SRAM_MAX_FUNCTIONS 1024
+#define HOST_SRAM_MAX_EDGES     8192
+#define HOST_SRAM_MAX_OBJECTS   128
+#define HOST_SRAM_NAME_SIZE     96
+#define HOST_SRAM_LINE_SIZE     1024
+
+/* Frame of a function that has no stack usage entry, e.g. libgcc helpers */
+#define HOST_SRAM_UNKNOWN (-1)
+
+/* Sections of the linker map that take SRAM */
+#define HOST_SRAM_DATA     0
+#define HOST_SRAM_BSS      1
+#define HOST_SRAM_NOINIT   2
+#define HOST_SRAM_SECTIONS 3
+
+/************************************************************************************
+ * Description: A function of the image. Worst and Next are filled by the search:
+ *              the deepest stack of the chains starting here, and the callee the
+ *              deepest chain goes through.
+ ************************************************************************************/
+typedef struct
+{
+    char Name[HOST_SRAM_NAME_SIZE];
+    s32 Frame;          /* Bytes from -fstack-usage, return address included, or HOST_SRAM_UNKNOWN */
+    u8 Dynamic;         /* The frame has an unbounded dynamic part, alloca or a VLA */
+    u8 Indirect;        /* Calls through a pointer that no -e option resolved */
+    u8 State;           /* 0 not searched, 1 on the current chain, 2 done */
+    u8 Recursive;       /* A chain from here calls back into itself */
+    u32 Worst;
+    s32 Next;
+} HOST_SramFunctionType;
+
+/* SRAM taken by one object file, per section */
+typedef struct
+{
+    char Name[HOST_SRAM_NAME_SIZE];
+    u32 Size[HOST_SRAM_SECTIONS];
+} HOST_SramObjectType;
+
+static const char *const HOST_APCharSections[HOST_SRAM_SECTIONS] = {".data", ".bss", ".noinit"};
+
+static HOST_SramFunctionType HOST_AStrFunctions[HOST_SRAM_MAX_FUNCTIONS];
+static u32 HOST_U32Functions;
+
+/* Call graph, caller and callee indexes into HOST_AStrFunctions */
+static u16 HOST_AU16EdgeFrom[HOST_SRAM_MAX_EDGES];
+static u16 HOST_AU16EdgeTo[HOST_SRAM_MAX_EDGES];
+static u32 HOST_U32Edges;
+
+static HOST_SramObjectType HOST_AStrObjects[HOST_SRAM_MAX_OBJECTS];
+static u32 HOST_U32Objects;
+static u32 HOST_AU32Sections[HOST_SRAM_SECTIONS];
+
+/******************************************************************************
+ * Function Name: HOST_S32SramFunction
+ * Description: Finds a function by name and adds it when it is not known yet.
+ *              Clones made by the compiler, e.g. "f.constprop.0", count as the
+ *              function they were made from.
+ * Parameters:
+ *      - Copy_PCharName: Name of the function, up to the first character
+ *                        that cannot be part of a symbol
+ *      - Copy_U32Length: Length of the name
+ * Return:
+ *      - s32: Index of the function, -1 when the table is full.
+ ******************************************************************************/
+static s32 HOST_S32SramFunction(const char *Copy_PCharName, u32 Copy_U32Length)
+{
+    const char *LOC_PCharDot = memchr(Copy_PCharName, '.', Copy_U32Length);
+    u32 LOC_U32Index;
+
+    /* A leading dot is part of the name, e.g. local labels */
+    if (NULL != LOC_PCharDot && LOC_PCharDot != Copy_PCharName)
+    {
+        Copy_U32Length = (u32)(LOC_PCharDot - Copy_PCharName);
+    }
+    if (Copy_U32Length >= HOST_SRAM_NAME_SIZE)
+    {
+        Copy_U32Length = HOST_SRAM_NAME_SIZE - 1;
+    }
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Functions; LOC_U32Index++)
+    {
+        if (0 == strncmp(HOST_AStrFunctions[LOC_U32Index].Name, Copy_PCharName, Copy_U32Length)
+            && '\0' == HOST_AStrFunctions[LOC_U32Index].Name[Copy_U32Length])
+        {
+            return (s32)LOC_U32Index;
+        }
+    }
+    if (HOST_U32Functions == HOST_SRAM_MAX_FUNCTIONS)
+    {
+        return -1;
+    }
+
+    memcpy(HOST_AStrFunctions[HOST_U32Functions].Name, Copy_PCharName, Copy_U32Length);
+    HOST_AStrFunctions[HOST_U32Functions].Name[Copy_U32Length] = '\0';
+    HOST_AStrFunctions[HOST_U32Functions].Frame = HOST_SRAM_UNKNOWN;
+    HOST_AStrFunctions[HOST_U32Functions].Next = -1;
+    return (s32)HOST_U32Functions++;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSramAddEdge
+ * Description: Adds a call to the graph, once per caller and callee.
+ * Parameters:
+ *      - Copy_S32From: Index of the caller
+ *      - Copy_S32To: Index of the callee
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSramAddEdge(s32 Copy_S32From, s32 Copy_S32To)
+{
+    u32 LOC_U32Index;
+
+    if (Copy_S32From < 0 || Copy_S32To < 0 || Copy_S32From == Copy_S32To)
+    {
+        return;
+    }
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Edges; LOC_U32Index++)
+    {
+        if (HOST_AU16EdgeFrom[LOC_U32Index] == Copy_S32From && HOST_AU16EdgeTo[LOC_U32Index] == Copy_S32To)
+        {
+            return;
+        }
+    }
+    if (HOST_U32Edges < HOST_SRAM_MAX_EDGES)
+    {
+        HOST_AU16EdgeFrom[HOST_U32Edges] = (u16)Copy_S32From;
+        HOST_AU16EdgeTo[HOST_U32Edges] = (u16)Copy_S32To;
+        HOST_U32Edges++;
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8SramReadUsage
+ * Description: Reads a file written by -fstack-usage. Each line holds the
+ *              location and name of a function, its frame in bytes and
+ *              whether it is static, dynamic or dynamic but bounded. A name
+ *              seen twice, e.g. static functions of the same name in two
+ *              files, keeps the larger frame.
+ * Parameters:
+ *      - Copy_PCharPath: The .su file
+ * Return:
+ *      - u8: 1 on success, 0 if the file cannot be read.
+ ******************************************************************************/
+static u8 HOST_U8SramReadUsage(const char *Copy_PCharPath)
+{
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "r");
+    char LOC_ACharLine[HOST_SRAM_LINE_SIZE];
+
+    if (NULL == LOC_PFile)
+    {
+        return 0;
+    }
+
+    while (NULL != fgets(LOC_ACharLine, sizeof(LOC_ACharLine), LOC_PFile))
+    {
+        char *LOC_PCharTab = strchr(LOC_ACharLine, '\t');
+        char *LOC_PCharName;
+        long LOC_Frame;
+        s32 LOC_S32Function;
+
+        if (NULL == LOC_PCharTab)
+        {
+            continue;
+        }
+
+        /* The name follows the last ':' of "file:line:column:name", file may hold a drive letter */
+        *LOC_PCharTab = '\0';
+        LOC_PCharName = strrchr(LOC_ACharLine, ':');
+        LOC_PCharName = (NULL != LOC_PCharName) ? LOC_PCharName + 1 : LOC_ACharLine;
+        LOC_Frame = strtol(LOC_PCharTab + 1, &LOC_PCharTab, 10);
+
+        LOC_S32Function = HOST_S32SramFunction(LOC_PCharName, (u32)strlen(LOC_PCharName));
+        if (LOC_S32Function < 0)
+        {
+            break;
+        }
+        if (LOC_Frame > HOST_AStrFunctions[LOC_S32Function].Frame)
+        {
+            HOST_AStrFunctions[LOC_S32Function].Frame = (s32)LOC_Frame;
+        }
+        if (NULL != strstr(LOC_PCharTab, "dynamic") && NULL == strstr(LOC_PCharTab, "bounded"))
+        {
+            HOST_AStrFunctions[LOC_S32Function].Dynamic = 1;
+        }
+    }
+
+    fclose(LOC_PFile);
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8SramIsCall / HOST_U8SramIsJump
+ * Description: Tell direct calls and jumps apart from the other mnemonics of
+ *              AVR and x86 listings.
+ * Parameters:
+ *      - Copy_PCharMnemonic: The mnemonic
+ * Return:
+ *      - u8: 1 if it is a call, respectively a jump, else 0.
+ ******************************************************************************/
+static u8 HOST_U8SramIsCall(const char *Copy_PCharMnemonic)
+{
+    return 0 == strcmp(Copy_PCharMnemonic, "call") || 0 == strcmp(Copy_PCharMnemonic, "rcall")
+        || 0 == strcmp(Copy_PCharMnemonic, "callq");
+}
+
+static u8 HOST_U8SramIsJump(const char *Copy_PCharMnemonic)
+{
+    return 0 == strcmp(Copy_PCharMnemonic, "jmp") || 0 == strcmp(Copy_PCharMnemonic, "rjmp")
+        || 0 == strcmp(Copy_PCharMnemonic, "jmpq");
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8SramReadDisassembly
+ * Description: Builds the call graph from the output of objdump -d or -S, e.g.
+ *              the HKPD.lss listing of the Eclipse project. A call or a jump to
+ *              the start of another function is an edge; a jump counts because
+ *              -Os turns calls in tail position into jumps. Calls through a
+ *              pointer mark the caller, -e options give their targets.
+ * Parameters:
+ *      - Copy_PCharPath: The disassembly
+ * Return:
+ *      - u8: 1 on success, 0 if the file cannot be read.
+ ******************************************************************************/
+static u8 HOST_U8SramReadDisassembly(const char *Copy_PCharPath)
+{
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "r");
+    char LOC_ACharLine[HOST_SRAM_LINE_SIZE];
+    s32 LOC_S32Current = -1;
+
+    if (NULL == LOC_PFile)
+    {
+        return 0;
+    }
+
+    while (NULL != fgets(LOC_ACharLine, sizeof(LOC_ACharLine), LOC_PFile))
+    {
+        char *LOC_PCharText = LOC_ACharLine;
+        char *LOC_PCharOpen, *LOC_PCharClose, *LOC_PCharMnemonic, *LOC_PCharOperands;
+        u32 LOC_U32Length;
+
+        /* "0000006c <HKPD_U8GetPressedValue>:" starts a function */
+        LOC_PCharOpen = strchr(LOC_ACharLine, '<');
+        LOC_PCharClose = (NULL != LOC_PCharOpen) ? strstr(LOC_PCharOpen, ">:") : NULL;
+        if (strspn(LOC_ACharLine, "0123456789abcdef") >= 4 && ' ' == LOC_ACharLine[strspn(LOC_ACharLine, "0123456789abcdef")]
+            && NULL != LOC_PCharClose)
+        {
+            LOC_S32Current = HOST_S32SramFunction(LOC_PCharOpen + 1, (u32)(LOC_PCharClose - LOC_PCharOpen - 1));
+            continue;
+        }
+
+        /* "  8a:\t0e 94 de 02 \tcall\t0x5bc\t; 0x5bc <MDIO_VOIDSetPinValue>" is an instruction */
+        LOC_PCharText += strspn(LOC_PCharText, " ");
+        LOC_U32Length = (u32)strspn(LOC_PCharText, "0123456789abcdef");
+        if (LOC_S32Current < 0 || 0 == LOC_U32Length || ':' != LOC_PCharText[LOC_U32Length])
+        {
+            continue;
+        }
+        LOC_PCharMnemonic = strchr(LOC_PCharText, '\t');
+        LOC_PCharMnemonic = (NULL != LOC_PCharMnemonic) ? strchr(LOC_PCharMnemonic + 1, '\t') : NULL;
+        if (NULL == LOC_PCharMnemonic)
+        {
+            continue;
+        }
+        LOC_PCharMnemonic++;
+        LOC_U32Length = (u32)strcspn(LOC_PCharMnemonic, " \t\r\n");
+
+        LOC_PCharOperands = LOC_PCharMnemonic + LOC_U32Length;
+        if ('\0' != *LOC_PCharOperands)
+        {
+            *LOC_PCharOperands++ = '\0';
+        }
+        LOC_PCharOperands += strspn(LOC_PCharOperands, " \t");
+
+        /* "icall", or "call *%rax" on x86 */
+        if (0 == strcmp(LOC_PCharMnemonic, "icall") || 0 == strcmp(LOC_PCharMnemonic, "eicall")
+            || (HOST_U8SramIsCall(LOC_PCharMnemonic) && '*' == LOC_PCharOperands[0]))
+        {
+            HOST_AStrFunctions[LOC_S32Current].Indirect = 1;
+            continue;
+        }
+        if (!HOST_U8SramIsCall(LOC_PCharMnemonic) && !HOST_U8SramIsJump(LOC_PCharMnemonic))
+        {
+            continue;
+        }
+
+        /* The target is the last "<name>" of the line, "<name+0x12>" is inside a function */
+        LOC_PCharOpen = strrchr(LOC_PCharOperands, '<');
+        LOC_PCharClose = (NULL != LOC_PCharOpen) ? strchr(LOC_PCharOpen, '>') : NULL;
+        if (NULL == LOC_PCharClose)
+        {
+            continue;
+        }
+        LOC_U32Length = (u32)strcspn(LOC_PCharOpen + 1, "+>");
+        if ('+' == LOC_PCharOpen[1 + LOC_U32Length] && HOST_U8SramIsJump(LOC_PCharMnemonic))
+        {
+            continue;
+        }
+        HOST_VOIDSramAddEdge(LOC_S32Current, HOST_S32SramFunction(LOC_PCharOpen + 1, LOC_U32Length));
+    }
+
+    fclose(LOC_PFile);
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSramAddObject
+ * Description: Adds the size of an input section to the object file it comes
+ *              from. Objects are told apart by their file name, archive
+ *              members by "archive(member)".
+ * Parameters:
+ *      - Copy_PCharPath: Path of the object as the map prints it
+ *      - Copy_U8Section: One of HOST_SRAM_DATA, HOST_SRAM_BSS, HOST_SRAM_NOINIT
+ *      - Copy_U32Size: Size of the input section
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSramAddObject(const char *Copy_PCharPath, u8 Copy_U8Section, u32 Copy_U32Size)
+{
+    const char *LOC_PCharName = Copy_PCharPath;
+    const char *LOC_PCharChar;
+    u32 LOC_U32Index, LOC_U32Length;
+
+    if (0 == Copy_U32Size)
+    {
+        return;
+    }
+    for (LOC_PCharChar = Copy_PCharPath; '\0' != *LOC_PCharChar && '(' != *LOC_PCharChar; LOC_PCharChar++)
+    {
+        if ('/' == *LOC_PCharChar || '\\' == *LOC_PCharChar)
+        {
+            LOC_PCharName = LOC_PCharChar + 1;
+        }
+    }
+    LOC_U32Length = (u32)strcspn(LOC_PCharName, "\r\n");
+    if (LOC_U32Length >= HOST_SRAM_NAME_SIZE)
+    {
+        LOC_U32Length = HOST_SRAM_NAME_SIZE - 1;
+    }
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Objects; LOC_U32Index++)
+    {
+        if (0 == strncmp(HOST_AStrObjects[LOC_U32Index].Name, LOC_PCharName, LOC_U32Length)
+            && '\0' == HOST_AStrObjects[LOC_U32Index].Name[LOC_U32Length])
+        {
+            break;
+        }
+    }
+    if (LOC_U32Index == HOST_U32Objects)
+    {
+        if (HOST_U32Objects == HOST_SRAM_MAX_OBJECTS)
+        {
+            return;
+        }
+        memcpy(HOST_AStrObjects[LOC_U32Index].Name, LOC_PCharName, LOC_U32Length);
+        HOST_AStrObjects[LOC_U32Index].Name[LOC_U32Length] = '\0';
+        HOST_U32Objects++;
+    }
+    HOST_AStrObjects[LOC_U32Index].Size[Copy_U8Section] += Copy_U32Size;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8SramReadMap
+ * Description: Reads the size of the .data, .bss and .noinit output sections
+ *              of a GNU ld map, e.g. HKPD.map, and splits them by object file.
+ *              Constants not placed in flash are in .data on the AVR.
+ * Parameters:
+ *      - Copy_PCharPath: The map file
+ * Return:
+ *      - u8: 1 on success, 0 if the file cannot be read.
+ ******************************************************************************/
+static u8 HOST_U8SramReadMap(const char *Copy_PCharPath)
+{
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "r");
+    char LOC_ACharLine[HOST_SRAM_LINE_SIZE];
+    u8 LOC_U8Section = HOST_SRAM_SECTIONS;  /* Output section being read, HOST_SRAM_SECTIONS for none */
+    u8 LOC_U8Pending = 0;                   /* An input section name was alone on the previous line */
+
+    if (NULL == LOC_PFile)
+    {
+        return 0;
+    }
+
+    while (NULL != fgets(LOC_ACharLine, sizeof(LOC_ACharLine), LOC_PFile))
+    {
+        unsigned long long LOC_Address, LOC_Size;
+        char *LOC_PCharText = LOC_ACharLine;
+        int LOC_Used = 0;
+        u8 LOC_U8Index;
+
+        if ('.' == LOC_ACharLine[0])
+        {
+            /* ".bss            0x00800074      0x1d5" starts an output section */
+            u32 LOC_U32Length = (u32)strcspn(LOC_ACharLine, " \t\r\n");
+
+            LOC_U8Section = HOST_SRAM_SECTIONS;
+            for (LOC_U8Index = 0; LOC_U8Index < HOST_SRAM_SECTIONS; LOC_U8Index++)
+            {
+                if (strlen(HOST_APCharSections[LOC_U8Index]) == LOC_U32Length
+                    && 0 == strncmp(LOC_ACharLine, HOST_APCharSections[LOC_U8Index], LOC_U32Length))
+                {
+                    LOC_U8Section = LOC_U8Index;
+                }
+            }
+            if (LOC_U8Section < HOST_SRAM_SECTIONS
+                && 2 == sscanf(LOC_ACharLine + LOC_U32Length, " 0x%llx 0x%llx", &LOC_Address, &LOC_Size))
+            {
+                HOST_AU32Sections[LOC_U8Section] += (u32)LOC_Size;
+            }
+            LOC_U8Pending = 0;
+            continue;
+        }
+        if (LOC_U8Section == HOST_SRAM_SECTIONS || ' ' != LOC_ACharLine[0])
+        {
+            LOC_U8Pending = 0;
+            continue;
+        }
+
+        /* " .bss           0x00800080       0x40 ./HLCD_Program.o", the name can be alone on a line */
+        LOC_PCharText += strspn(LOC_PCharText, " ");
+        if (!LOC_U8Pending)
+        {
+            if ('.' != LOC_PCharText[0] && 0 != strncmp(LOC_PCharText, "COMMON", 6))
+            {
+                continue;
+            }
+            LOC_PCharText += strcspn(LOC_PCharText, " \r\n");
+            if ('\r' == LOC_PCharText[0] || '\n' == LOC_PCharText[0] || '\0' == LOC_PCharText[0])
+            {
+                LOC_U8Pending = 1;
+                continue;
+            }
+        }
+        LOC_U8Pending = 0;
+        if (2 == sscanf(LOC_PCharText, " 0x%llx 0x%llx %n", &LOC_Address, &LOC_Size, &LOC_Used) && LOC_Used > 0)
+        {
+            HOST_VOIDSramAddObject(LOC_PCharText + LOC_Used, LOC_U8Section, (u32)LOC_Size);
+        }
+    }
+
+    fclose(LOC_PFile);
+    return 1;
+}
+
+/******************************************************************************
+ * Function Name: HOST_U32SramWorst
+ * Description: Finds the deepest stack of the chains starting at a function:
+ *              its frame plus the deepest chain of its callees. A function on
+ *              the current chain met again is recursion, its depth cannot be
+ *              bounded and the call is left out.
+ * Parameters:
+ *      - Copy_U32Function: Index of the function
+ * Return:
+ *      - u32: Worst-case stack in bytes, unknown frames count as 0.
+ ******************************************************************************/
+static u32 HOST_U32SramWorst(u32 Copy_U32Function)
+{
+    HOST_SramFunctionType *LOC_PStrFunction = &HOST_AStrFunctions[Copy_U32Function];
+    u32 LOC_U32Index, LOC_U32Deepest = 0;
+
+    if (2 == LOC_PStrFunction->State)
+    {
+        return LOC_PStrFunction->Worst;
+    }
+    LOC_PStrFunction->State = 1;
+
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Edges; LOC_U32Index++)
+    {
+        u32 LOC_U32Callee = HOST_AU16EdgeTo[LOC_U32Index];
+        u32 LOC_U32Depth;
+
+        if (HOST_AU16EdgeFrom[LOC_U32Index] != Copy_U32Function)
+        {
+            continue;
+        }
+        if (1 == HOST_AStrFunctions[LOC_U32Callee].State)
+        {
+            LOC_PStrFunction->Recursive = 1;
+            continue;
+        }
+        LOC_U32Depth = HOST_U32SramWorst(LOC_U32Callee);
+        LOC_PStrFunction->Recursive |= HOST_AStrFunctions[LOC_U32Callee].Recursive;
+        if (LOC_U32Depth > LOC_U32Deepest || -1 == LOC_PStrFunction->Next)
+        {
+            LOC_U32Deepest = LOC_U32Depth;
+            LOC_PStrFunction->Next = (s32)LOC_U32Callee;
+        }
+    }
+
+    LOC_PStrFunction->Worst = LOC_U32Deepest + (LOC_PStrFunction->Frame > 0 ? (u32)LOC_PStrFunction->Frame : 0);
+    LOC_PStrFunction->State = 2;
+    return LOC_PStrFunction->Worst;
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSramPrintChain
+ * Description: Prints the deepest chain from a root with the frame of each
+ *              function, and warns about what makes the figure a lower bound.
+ * Parameters:
+ *      - Copy_U32Root: Index of the first function of the chain
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSramPrintChain(u32 Copy_U32Root)
+{
+    s32 LOC_S32Function;
+    u8 LOC_U8Unknown = 0, LOC_U8Indirect = 0, LOC_U8Dynamic = 0;
+
+    printf("  %-24s %5u  ", HOST_AStrFunctions[Copy_U32Root].Name, (unsigned)HOST_AStrFunctions[Copy_U32Root].Worst);
+    for (LOC_S32Function = (s32)Copy_U32Root; LOC_S32Function >= 0; LOC_S32Function = HOST_AStrFunctions[LOC_S32Function].Next)
+    {
+        const HOST_SramFunctionType *LOC_PStrFunction = &HOST_AStrFunctions[LOC_S32Function];
+
+        if (HOST_SRAM_UNKNOWN == LOC_PStrFunction->Frame)
+        {
+            printf("%s(?)", LOC_PStrFunction->Name);
+            LOC_U8Unknown = 1;
+        }
+        else
+        {
+            printf("%s(%d)", LOC_PStrFunction->Name, (int)LOC_PStrFunction->Frame);
+        }
+        LOC_U8Indirect |= LOC_PStrFunction->Indirect;
+        LOC_U8Dynamic |= LOC_PStrFunction->Dynamic;
+        printf("%s", (LOC_PStrFunction->Next >= 0) ? " > " : "\n");
+    }
+
+    if (LOC_U8Unknown)
+    {
+        printf("  %-24s        ? no stack usage for this function, counted as 0\n", "");
+    }
+    if (LOC_U8Indirect)
+    {
+        printf("  %-24s        calls through a pointer on this chain, give their targets with -e\n", "");
+    }
+    if (LOC_U8Dynamic)
+    {
+        printf("  %-24s        unbounded dynamic frame on this chain\n", "");
+    }
+    if (HOST_AStrFunctions[Copy_U32Root].Recursive)
+    {
+        printf("  %-24s        recursion below this root, its depth is not counted\n", "");
+    }
+}
+
+/******************************************************************************
+ * Function Name: HOST_VOIDSramUsage
+ * Description: Prints how to run the report.
+ * Parameters:
+ *      - Copy_PCharProgram: Name the program was started with
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDSramUsage(const char *Copy_PCharProgram)
+{
+    fprintf(stderr,
+            "usage: %s -m map -d disassembly [-s sram] [-k bytes] [-e caller:callee]... file.su...\n"
+            "  -m map          linker map, e.g. ../Release/HKPD.map\n"
+            "  -d disassembly  objdump -d or -S output of the same image, e.g. ../Release/HKPD.lss\n"
+            "  -s sram         SRAM size in bytes, default 2048 (ATmega32)\n"
+            "  -k bytes        exit with status 3 when fewer bytes are left free, default 0\n"
+            "  -e caller:callee  a call through a pointer, may be repeated\n",
+            Copy_PCharProgram);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *LOC_PCharMap = NULL, *LOC_PCharDisassembly = NULL;
+    const char *LOC_APCharEdges[64];
+    u32 LOC_U32EdgeOptions = 0, LOC_U32Sram = 2048, LOC_U32Keep = 0;
+    u32 LOC_U32Static = 0, LOC_U32Main = 0, LOC_U32Interrupt = 0, LOC_U32Total, LOC_U32Index;
+    s32 LOC_S32Main = -1, LOC_S32Interrupt = -1;
+    int LOC_Argument;
+
+    for (LOC_Argument = 1; LOC_Argument < argc && '-' == argv[LOC_Argument][0]; LOC_Argument += 2)
+    {
+        const char *LOC_PCharValue = (LOC_Argument + 1 < argc) ? argv[LOC_Argument + 1] : NULL;
+
+        if (NULL == LOC_PCharValue || '\0' == argv[LOC_Argument][1] || '\0' != argv[LOC_Argument][2])
+        {
+            HOST_VOIDSramUsage(argv[0]);
+            return 1;
+        }
+        switch (argv[LOC_Argument][1])
+        {
+        case 'm': LOC_PCharMap = LOC_PCharValue; break;
+        case 'd': LOC_PCharDisassembly = LOC_PCharValue; break;
+        case 's': LOC_U32Sram = (u32)strtoul(LOC_PCharValue, NULL, 0); break;
+        case 'k': LOC_U32Keep = (u32)strtoul(LOC_PCharValue, NULL, 0); break;
+        case 'e':
+            if (NULL == strchr(LOC_PCharValue, ':') || LOC_U32EdgeOptions == sizeof(LOC_APCharEdges) / sizeof(LOC_APCharEdges[0]))
+            {
+                HOST_VOIDSramUsage(argv[0]);
+                return 1;
+            }
+            LOC_APCharEdges[LOC_U32EdgeOptions++] = LOC_PCharValue;
+            break;
+        default:
+            HOST_VOIDSramUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (NULL == LOC_PCharMap || NULL == LOC_PCharDisassembly || LOC_Argument == argc)
+    {
+        HOST_VOIDSramUsage(argv[0]);
+        return 1;
+    }
+
+    for (; LOC_Argument < argc; LOC_Argument++)
+    {
+        if (!HOST_U8SramReadUsage(argv[LOC_Argument]))
+        {
+            fprintf(stderr, "cannot read %s\n", argv[LOC_Argument]);
+            return 1;
+        }
+    }
+    if (!HOST_U8SramReadDisassembly(LOC_PCharDisassembly) || !HOST_U8SramReadMap(LOC_PCharMap))
+    {
+        fprintf(stderr, "cannot read %s or %s\n", LOC_PCharDisassembly, LOC_PCharMap);
+        return 1;
+    }
+    for (LOC_U32Index = 0; LOC_U32Index < LOC_U32EdgeOptions; LOC_U32Index++)
+    {
+        const char *LOC_PCharColon = strchr(LOC_APCharEdges[LOC_U32Index], ':');
+        s32 LOC_S32From = HOST_S32SramFunction(LOC_APCharEdges[LOC_U32Index], (u32)(LOC_PCharColon - LOC_APCharEdges[LOC_U32Index]));
+
+        HOST_VOIDSramAddEdge(LOC_S32From, HOST_S32SramFunction(LOC_PCharColon + 1, (u32)strlen(LOC_PCharColon + 1)));
+        if (LOC_S32From >= 0)
+        {
+            HOST_AStrFunctions[LOC_S32From].Indirect = 0;
+        }
+    }
+
+    /* Static data, by object file */
+    printf("Static SRAM of %s\n", LOC_PCharMap);
+    printf("  %-24s %6s %6s %6s\n", "object", ".data", ".bss", ".noinit");
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Objects; LOC_U32Index++)
+    {
+        printf("  %-24s %6u %6u %6u\n", HOST_AStrObjects[LOC_U32Index].Name, (unsigned)HOST_AStrObjects[LOC_U32Index].Size[HOST_SRAM_DATA],
+               (unsigned)HOST_AStrObjects[LOC_U32Index].Size[HOST_SRAM_BSS], (unsigned)HOST_AStrObjects[LOC_U32Index].Size[HOST_SRAM_NOINIT]);
+    }
+    printf("  %-24s %6u %6u %6u\n\n", "total, with alignment", (unsigned)HOST_AU32Sections[HOST_SRAM_DATA],
+           (unsigned)HOST_AU32Sections[HOST_SRAM_BSS], (unsigned)HOST_AU32Sections[HOST_SRAM_NOINIT]);
+    LOC_U32Static = HOST_AU32Sections[HOST_SRAM_DATA] + HOST_AU32Sections[HOST_SRAM_BSS] + HOST_AU32Sections[HOST_SRAM_NOINIT];
+
+    /* Deepest chain of main and of every interrupt vector; interrupts do not nest, so only the deepest one adds up */
+    printf("Worst-case stack of each call chain, in bytes, frame of each function in brackets\n");
+    for (LOC_U32Index = 0; LOC_U32Index < HOST_U32Functions; LOC_U32Index++)
+    {
+        const char *LOC_PCharName = HOST_AStrFunctions[LOC_U32Index].Name;
+        u32 LOC_U32Depth;
+
+        if (0 != strcmp(LOC_PCharName, "main") && 0 != strncmp(LOC_PCharName, "__vector_", 9))
+        {
+            continue;
+        }
+        LOC_U32Depth = HOST_U32SramWorst(LOC_U32Index);
+        HOST_VOIDSramPrintChain(LOC_U32Index);
+        if ('m' == LOC_PCharName[0])
+        {
+            LOC_S32Main = (s32)LOC_U32Index;
+            LOC_U32Main = LOC_U32Depth;
+        }
+        else if (LOC_U32Depth > LOC_U32Interrupt)
+        {
+            LOC_S32Interrupt = (s32)LOC_U32Index;
+            LOC_U32Interrupt = LOC_U32Depth;
+        }
+    }
+    if (LOC_S32Main < 0)
+    {
+        fprintf(stderr, "no main in %s\n", LOC_PCharDisassembly);
+        return 1;
+    }
+
+    LOC_U32Total = LOC_U32Static + LOC_U32Main + LOC_U32Interrupt;
+    printf("\nSRAM budget: %u static + %u main + %u %s = %u of %u bytes, %d free\n",
+           (unsigned)LOC_U32Static, (unsigned)LOC_U32Main, (unsigned)LOC_U32Interrupt,
+           (LOC_S32Interrupt >= 0) ? HOST_AStrFunctions[LOC_S32Interrupt].Name : "interrupts",
+           (unsigned)LOC_U32Total, (unsigned)LOC_U32Sram, (int)LOC_U32Sram - (int)LOC_U32Total);
+
+    return (LOC_U32Total + LOC_U32Keep > LOC_U32Sram) ? 3 : 0;
+}
+
+#endif /* !__AVR__ */
@@ -0,0 +1,153 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Trace.c
+ *
+ * Description: Exports the MDIO trace of a host run as a VCD waveform. Not
+ *              part of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stdio.h>
+#include "HOST_Trace.h"
+
+#if MDIO_TRACE == 1
+
+/* Signals per port: PORT, DDR and PIN vectors followed by the eight PORT bits */
+#define HOST_TRACE_SIGNALS 11
+
+/* Identifier code of a signal, printable characters from '!' on */
+#define HOST_TRACE_ID(port, signal) ((char)('!' + (port) * HOST_TRACE_SIGNALS + (signal)))
+
+/******************************************************************************
+ * Function Name: HOST_VOIDTraceVector
+ * Description: Writes a value change of an 8-bit vector.
+ * Parameters:
+ *      - Copy_PFile: The VCD file
+ *      - Copy_U8Value: New value
+ *      - Copy_CharId: Identifier code of the signal
+ * Return: None
+ ******************************************************************************/
+static void HOST_VOIDTraceVector(FILE *Copy_PFile, u8 Copy_U8Value, char Copy_CharId)
+{
+    s8 LOC_S8Bit;
+
+    fputc('b', Copy_PFile);
+    for (LOC_S8Bit = 7; LOC_S8Bit >= 0; LOC_S8Bit--)
+    {
+        fputc('0' + GET_BIT(Copy_U8Value, LOC_S8Bit), Copy_PFile);
+    }
+    fprintf(Copy_PFile, " %c\n", Copy_CharId);
+}
+
+/******************************************************************************
+ * Function Name: HOST_U8TraceWriteVcd
+ * Description: Writes the records held by the MDIO trace to a VCD file.
+ * Parameters:
+ *      - Copy_PCharPath: File to create
+ * Return:
+ *      - u8: 1 on success, 0 if the file cannot be written.
+ ******************************************************************************/
+u8 HOST_U8TraceWriteVcd(const char *Copy_PCharPath)
+{
+    static const char *const LOC_APCharRegisters[3] = {"PORT", "DDR", "PIN"};
+    FILE *LOC_PFile = fopen(Copy_PCharPath, "w");
+    u16 LOC_U16Index, LOC_U16Count = MDIO_U16TraceCount();
+    u8 LOC_U8Port, LOC_U8Signal;
+    u8 LOC_AU8Pins[4];
+    u8 LOC_AU8Known[4] = {0, 0, 0, 0};
+    u64 LOC_U64LastTime = ~(u64)0;
+    MDIO_TraceType LOC_StrRecord;
+
+    if (NULL == LOC_PFile)
+    {
+        return 0;
+    }
+
+    fprintf(LOC_PFile, "$version calculator_host MDIO trace $end\n$timescale 1ns $end\n$scope module dio $end\n");
+    for (LOC_U8Port = 0; LOC_U8Port < 4; LOC_U8Port++)
+    {
+        fprintf(LOC_PFile, "$scope module port%c $end\n", 'A' + LOC_U8Port);
+        for (LOC_U8Signal = 0; LOC_U8Signal < 3; LOC_U8Signal++)
+        {
+            fprintf(LOC_PFile, "$var wire 8 %c %s%c $end\n", HOST_TRACE_ID(LOC_U8Port, LOC_U8Signal),
+                    LOC_APCharRegisters[LOC_U8Signal], 'A' + LOC_U8Port);
+        }
+        for (LOC_U8Signal = 0; LOC_U8Signal < 8; LOC_U8Signal++)
+        {
+            fprintf(LOC_PFile, "$var wire 1 %c P%c%d $end\n", HOST_TRACE_ID(LOC_U8Port, 3 + LOC_U8Signal),
+                    'A' + LOC_U8Port, LOC_U8Signal);
+        }
+        fprintf(LOC_PFile, "$upscope $end\n");
+    }
+    fprintf(LOC_PFile, "$upscope $end\n$enddefinitions $end\n");
+
+    for (LOC_U16Index = 0; LOC_U16Index < LOC_U16Count; LOC_U16Index++)
+    {
+        u64 LOC_U64Time;
+
+        MDIO_VOIDTraceGet(LOC_U16Index, &LOC_StrRecord);
+        LOC_U64Time = (u64)LOC_StrRecord.Cycle * MBACKEND_NS_PER_CYCLE;
+
+        /* Registers are 3 bytes apart, PIN, DDR and PORT of port 0 at the top */
+        LOC_U8Port = (0x3B - LOC_StrRecord.Address) / 3;
+        LOC_U8Signal = (0x3B - LOC_StrRecord.Address) % 3;
+        if (LOC_U8Port >= 4)
+        {
+            continue;
+        }
+
+        if (LOC_U64Time != LOC_U64LastTime)
+        {
+            fprintf(LOC_PFile, "#%llu\n", (unsigned long long)LOC_U64Time);
+            LOC_U64LastTime = LOC_U64Time;
+        }
+
+        HOST_VOIDTraceVector(LOC_PFile, LOC_StrRecord.Value, HOST_TRACE_ID(LOC_U8Port, LOC_U8Signal));
+
+        /* Single wires only for the PORT bits that changed */
+        if (0 == LOC_U8Signal)
+        {
+            u8 LOC_U8Bit;
+
+            for (LOC_U8Bit = 0; LOC_U8Bit < 8; LOC_U8Bit++)
+            {
+                if (!LOC_AU8Known[LOC_U8Port]
+                    || GET_BIT((LOC_AU8Pins[LOC_U8Port] ^ LOC_StrRecord.Value), LOC_U8Bit))
+                {
+                    fprintf(LOC_PFile, "%d%c\n", GET_BIT(LOC_StrRecord.Value, LOC_U8Bit),
+                            HOST_TRACE_ID(LOC_U8Port, 3 + LOC_U8Bit));
+                }
+            }
+            LOC_AU8Pins[LOC_U8Port] = LOC_StrRecord.Value;
+            LOC_AU8Known[LOC_U8Port] = 1;
+        }
+    }
+
+    return 0 == fclose(LOC_PFile);
+}
+
+#else
+
+/******************************************************************************
+ * Function Name: HOST_U8TraceWriteVcd
+ * Description: The trace is compiled out, nothing can be written.
+ * Parameters:
+ *      - Copy_PCharPath: File to create
+ * Return:
+ *      - u8: Always 0.
+ ******************************************************************************/
+u8 HOST_U8TraceWriteVcd(const char *Copy_PCharPath)
+{
+    fprintf(stderr, "%s: built without MDIO_TRACE\n", Copy_PCharPath);
+    return 0;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+/******************************************************************************
+ *
+ * Module: Host
+ *
+ * File Name: HOST_Trace.h
+ *
+ * Description: Header file for exporting the MDIO trace of a host run as a
+ *              VCD waveform, which GTKWave and most waveform viewers open.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _HOST_TRACE_H_
+#define _HOST_TRACE_H_
+
+#include "../MCAL/DIO/MDIO_Interface.h"
+
+/******************************************************************************
+ * Function Name: HOST_U8TraceWriteVcd
+ * Description: Writes the records held by the MDIO trace to a VCD file. Every
+ *              port gets its PORT, DDR and PIN registers as 8-bit vectors and
+ *              one wire per PORT bit, so pulse widths can be measured on the
+ *              pins directly. Time is in nanoseconds of the simulated clock.
+ * Parameters:
+ *      - Copy_PCharPath: File to create
+ * Return:
+ *      - u8: 1 on success, 0 if the file cannot be written.
+ ******************************************************************************/
+u8 HOST_U8TraceWriteVcd(const char *Copy_PCharPath);
+
+#endif /* _HOST_TRACE_H_ */
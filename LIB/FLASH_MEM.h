@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * Module: Flash Memory Access
+ *
+ * File Name: FLASH_MEM.h
+ *
+ * Description: Header file for placing constant tables in program memory and
+ *              reading them back, so lookup tables do not occupy SRAM.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _FLASH_MEM_H_
+#define _FLASH_MEM_H_
+
+#if defined(__AVR__)
+
+#include <avr/pgmspace.h>
+
+/************************************************************************************
+ * Macro Name: FLASH_CONST
+ * Description: Qualifier that places a constant table in program memory
+ ************************************************************************************/
+#define FLASH_CONST const PROGMEM
+
+/************************************************************************************
+ * Macro Name: FLASH_READ_U8 / FLASH_READ_U16 / FLASH_READ_U32
+ * Description: Reads a value from a table declared with FLASH_CONST
+ * Parameters:
+ *      - address: Address of the element to read
+ * Return: The value stored at the given address
+ ************************************************************************************/
+#define FLASH_READ_U8(address)  pgm_read_byte(address)
+#define FLASH_READ_U16(address) pgm_read_word(address)
+#define FLASH_READ_U32(address) pgm_read_dword(address)
+
+/************************************************************************************
+ * Macro Name: FLASH_READ_U64
+ * Description: Reads a 64-bit value from a table declared with FLASH_CONST
+ * Parameters:
+ *      - address: Address of the element to read
+ * Return: The value stored at the given address
+ ************************************************************************************/
+#define FLASH_READ_U64(address) (((u64)pgm_read_dword((const u8 *)(address) + 4) << 32) | pgm_read_dword(address))
+
+#else
+
+/* Host builds have a single address space, tables are plain constants */
+#define FLASH_CONST const
+#define FLASH_READ_U8(address)  (*(address))
+#define FLASH_READ_U16(address) (*(address))
+#define FLASH_READ_U32(address) (*(address))
+#define FLASH_READ_U64(address) (*(address))
+
+#endif
+
+#endif /* _FLASH_MEM_H_ */
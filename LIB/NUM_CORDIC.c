@@ -0,0 +1,364 @@
+/******************************************************************************
+ *
+ * Module: Fixed-Point Functions
+ *
+ * File Name: NUM_CORDIC.c
+ *
+ * Description: Source file for the scientific functions. The CORDIC kernels
+ *              turn a vector by the angles atan(2^-i) or atanh(2^-i), one per
+ *              step, so each step is two shifts, three additions and a table
+ *              read. Every kernel runs NUM_CORDIC_ITERATIONS steps on 32-bit
+ *              words with NUM_CORDIC_WORK_BITS fraction bits, and every
+ *              constant they use lives in one table in flash.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_CORDIC.h"
+#include "FLASH_MEM.h"
+
+/* Fraction bits inside the kernels, the two integer bits hold the gain of the steps */
+#define NUM_CORDIC_WORK_BITS 29
+
+/* Fraction bits of the sum ln m + k * ln 2, leaves room for k up to 63 */
+#define NUM_CORDIC_SUM_BITS 24
+
+/* Layout of NUM_CORDIC_AS32Table */
+#define NUM_CORDIC_ATAN            0
+#define NUM_CORDIC_ATANH           NUM_CORDIC_ITERATIONS
+#define NUM_CORDIC_GAIN            (2 * NUM_CORDIC_ITERATIONS)
+#define NUM_CORDIC_HYPERBOLIC_GAIN (NUM_CORDIC_GAIN + 1)
+#define NUM_CORDIC_LN2             (NUM_CORDIC_GAIN + 2)
+#define NUM_CORDIC_INVERSE_LN2     (NUM_CORDIC_GAIN + 3)
+#define NUM_CORDIC_HALF_PI         (NUM_CORDIC_GAIN + 4)
+#define NUM_CORDIC_HALF_PI_LOW     (NUM_CORDIC_GAIN + 5)
+#define NUM_CORDIC_TWO_OVER_PI     (NUM_CORDIC_GAIN + 6)
+#define NUM_CORDIC_CONSTANTS       (NUM_CORDIC_GAIN + 7)
+
+/* Every constant of the kernels, NUM_CORDIC_WORK_BITS fraction bits unless noted */
+static FLASH_CONST s32 NUM_CORDIC_AS32Table[NUM_CORDIC_CONSTANTS] =
+{
+	/* atan(2^-i) of the circular steps */
+	421657428L, 248918915L, 131521918L, 66762579L, 33510843L, 16771758L, 8387925L, 4194219L,
+	2097141L, 1048575L, 524288L, 262144L, 131072L, 65536L, 32768L, 16384L,
+	8192L, 4096L, 2048L, 1024L, 512L, 256L, 128L, 64L,
+	32L, 16L, 8L, 4L,
+	/* atanh(2^-k) of the hyperbolic steps, see NUM_CORDIC_U8HyperbolicShift */
+	294906491L, 137123709L, 67461703L, 33598225L, 33598225L, 16782681L, 8389291L, 4194389L,
+	2097163L, 1048577L, 524288L, 262144L, 131072L, 65536L, 65536L, 32768L,
+	16384L, 8192L, 4096L, 2048L, 1024L, 512L, 256L, 128L,
+	64L, 32L, 16L, 8L,
+	/* Gain of the circular steps 1 / prod(sqrt(1 + 2^-2i)), inverse gain of the hyperbolic ones */
+	326016437L, 648270052L,
+	/* ln 2 and 1 / ln 2 */
+	372130559L, 774541002L,
+	/* pi / 2, what it lacks in units of 2^-61, and 2 / pi */
+	843314857L, -2007355251L, 341782638L
+};
+
+/* Reads a constant of the table */
+#define NUM_CORDIC_READ(index) ((s32)FLASH_READ_U32(&NUM_CORDIC_AS32Table[index]))
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U8HyperbolicShift
+ * Description: Shift of a hyperbolic step. The steps 4 and 13 are run twice, the
+ *              hyperbolic angles would not add up to every argument otherwise.
+ * Parameters:
+ *      - Copy_U8Step: The step, from 0
+ * Return: The shift k of the step, which turns by atanh(2^-k)
+ ************************************************************************************/
+static u8 NUM_CORDIC_U8HyperbolicShift(u8 Copy_U8Step)
+{
+	return Copy_U8Step + 1 - (Copy_U8Step >= 4) - (Copy_U8Step >= 14);
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_S32ToResult
+ * Description: Rounds a value of the kernels to NUM_CORDIC_FRACTION_BITS fraction bits.
+ * Parameters:
+ *      - Copy_S32Work: The value, NUM_CORDIC_WORK_BITS fraction bits
+ * Return: The rounded value
+ ************************************************************************************/
+static s32 NUM_CORDIC_S32ToResult(s32 Copy_S32Work)
+{
+	return (Copy_S32Work + (1L << (NUM_CORDIC_WORK_BITS - NUM_CORDIC_FRACTION_BITS - 1))) >> (NUM_CORDIC_WORK_BITS - NUM_CORDIC_FRACTION_BITS);
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U32Sqrt
+ * Description: Square root by shift and subtract, see NUM_CORDIC.h
+ * Parameters:
+ *      - Copy_U64Radicand: The radicand
+ * Return: The root rounded down
+ ************************************************************************************/
+u32 NUM_CORDIC_U32Sqrt(u64 Copy_U64Radicand)
+{
+	u64 LOC_U64Remainder = 0;
+	u32 LOC_U32Root = 0;
+	u8 LOC_U8Step;
+
+	for (LOC_U8Step = 0; LOC_U8Step < 32; LOC_U8Step++)
+	{
+		/* Bring down the next two bits of the radicand */
+		LOC_U64Remainder = (LOC_U64Remainder << 2) | (Copy_U64Radicand >> 62);
+		Copy_U64Radicand <<= 2;
+		LOC_U32Root <<= 1;
+
+		/* The next bit of the root is 1 when 2 * root + 1 can be taken from the remainder */
+		if (LOC_U64Remainder >= ((u64)LOC_U32Root << 1) + 1)
+		{
+			LOC_U64Remainder -= ((u64)LOC_U32Root << 1) + 1;
+			LOC_U32Root |= 1;
+		}
+	}
+	return LOC_U32Root;
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_VOIDSinCos
+ * Description: Sine and cosine by CORDIC rotation, see NUM_CORDIC.h
+ * Parameters:
+ *      - Copy_S32Angle: The angle, NUM_CORDIC_FRACTION_BITS fraction bits
+ *      - Copy_PS32Sine: Receives the sine
+ *      - Copy_PS32Cosine: Receives the cosine
+ * Return: None
+ ************************************************************************************/
+void NUM_CORDIC_VOIDSinCos(s32 Copy_S32Angle, s32 *Copy_PS32Sine, s32 *Copy_PS32Cosine)
+{
+	s32 LOC_S32X = NUM_CORDIC_READ(NUM_CORDIC_GAIN), LOC_S32Y = 0, LOC_S32Z, LOC_S32Next, LOC_S32Quadrant;
+	u8 LOC_U8Step;
+
+	/* Nearest multiple of pi/2, then the rest of the angle, within +-pi/4 */
+	LOC_S32Quadrant = (s32)(((s64)Copy_S32Angle * NUM_CORDIC_READ(NUM_CORDIC_TWO_OVER_PI)
+	                         + (1LL << (NUM_CORDIC_FRACTION_BITS + NUM_CORDIC_WORK_BITS - 1)))
+	                        >> (NUM_CORDIC_FRACTION_BITS + NUM_CORDIC_WORK_BITS));
+	LOC_S32Z = (s32)((s64)Copy_S32Angle * (1L << (NUM_CORDIC_WORK_BITS - NUM_CORDIC_FRACTION_BITS))
+	                 - (s64)LOC_S32Quadrant * NUM_CORDIC_READ(NUM_CORDIC_HALF_PI)
+	                 - (((s64)LOC_S32Quadrant * NUM_CORDIC_READ(NUM_CORDIC_HALF_PI_LOW) + (1LL << 31)) >> 32));
+
+	/* Turn (gain, 0) by the rest of the angle, it ends on (cos, sin) */
+	for (LOC_U8Step = 0; LOC_U8Step < NUM_CORDIC_ITERATIONS; LOC_U8Step++)
+	{
+		if (LOC_S32Z >= 0)
+		{
+			LOC_S32Next = LOC_S32X - (LOC_S32Y >> LOC_U8Step);
+			LOC_S32Y += LOC_S32X >> LOC_U8Step;
+			LOC_S32Z -= NUM_CORDIC_READ(NUM_CORDIC_ATAN + LOC_U8Step);
+		}
+		else
+		{
+			LOC_S32Next = LOC_S32X + (LOC_S32Y >> LOC_U8Step);
+			LOC_S32Y -= LOC_S32X >> LOC_U8Step;
+			LOC_S32Z += NUM_CORDIC_READ(NUM_CORDIC_ATAN + LOC_U8Step);
+		}
+		LOC_S32X = LOC_S32Next;
+	}
+
+	LOC_S32X = NUM_CORDIC_S32ToResult(LOC_S32X);
+	LOC_S32Y = NUM_CORDIC_S32ToResult(LOC_S32Y);
+	switch (LOC_S32Quadrant & 3)
+	{
+	case 0:  *Copy_PS32Sine = LOC_S32Y;  *Copy_PS32Cosine = LOC_S32X;  break;
+	case 1:  *Copy_PS32Sine = LOC_S32X;  *Copy_PS32Cosine = -LOC_S32Y; break;
+	case 2:  *Copy_PS32Sine = -LOC_S32Y; *Copy_PS32Cosine = -LOC_S32X; break;
+	default: *Copy_PS32Sine = -LOC_S32X; *Copy_PS32Cosine = LOC_S32Y;  break;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_S32Atan
+ * Description: Arctangent by CORDIC vectoring, see NUM_CORDIC.h
+ * Parameters:
+ *      - Copy_S32Value: The argument
+ *      - Copy_U8Bits: Fraction bits of the argument
+ * Return: The angle, NUM_CORDIC_FRACTION_BITS fraction bits
+ ************************************************************************************/
+s32 NUM_CORDIC_S32Atan(s32 Copy_S32Value, u8 Copy_U8Bits)
+{
+	s32 LOC_S32X = 1L << Copy_U8Bits, LOC_S32Y = Copy_S32Value, LOC_S32Z = 0, LOC_S32Next;
+	u32 LOC_U32Magnitude = ((Copy_S32Value < 0) ? 0UL - (u32)Copy_S32Value : (u32)Copy_S32Value) | (u32)LOC_S32X;
+	u8 LOC_U8Step, LOC_U8Shift;
+
+	/* Scale (1, Value) until its larger coordinate has its top bit at NUM_CORDIC_WORK_BITS - 1,
+	 * in the same steps for any argument */
+	for (LOC_U8Shift = 16; LOC_U8Shift; LOC_U8Shift >>= 1)
+	{
+		if (LOC_U32Magnitude < (1UL << (NUM_CORDIC_WORK_BITS - LOC_U8Shift)))
+		{
+			LOC_U32Magnitude <<= LOC_U8Shift;
+			LOC_S32X = (s32)((u32)LOC_S32X << LOC_U8Shift);
+			LOC_S32Y = (s32)((u32)LOC_S32Y << LOC_U8Shift);
+		}
+	}
+	for (LOC_U8Shift = 2; LOC_U8Shift; LOC_U8Shift >>= 1)
+	{
+		if (LOC_U32Magnitude >= (1UL << (NUM_CORDIC_WORK_BITS - 1 + LOC_U8Shift)))
+		{
+			LOC_U32Magnitude >>= LOC_U8Shift;
+			LOC_S32X >>= LOC_U8Shift;
+			LOC_S32Y >>= LOC_U8Shift;
+		}
+	}
+
+	/* Turn the vector onto the x axis, the angles turned add up to its own */
+	for (LOC_U8Step = 0; LOC_U8Step < NUM_CORDIC_ITERATIONS; LOC_U8Step++)
+	{
+		if (LOC_S32Y < 0)
+		{
+			LOC_S32Next = LOC_S32X - (LOC_S32Y >> LOC_U8Step);
+			LOC_S32Y += LOC_S32X >> LOC_U8Step;
+			LOC_S32Z -= NUM_CORDIC_READ(NUM_CORDIC_ATAN + LOC_U8Step);
+		}
+		else
+		{
+			LOC_S32Next = LOC_S32X + (LOC_S32Y >> LOC_U8Step);
+			LOC_S32Y -= LOC_S32X >> LOC_U8Step;
+			LOC_S32Z += NUM_CORDIC_READ(NUM_CORDIC_ATAN + LOC_U8Step);
+		}
+		LOC_S32X = LOC_S32Next;
+	}
+	return NUM_CORDIC_S32ToResult(LOC_S32Z);
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U8Exp
+ * Description: Exponential by hyperbolic CORDIC rotation, see NUM_CORDIC.h
+ * Parameters:
+ *      - Copy_PS32Result: Receives the power when there is no error
+ *      - Copy_PU8Bits: Receives the fraction bits of the power
+ *      - Copy_S32Argument: The exponent, NUM_CORDIC_FRACTION_BITS fraction bits
+ * Return: NUM_CORDIC_OK or NUM_CORDIC_OVERFLOW
+ ************************************************************************************/
+u8 NUM_CORDIC_U8Exp(s32 *Copy_PS32Result, u8 *Copy_PU8Bits, s32 Copy_S32Argument)
+{
+	s32 LOC_S32X = NUM_CORDIC_READ(NUM_CORDIC_HYPERBOLIC_GAIN), LOC_S32Y = 0, LOC_S32Z, LOC_S32Next;
+	s32 LOC_S32Exponent, LOC_S32Shift;
+	u8 LOC_U8Step, LOC_U8Shift, LOC_U8Bits, LOC_U8State = NUM_CORDIC_OK;
+
+	/* Argument = k * ln 2 + r, r from 0 to ln 2 */
+	LOC_S32Exponent = (s32)(((s64)Copy_S32Argument * NUM_CORDIC_READ(NUM_CORDIC_INVERSE_LN2))
+	                        >> (NUM_CORDIC_FRACTION_BITS + NUM_CORDIC_WORK_BITS));
+	LOC_S32Z = (s32)((s64)Copy_S32Argument * (1L << (NUM_CORDIC_WORK_BITS - NUM_CORDIC_FRACTION_BITS))
+	                 - (s64)LOC_S32Exponent * NUM_CORDIC_READ(NUM_CORDIC_LN2));
+
+	/* Turn (1 / gain, 0) by the hyperbolic angle r, it ends on (cosh r, sinh r) */
+	for (LOC_U8Step = 0; LOC_U8Step < NUM_CORDIC_ITERATIONS; LOC_U8Step++)
+	{
+		LOC_U8Shift = NUM_CORDIC_U8HyperbolicShift(LOC_U8Step);
+		if (LOC_S32Z >= 0)
+		{
+			LOC_S32Next = LOC_S32X + (LOC_S32Y >> LOC_U8Shift);
+			LOC_S32Y += LOC_S32X >> LOC_U8Shift;
+			LOC_S32Z -= NUM_CORDIC_READ(NUM_CORDIC_ATANH + LOC_U8Step);
+		}
+		else
+		{
+			LOC_S32Next = LOC_S32X - (LOC_S32Y >> LOC_U8Shift);
+			LOC_S32Y -= LOC_S32X >> LOC_U8Shift;
+			LOC_S32Z += NUM_CORDIC_READ(NUM_CORDIC_ATANH + LOC_U8Step);
+		}
+		LOC_S32X = LOC_S32Next;
+	}
+
+	/* e^r = cosh r + sinh r, below 2 unless rounding carried r up to ln 2 */
+	LOC_S32X += LOC_S32Y;
+	if (LOC_S32X >= (1L << (NUM_CORDIC_WORK_BITS + 1)))
+	{
+		LOC_S32X = (LOC_S32X + 1) >> 1;
+		LOC_S32Exponent++;
+	}
+
+	/* e^Argument = e^r * 2^k needs k + 1 integer bits */
+	if (LOC_S32Exponent > NUM_CORDIC_WORK_BITS + 1)
+	{
+		LOC_U8State = NUM_CORDIC_OVERFLOW;
+	}
+	else
+	{
+		LOC_U8Bits = (LOC_S32Exponent < NUM_CORDIC_WORK_BITS + 1 - NUM_CORDIC_FRACTION_BITS)
+		           ? NUM_CORDIC_FRACTION_BITS : (u8)(NUM_CORDIC_WORK_BITS + 1 - LOC_S32Exponent);
+		LOC_S32Shift = NUM_CORDIC_WORK_BITS - LOC_S32Exponent - LOC_U8Bits;
+		if (LOC_S32Shift < 0)
+		{
+			LOC_S32X = (s32)((u32)LOC_S32X << 1);
+		}
+		else if (LOC_S32Shift > NUM_CORDIC_WORK_BITS + 1)
+		{
+			LOC_S32X = 0;
+		}
+		else
+		{
+			LOC_S32X = (LOC_S32X + ((1L << LOC_S32Shift) >> 1)) >> LOC_S32Shift;
+		}
+		*Copy_PS32Result = LOC_S32X;
+		*Copy_PU8Bits = LOC_U8Bits;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U8Log
+ * Description: Natural logarithm by hyperbolic CORDIC vectoring, see NUM_CORDIC.h
+ * Parameters:
+ *      - Copy_PS32Result: Receives the logarithm when there is no error
+ *      - Copy_S32Value: The argument
+ *      - Copy_U8Bits: Fraction bits of the argument
+ * Return: NUM_CORDIC_OK or NUM_CORDIC_DOMAIN
+ ************************************************************************************/
+u8 NUM_CORDIC_U8Log(s32 *Copy_PS32Result, s32 Copy_S32Value, u8 Copy_U8Bits)
+{
+	u32 LOC_U32Mantissa = (u32)Copy_S32Value;
+	s32 LOC_S32X, LOC_S32Y, LOC_S32Z = 0, LOC_S32Next, LOC_S32Exponent = NUM_CORDIC_WORK_BITS - Copy_U8Bits;
+	u8 LOC_U8Step, LOC_U8Shift, LOC_U8State = NUM_CORDIC_OK;
+
+	if (Copy_S32Value <= 0)
+	{
+		LOC_U8State = NUM_CORDIC_DOMAIN;
+	}
+	else
+	{
+		/* Value = m * 2^k with m from 1 to 2, the top bit of m at NUM_CORDIC_WORK_BITS */
+		for (LOC_U8Shift = 16; LOC_U8Shift; LOC_U8Shift >>= 1)
+		{
+			if (LOC_U32Mantissa < (1UL << (NUM_CORDIC_WORK_BITS + 1 - LOC_U8Shift)))
+			{
+				LOC_U32Mantissa <<= LOC_U8Shift;
+				LOC_S32Exponent -= LOC_U8Shift;
+			}
+		}
+		if (LOC_U32Mantissa >= (1UL << (NUM_CORDIC_WORK_BITS + 1)))
+		{
+			LOC_U32Mantissa >>= 1;
+			LOC_S32Exponent++;
+		}
+
+		/* Turn (m + 1, m - 1) onto the x axis, the hyperbolic angle is atanh((m - 1) / (m + 1)) */
+		LOC_S32X = (s32)LOC_U32Mantissa + (1L << NUM_CORDIC_WORK_BITS);
+		LOC_S32Y = (s32)LOC_U32Mantissa - (1L << NUM_CORDIC_WORK_BITS);
+		for (LOC_U8Step = 0; LOC_U8Step < NUM_CORDIC_ITERATIONS; LOC_U8Step++)
+		{
+			LOC_U8Shift = NUM_CORDIC_U8HyperbolicShift(LOC_U8Step);
+			if (LOC_S32Y < 0)
+			{
+				LOC_S32Next = LOC_S32X + (LOC_S32Y >> LOC_U8Shift);
+				LOC_S32Y += LOC_S32X >> LOC_U8Shift;
+				LOC_S32Z -= NUM_CORDIC_READ(NUM_CORDIC_ATANH + LOC_U8Step);
+			}
+			else
+			{
+				LOC_S32Next = LOC_S32X - (LOC_S32Y >> LOC_U8Shift);
+				LOC_S32Y -= LOC_S32X >> LOC_U8Shift;
+				LOC_S32Z += NUM_CORDIC_READ(NUM_CORDIC_ATANH + LOC_U8Step);
+			}
+			LOC_S32X = LOC_S32Next;
+		}
+
+		/* ln m = 2 * angle, then k * ln 2 is added with fewer fraction bits so it fits */
+		LOC_S32Z = (LOC_S32Z >> (NUM_CORDIC_WORK_BITS - 1 - NUM_CORDIC_SUM_BITS))
+		         + LOC_S32Exponent * ((NUM_CORDIC_READ(NUM_CORDIC_LN2) + (1L << (NUM_CORDIC_WORK_BITS - NUM_CORDIC_SUM_BITS - 1)))
+		                              >> (NUM_CORDIC_WORK_BITS - NUM_CORDIC_SUM_BITS));
+		*Copy_PS32Result = (LOC_S32Z + (1L << (NUM_CORDIC_SUM_BITS - NUM_CORDIC_FRACTION_BITS - 1))) >> (NUM_CORDIC_SUM_BITS - NUM_CORDIC_FRACTION_BITS);
+	}
+	return LOC_U8State;
+}
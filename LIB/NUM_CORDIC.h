@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Module: Fixed-Point Functions
+ *
+ * File Name: NUM_CORDIC.h
+ *
+ * Description: Header file for the scientific functions of the calculator on
+ *              binary fixed-point numbers: sine, cosine, arctangent,
+ *              exponential and natural logarithm by CORDIC, which only
+ *              shifts and adds, and the square root by shift and subtract.
+ *              Every function runs the same number of steps whatever its
+ *              argument, so its cycle count is fixed.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_CORDIC_H_
+#define _NUM_CORDIC_H_
+
+#include "STD_TYPES.h"
+
+/* Status of an operation, the error codes match the error states of the Calculator */
+#define NUM_CORDIC_OK       0
+#define NUM_CORDIC_DOMAIN   2
+#define NUM_CORDIC_OVERFLOW 3
+
+/* Fraction bits of the arguments and results, an s32 then holds +-32767.99998 */
+#define NUM_CORDIC_FRACTION_BITS 16
+#define NUM_CORDIC_ONE (1L << NUM_CORDIC_FRACTION_BITS)
+
+/* CORDIC steps of every function, each one adds about a bit of precision */
+#define NUM_CORDIC_ITERATIONS 28
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U32Sqrt
+ * Description: Square root of an integer by shift and subtract, one bit of the root
+ *              per step and 32 steps for any radicand. Shifting the radicand left by
+ *              twice the fraction bits gives the root of a fixed-point number.
+ * Parameters:
+ *      - Copy_U64Radicand: The radicand
+ * Return: The root rounded down
+ ************************************************************************************/
+u32 NUM_CORDIC_U32Sqrt(u64 Copy_U64Radicand);
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_VOIDSinCos
+ * Description: Sine and cosine of an angle in radians, both from one CORDIC rotation.
+ *              The angle is first brought within +-pi/4 by a multiple of pi/2 held
+ *              to 61 bits, so the error stays below 2^-16 up to the largest angle.
+ * Parameters:
+ *      - Copy_S32Angle: The angle, NUM_CORDIC_FRACTION_BITS fraction bits
+ *      - Copy_PS32Sine: Receives the sine, NUM_CORDIC_FRACTION_BITS fraction bits
+ *      - Copy_PS32Cosine: Receives the cosine, NUM_CORDIC_FRACTION_BITS fraction bits
+ * Return: None
+ ************************************************************************************/
+void NUM_CORDIC_VOIDSinCos(s32 Copy_S32Angle, s32 *Copy_PS32Sine, s32 *Copy_PS32Cosine);
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_S32Atan
+ * Description: Arctangent of a number of any fixed-point format, as the angle of the
+ *              vector (1, Value) by CORDIC vectoring. The vector is scaled to the full
+ *              width first, so small and large arguments keep their precision.
+ * Parameters:
+ *      - Copy_S32Value: The argument
+ *      - Copy_U8Bits: Fraction bits of the argument, 0 to NUM_CORDIC_FRACTION_BITS
+ * Return: The angle in radians, NUM_CORDIC_FRACTION_BITS fraction bits
+ ************************************************************************************/
+s32 NUM_CORDIC_S32Atan(s32 Copy_S32Value, u8 Copy_U8Bits);
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U8Exp
+ * Description: e raised to Argument as 2^k * e^r with r below ln 2, e^r by hyperbolic
+ *              CORDIC. The result keeps NUM_CORDIC_FRACTION_BITS fraction bits while it
+ *              fits, and gives up fraction bits as it grows.
+ * Parameters:
+ *      - Copy_PS32Result: Receives the power when there is no error
+ *      - Copy_PU8Bits: Receives the fraction bits of the power
+ *      - Copy_S32Argument: The exponent, NUM_CORDIC_FRACTION_BITS fraction bits
+ * Return: NUM_CORDIC_OK, or NUM_CORDIC_OVERFLOW when the power does not fit 32 bits
+ ************************************************************************************/
+u8 NUM_CORDIC_U8Exp(s32 *Copy_PS32Result, u8 *Copy_PU8Bits, s32 Copy_S32Argument);
+
+/************************************************************************************
+ * Function Name: NUM_CORDIC_U8Log
+ * Description: Natural logarithm of a number of any fixed-point format as
+ *              ln m + k * ln 2, with m between 1 and 2 and ln m = 2 * atanh((m - 1) /
+ *              (m + 1)) by hyperbolic CORDIC vectoring.
+ * Parameters:
+ *      - Copy_PS32Result: Receives the logarithm, NUM_CORDIC_FRACTION_BITS fraction
+ *                         bits, when there is no error
+ *      - Copy_S32Value: The argument
+ *      - Copy_U8Bits: Fraction bits of the argument, 0 to NUM_CORDIC_FRACTION_BITS
+ * Return: NUM_CORDIC_OK, or NUM_CORDIC_DOMAIN when the argument is not above zero
+ ************************************************************************************/
+u8 NUM_CORDIC_U8Log(s32 *Copy_PS32Result, s32 Copy_S32Value, u8 Copy_U8Bits);
+
+#endif /* _NUM_CORDIC_H_ */
@@ -0,0 +1,454 @@
+/******************************************************************************
+ *
+ * Module: Fixed-Point Decimal
+ *
+ * File Name: NUM_FIXED.c
+ *
+ * Description: Source file for the fixed-point decimal numbers. A product
+ *              of two scaled numbers carries the scale twice, and a quotient
+ *              needs the dividend scaled once more, so both go through a
+ *              64-bit intermediate built from 16-bit partial products and
+ *              are brought back by one shift-and-subtract division, whose
+ *              precondition is also the overflow check.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_FIXED.h"
+#include "NUM_FMT.h"
+#include "FLASH_MEM.h"
+
+/* Powers of ten up to the scale, the place value of each fractional digit */
+static FLASH_CONST u16 NUM_FIXED_AU16PowersOfTen[NUM_FIXED_FRACTION_DIGITS + 1] =
+{
+	1
+#if NUM_FIXED_FRACTION_DIGITS >= 1
+	, 10
+#endif
+#if NUM_FIXED_FRACTION_DIGITS >= 2
+	, 100
+#endif
+#if NUM_FIXED_FRACTION_DIGITS >= 3
+	, 1000
+#endif
+#if NUM_FIXED_FRACTION_DIGITS >= 4
+	, 10000
+#endif
+};
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Divide
+ * Description: Divides a 64-bit value given in halves by a 32-bit divisor, one
+ *              quotient bit per step. The quotient fits 32 bits only when the high
+ *              half is below the divisor, which is checked first.
+ * Parameters:
+ *      - Copy_U32High: High half of the dividend
+ *      - Copy_U32Low: Low half of the dividend
+ *      - Copy_U32Divisor: The divisor, not zero
+ *      - Copy_PResult: Receives the quotient when it is at most NUM_FIXED_MAX
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_FIXED_U8Divide(u32 Copy_U32High, u32 Copy_U32Low, u32 Copy_U32Divisor, NUM_FIXED_Type *Copy_PResult)
+{
+	u8 LOC_U8Step;
+	u8 LOC_U8Carry;
+
+	if (Copy_U32High >= Copy_U32Divisor)
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	for (LOC_U8Step = 0; LOC_U8Step < 32; LOC_U8Step++)
+	{
+		/* The remainder may reach 33 bits before the subtraction, keep the bit shifted out */
+		LOC_U8Carry = (u8)(Copy_U32High >> 31);
+		Copy_U32High = (Copy_U32High << 1) | (Copy_U32Low >> 31);
+		Copy_U32Low <<= 1;
+		if (LOC_U8Carry || Copy_U32High >= Copy_U32Divisor)
+		{
+			Copy_U32High -= Copy_U32Divisor;
+			Copy_U32Low |= 1;
+		}
+	}
+	if (Copy_U32Low > (u32)NUM_FIXED_MAX)
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	*Copy_PResult = (NUM_FIXED_Type)Copy_U32Low;
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_VOIDMultiply
+ * Description: Multiplies two 32-bit magnitudes into a 64-bit product from their
+ *              16-bit halves, so only 16x16 multiplications are needed
+ * Parameters:
+ *      - Copy_U32Left: Left magnitude
+ *      - Copy_U32Right: Right magnitude
+ *      - Copy_PU32High: Receives the high half of the product
+ *      - Copy_PU32Low: Receives the low half of the product
+ * Return: None
+ ************************************************************************************/
+static void NUM_FIXED_VOIDMultiply(u32 Copy_U32Left, u32 Copy_U32Right, u32 *Copy_PU32High, u32 *Copy_PU32Low)
+{
+	u32 LOC_U32Low = (u32)(u16)Copy_U32Left * (u16)Copy_U32Right;
+	u32 LOC_U32Cross1 = (u32)(u16)(Copy_U32Left >> 16) * (u16)Copy_U32Right;
+	u32 LOC_U32Cross2 = (u32)(u16)Copy_U32Left * (u16)(Copy_U32Right >> 16);
+	u32 LOC_U32High = (u32)(u16)(Copy_U32Left >> 16) * (u16)(Copy_U32Right >> 16);
+	u32 LOC_U32Sum;
+
+	LOC_U32High += (LOC_U32Cross1 >> 16) + (LOC_U32Cross2 >> 16);
+	LOC_U32Sum = LOC_U32Low + (LOC_U32Cross1 << 16);
+	LOC_U32High += (LOC_U32Sum < LOC_U32Low);
+	LOC_U32Low = LOC_U32Sum + (LOC_U32Cross2 << 16);
+	LOC_U32High += (LOC_U32Low < LOC_U32Sum);
+
+	*Copy_PU32High = LOC_U32High;
+	*Copy_PU32Low = LOC_U32Low;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Scale
+ * Description: Rounds a 64-bit magnitude divided by a divisor half away from zero
+ *              and applies the sign
+ * Parameters:
+ *      - Copy_U32High: High half of the magnitude
+ *      - Copy_U32Low: Low half of the magnitude
+ *      - Copy_U32Divisor: The divisor, not zero
+ *      - Copy_U8Negative: 1 when the result is negative
+ *      - Copy_PResult: Receives the result when it fits
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_FIXED_U8Scale(u32 Copy_U32High, u32 Copy_U32Low, u32 Copy_U32Divisor, u8 Copy_U8Negative, NUM_FIXED_Type *Copy_PResult)
+{
+	u32 LOC_U32Low = Copy_U32Low + (Copy_U32Divisor >> 1);
+	NUM_FIXED_Type LOC_Result;
+	u8 LOC_U8State;
+
+	Copy_U32High += (LOC_U32Low < Copy_U32Low);
+	LOC_U8State = NUM_FIXED_U8Divide(Copy_U32High, LOC_U32Low, Copy_U32Divisor, &LOC_Result);
+	if (NUM_FIXED_OK == LOC_U8State)
+	{
+		*Copy_PResult = Copy_U8Negative ? -LOC_Result : LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8FromS32
+ * Description: Converts an integer to a fixed-point number
+ * Parameters:
+ *      - Copy_PNumber: Receives the number when it fits
+ *      - Copy_S32Integer: The integer
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8FromS32(NUM_FIXED_Type *Copy_PNumber, s32 Copy_S32Integer)
+{
+	if (Copy_S32Integer > (s32)(NUM_FIXED_MAX / NUM_FIXED_SCALE) || Copy_S32Integer < -(s32)(NUM_FIXED_MAX / NUM_FIXED_SCALE))
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	*Copy_PNumber = Copy_S32Integer * (s32)NUM_FIXED_SCALE;
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Add
+ * Description: Adds two fixed-point numbers, an overflow shows as a result whose
+ *              sign differs from two operands of the same sign
+ * Parameters:
+ *      - Copy_PResult: Receives the sum when it fits
+ *      - Copy_Left: Left operand
+ *      - Copy_Right: Right operand
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8Add(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right)
+{
+	NUM_FIXED_Type LOC_Result = (NUM_FIXED_Type)((u32)Copy_Left + (u32)Copy_Right);
+
+	if ((~(Copy_Left ^ Copy_Right) & (Copy_Left ^ LOC_Result)) < 0 || LOC_Result < -NUM_FIXED_MAX)
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	*Copy_PResult = LOC_Result;
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Sub
+ * Description: Subtracts two fixed-point numbers, an overflow shows as a result whose
+ *              sign differs from a left operand of the other sign than the right one
+ * Parameters:
+ *      - Copy_PResult: Receives the difference when it fits
+ *      - Copy_Left: Left operand
+ *      - Copy_Right: Right operand
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8Sub(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right)
+{
+	NUM_FIXED_Type LOC_Result = (NUM_FIXED_Type)((u32)Copy_Left - (u32)Copy_Right);
+
+	if (((Copy_Left ^ Copy_Right) & (Copy_Left ^ LOC_Result)) < 0 || LOC_Result < -NUM_FIXED_MAX)
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	*Copy_PResult = LOC_Result;
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Mul
+ * Description: Multiplies two fixed-point numbers, the product of the magnitudes is
+ *              divided by the scale once
+ * Parameters:
+ *      - Copy_PResult: Receives the product when it fits
+ *      - Copy_Left: Left operand
+ *      - Copy_Right: Right operand
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8Mul(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right)
+{
+	u32 LOC_U32High;
+	u32 LOC_U32Low;
+
+	NUM_FIXED_VOIDMultiply((Copy_Left < 0) ? 0UL - (u32)Copy_Left : (u32)Copy_Left,
+	                       (Copy_Right < 0) ? 0UL - (u32)Copy_Right : (u32)Copy_Right,
+	                       &LOC_U32High, &LOC_U32Low);
+	return NUM_FIXED_U8Scale(LOC_U32High, LOC_U32Low, NUM_FIXED_SCALE, (Copy_Left ^ Copy_Right) < 0, Copy_PResult);
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Div
+ * Description: Divides two fixed-point numbers, the magnitude of the dividend is
+ *              multiplied by the scale before the division
+ * Parameters:
+ *      - Copy_PResult: Receives the quotient when there is no error
+ *      - Copy_Left: Dividend
+ *      - Copy_Right: Divisor
+ * Return: NUM_FIXED_OK, NUM_FIXED_DIV_ZERO or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8Div(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right)
+{
+	u32 LOC_U32High;
+	u32 LOC_U32Low;
+
+	if (0 == Copy_Right)
+	{
+		return NUM_FIXED_DIV_ZERO;
+	}
+	NUM_FIXED_VOIDMultiply((Copy_Left < 0) ? 0UL - (u32)Copy_Left : (u32)Copy_Left, NUM_FIXED_SCALE,
+	                       &LOC_U32High, &LOC_U32Low);
+	return NUM_FIXED_U8Scale(LOC_U32High, LOC_U32Low, (Copy_Right < 0) ? 0UL - (u32)Copy_Right : (u32)Copy_Right,
+	                         (Copy_Left ^ Copy_Right) < 0, Copy_PResult);
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8AppendDigit
+ * Description: Appends a typed digit to a number that is not negative
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ *      - Copy_PU8Point: Position of the point, updated
+ *      - Copy_U8Digit: The digit, 0 to 9
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8AppendDigit(NUM_FIXED_Type *Copy_PNumber, u8 *Copy_PU8Point, u8 Copy_U8Digit)
+{
+	u8 LOC_U8Point = *Copy_PU8Point;
+	NUM_FIXED_Type LOC_Number = *Copy_PNumber;
+	NUM_FIXED_Type LOC_Place;
+
+	if (0 == LOC_U8Point)
+	{
+		/* Shift the integer part, the fraction is still zero */
+		if (LOC_Number > NUM_FIXED_MAX / 10)
+		{
+			return NUM_FIXED_OVERFLOW;
+		}
+		LOC_Number *= 10;
+		LOC_Place = (NUM_FIXED_Type)NUM_FIXED_SCALE;
+	}
+	else if (LOC_U8Point <= NUM_FIXED_FRACTION_DIGITS)
+	{
+		LOC_Place = (NUM_FIXED_Type)FLASH_READ_U16(&NUM_FIXED_AU16PowersOfTen[NUM_FIXED_FRACTION_DIGITS - LOC_U8Point]);
+	}
+	else
+	{
+		LOC_Place = 0;
+	}
+	if (LOC_Number > NUM_FIXED_MAX - LOC_Place * Copy_U8Digit)
+	{
+		return NUM_FIXED_OVERFLOW;
+	}
+	*Copy_PNumber = LOC_Number + LOC_Place * Copy_U8Digit;
+	if (0 != LOC_U8Point && 0xFF != LOC_U8Point)
+	{
+		*Copy_PU8Point = LOC_U8Point + 1;
+	}
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_VOIDDropDigit
+ * Description: Removes the last typed digit, or the point when no digit follows it
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ *      - Copy_PU8Point: Position of the point, updated
+ * Return: None
+ ************************************************************************************/
+void NUM_FIXED_VOIDDropDigit(NUM_FIXED_Type *Copy_PNumber, u8 *Copy_PU8Point)
+{
+	u8 LOC_U8Point = *Copy_PU8Point;
+	NUM_FIXED_Type LOC_Place;
+
+	if (0 == LOC_U8Point)
+	{
+		*Copy_PNumber = *Copy_PNumber / (10 * (NUM_FIXED_Type)NUM_FIXED_SCALE) * (NUM_FIXED_Type)NUM_FIXED_SCALE;
+	}
+	else
+	{
+		/* The digit typed last sits at fractional position Point - 1 */
+		if (LOC_U8Point > 1 && LOC_U8Point - 1 <= NUM_FIXED_FRACTION_DIGITS)
+		{
+			LOC_Place = (NUM_FIXED_Type)FLASH_READ_U16(&NUM_FIXED_AU16PowersOfTen[NUM_FIXED_FRACTION_DIGITS + 1 - LOC_U8Point]);
+			*Copy_PNumber -= (*Copy_PNumber / LOC_Place % 10) * LOC_Place;
+		}
+		*Copy_PU8Point = LOC_U8Point - 1;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8FromAscii
+ * Description: Parses a null-terminated decimal, rounding the digits past the
+ *              precision half away from zero
+ * Parameters:
+ *      - Copy_PU8Text: The text
+ *      - Copy_PNumber: Receives the number when there is no error
+ * Return: NUM_FIXED_OK, NUM_FIXED_SYNTAX or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8FromAscii(const u8 *Copy_PU8Text, NUM_FIXED_Type *Copy_PNumber)
+{
+	NUM_FIXED_Type LOC_Number = 0;
+	u8 LOC_U8Point = 0;
+	u8 LOC_U8Negative = 0;
+	u8 LOC_U8Digits = 0;
+	u8 LOC_U8RoundUp = 0;
+
+	if ('-' == *Copy_PU8Text)
+	{
+		LOC_U8Negative = 1;
+		Copy_PU8Text++;
+	}
+	for (; '\0' != *Copy_PU8Text; Copy_PU8Text++)
+	{
+		if ('.' == *Copy_PU8Text && 0 == LOC_U8Point)
+		{
+			LOC_U8Point = 1;
+		}
+		else if (*Copy_PU8Text >= '0' && *Copy_PU8Text <= '9')
+		{
+			/* Only the first digit past the precision decides the rounding */
+			if (NUM_FIXED_FRACTION_DIGITS + 1 == LOC_U8Point && *Copy_PU8Text >= '5')
+			{
+				LOC_U8RoundUp = 1;
+			}
+			if (NUM_FIXED_OK != NUM_FIXED_U8AppendDigit(&LOC_Number, &LOC_U8Point, *Copy_PU8Text - '0'))
+			{
+				return NUM_FIXED_OVERFLOW;
+			}
+			LOC_U8Digits++;
+		}
+		else
+		{
+			return NUM_FIXED_SYNTAX;
+		}
+	}
+	if (0 == LOC_U8Digits)
+	{
+		return NUM_FIXED_SYNTAX;
+	}
+	if (LOC_U8RoundUp)
+	{
+		if (NUM_FIXED_MAX == LOC_Number)
+		{
+			return NUM_FIXED_OVERFLOW;
+		}
+		LOC_Number++;
+	}
+	*Copy_PNumber = LOC_U8Negative ? -LOC_Number : LOC_Number;
+	return NUM_FIXED_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8ToAscii
+ * Description: Writes a number in decimal without the trailing zeros of its fraction
+ * Parameters:
+ *      - Copy_Number: The number to write
+ *      - Copy_U8Buffer: Destination of at least NUM_FIXED_BUFFER_SIZE bytes
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_FIXED_U8ToAscii(NUM_FIXED_Type Copy_Number, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Digits[NUM_FMT_U32_BUFFER_SIZE + NUM_FIXED_FRACTION_DIGITS];
+	u8 LOC_U8Length;
+	u8 LOC_U8Integer;
+	u8 LOC_U8Index;
+	u8 LOC_U8Written = 0;
+
+	if (Copy_Number < 0)
+	{
+		Copy_U8Buffer[LOC_U8Written++] = '-';
+	}
+	/* Pad with leading zeros so at least one digit stands before the point */
+	LOC_U8Length = NUM_FMT_U8U32ToAscii((Copy_Number < 0) ? 0UL - (u32)Copy_Number : (u32)Copy_Number,
+	                                    &LOC_U8Digits[NUM_FIXED_FRACTION_DIGITS]);
+	LOC_U8Index = NUM_FIXED_FRACTION_DIGITS;
+	while (LOC_U8Length <= NUM_FIXED_FRACTION_DIGITS)
+	{
+		LOC_U8Digits[--LOC_U8Index] = '0';
+		LOC_U8Length++;
+	}
+	LOC_U8Integer = LOC_U8Length - NUM_FIXED_FRACTION_DIGITS;
+
+	/* Trim the trailing zeros of the fraction */
+	while (LOC_U8Length > LOC_U8Integer && '0' == LOC_U8Digits[LOC_U8Index + LOC_U8Length - 1])
+	{
+		LOC_U8Length--;
+	}
+	while (LOC_U8Integer-- > 0)
+	{
+		Copy_U8Buffer[LOC_U8Written++] = LOC_U8Digits[LOC_U8Index++];
+		LOC_U8Length--;
+	}
+	if (LOC_U8Length > 0)
+	{
+		Copy_U8Buffer[LOC_U8Written++] = '.';
+		while (LOC_U8Length-- > 0)
+		{
+			Copy_U8Buffer[LOC_U8Written++] = LOC_U8Digits[LOC_U8Index++];
+		}
+	}
+	Copy_U8Buffer[LOC_U8Written] = '\0';
+	return LOC_U8Written;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Point
+ * Description: Returns the position of the point after the digits NUM_FIXED_U8ToAscii
+ *              writes
+ * Parameters:
+ *      - Copy_Number: The number
+ * Return: 0 for a whole number, else 1 plus the digits written after the point
+ ************************************************************************************/
+u8 NUM_FIXED_U8Point(NUM_FIXED_Type Copy_Number)
+{
+	u8 LOC_U8Point = NUM_FIXED_FRACTION_DIGITS + 1;
+	u8 LOC_U8Place = 1;
+
+	while (LOC_U8Place <= NUM_FIXED_FRACTION_DIGITS
+	       && 0 == Copy_Number % (NUM_FIXED_Type)FLASH_READ_U16(&NUM_FIXED_AU16PowersOfTen[LOC_U8Place]))
+	{
+		LOC_U8Place++;
+		LOC_U8Point--;
+	}
+	return (1 == LOC_U8Point) ? 0 : LOC_U8Point;
+}
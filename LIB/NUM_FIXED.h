@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Module: Fixed-Point Decimal
+ *
+ * File Name: NUM_FIXED.h
+ *
+ * Description: Header file for decimal numbers with a fixed number of
+ *              fractional digits, kept as an s32 scaled by a power of ten.
+ *              Sums are plain integer additions, products and quotients are
+ *              rounded half away from zero by a 32-step shift-and-subtract
+ *              division, so no floating point or 64-bit library routine is
+ *              linked.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_FIXED_H_
+#define _NUM_FIXED_H_
+
+#include "STD_TYPES.h"
+
+/************************************************************************************
+ * Description: Decimal digits kept after the point, 0 to 4. Each digit divides the
+ *              range of the integer part by ten, 3 digits leave +-2147483.647.
+ *              May be set from the command line.
+ * Default: 3
+ ************************************************************************************/
+#ifndef NUM_FIXED_FRACTION_DIGITS
+#define NUM_FIXED_FRACTION_DIGITS 3
+#endif
+
+#if NUM_FIXED_FRACTION_DIGITS == 0
+#define NUM_FIXED_SCALE 1UL
+#elif NUM_FIXED_FRACTION_DIGITS == 1
+#define NUM_FIXED_SCALE 10UL
+#elif NUM_FIXED_FRACTION_DIGITS == 2
+#define NUM_FIXED_SCALE 100UL
+#elif NUM_FIXED_FRACTION_DIGITS == 3
+#define NUM_FIXED_SCALE 1000UL
+#elif NUM_FIXED_FRACTION_DIGITS == 4
+#define NUM_FIXED_SCALE 10000UL
+#else
+#error "NUM_FIXED_FRACTION_DIGITS must be 0 to 4"
+#endif
+
+/* Largest magnitude, the lowest s32 is left out so negating never overflows */
+#define NUM_FIXED_MAX 0x7FFFFFFFL
+
+/* Longest text of a number: sign, 10 digits, point and null terminator */
+#define NUM_FIXED_BUFFER_SIZE 13
+
+/* Status of an operation, the error codes match the error states of the Calculator */
+#define NUM_FIXED_OK       0
+#define NUM_FIXED_SYNTAX   1
+#define NUM_FIXED_DIV_ZERO 2
+#define NUM_FIXED_OVERFLOW 3
+
+/* A decimal number, its value times NUM_FIXED_SCALE */
+typedef s32 NUM_FIXED_Type;
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8FromS32
+ * Description: Converts an integer to a fixed-point number
+ * Parameters:
+ *      - Copy_PNumber: Receives the number when it fits
+ *      - Copy_S32Integer: The integer
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8FromS32(NUM_FIXED_Type *Copy_PNumber, s32 Copy_S32Integer);
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Add / NUM_FIXED_U8Sub / NUM_FIXED_U8Mul / NUM_FIXED_U8Div
+ * Description: Arithmetic on fixed-point numbers. Products and quotients are rounded
+ *              half away from zero to NUM_FIXED_FRACTION_DIGITS digits.
+ * Parameters:
+ *      - Copy_PResult: Receives the result when there is no error
+ *      - Copy_Left: Left operand
+ *      - Copy_Right: Right operand
+ * Return: NUM_FIXED_OK, NUM_FIXED_DIV_ZERO or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8Add(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right);
+u8 NUM_FIXED_U8Sub(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right);
+u8 NUM_FIXED_U8Mul(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right);
+u8 NUM_FIXED_U8Div(NUM_FIXED_Type *Copy_PResult, NUM_FIXED_Type Copy_Left, NUM_FIXED_Type Copy_Right);
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8AppendDigit / NUM_FIXED_VOIDDropDigit
+ * Description: Decimal entry on a number that is not negative. The point keeps track
+ *              of where the next digit goes: 0 before a point is typed, then 1 plus
+ *              the digits typed after it. Digits past NUM_FIXED_FRACTION_DIGITS are
+ *              accepted and ignored. Dropping removes the last digit, or the point
+ *              itself once no digit follows it.
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ *      - Copy_PU8Point: Position of the point, updated
+ *      - Copy_U8Digit: The digit, 0 to 9 (Append only)
+ * Return: NUM_FIXED_OK or NUM_FIXED_OVERFLOW (Append only)
+ ************************************************************************************/
+u8 NUM_FIXED_U8AppendDigit(NUM_FIXED_Type *Copy_PNumber, u8 *Copy_PU8Point, u8 Copy_U8Digit);
+void NUM_FIXED_VOIDDropDigit(NUM_FIXED_Type *Copy_PNumber, u8 *Copy_PU8Point);
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8FromAscii
+ * Description: Parses a null-terminated decimal such as "-12.5". Digits past
+ *              NUM_FIXED_FRACTION_DIGITS round half away from zero.
+ * Parameters:
+ *      - Copy_PU8Text: The text
+ *      - Copy_PNumber: Receives the number when there is no error
+ * Return: NUM_FIXED_OK, NUM_FIXED_SYNTAX or NUM_FIXED_OVERFLOW
+ ************************************************************************************/
+u8 NUM_FIXED_U8FromAscii(const u8 *Copy_PU8Text, NUM_FIXED_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8ToAscii
+ * Description: Writes a number in decimal without the trailing zeros of its
+ *              fraction, and without the point for a whole number: "3.5", "-0.125",
+ *              "42".
+ * Parameters:
+ *      - Copy_Number: The number to write
+ *      - Copy_U8Buffer: Destination of at least NUM_FIXED_BUFFER_SIZE bytes
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_FIXED_U8ToAscii(NUM_FIXED_Type Copy_Number, u8 *Copy_U8Buffer);
+
+/************************************************************************************
+ * Function Name: NUM_FIXED_U8Point
+ * Description: Returns the position of the point after the digits NUM_FIXED_U8ToAscii
+ *              writes, as NUM_FIXED_U8AppendDigit would have left it
+ * Parameters:
+ *      - Copy_Number: The number
+ * Return: 0 for a whole number, else 1 plus the digits written after the point
+ ************************************************************************************/
+u8 NUM_FIXED_U8Point(NUM_FIXED_Type Copy_Number);
+
+#endif /* _NUM_FIXED_H_ */
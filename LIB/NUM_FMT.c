@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Module: Number Formatting
+ *
+ * File Name: NUM_FMT.c
+ *
+ * Description: Source file for integer to decimal ASCII conversion. Each digit
+ *              is found by subtracting its power of ten until the remainder is
+ *              smaller, which needs at most 9 subtractions per digit and never
+ *              calls the 32-bit or 64-bit software division routines.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_FMT.h"
+#include "FLASH_MEM.h"
+
+/* Powers of ten kept in flash, index n holds 10^n */
+static FLASH_CONST u32 NUM_FMT_AU32PowersOfTen[10] =
+{
+	1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+static FLASH_CONST u64 NUM_FMT_AU64PowersOfTen[20] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+	1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8CountDigits
+ * Description: Counts the decimal digits of an unsigned 32-bit number by comparing
+ *              it against the powers of ten
+ * Parameters:
+ *      - Copy_U32Number: The number to measure
+ * Return: Number of digits (1 to 10, 0 has one digit)
+ ************************************************************************************/
+u8 NUM_FMT_U8CountDigits(u32 Copy_U32Number)
+{
+	u8 LOC_U8Digits = 1;
+	while (LOC_U8Digits < 10 && Copy_U32Number >= FLASH_READ_U32(&NUM_FMT_AU32PowersOfTen[LOC_U8Digits]))
+	{
+		LOC_U8Digits++;
+	}
+	return LOC_U8Digits;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8CountDigits64
+ * Description: Counts the decimal digits of an unsigned 64-bit number by comparing
+ *              it against the powers of ten
+ * Parameters:
+ *      - Copy_U64Number: The number to measure
+ * Return: Number of digits (1 to 20, 0 has one digit)
+ ************************************************************************************/
+u8 NUM_FMT_U8CountDigits64(u64 Copy_U64Number)
+{
+	u8 LOC_U8Digits = 1;
+	while (LOC_U8Digits < 20 && Copy_U64Number >= FLASH_READ_U64(&NUM_FMT_AU64PowersOfTen[LOC_U8Digits]))
+	{
+		LOC_U8Digits++;
+	}
+	return LOC_U8Digits;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8U32ToAscii
+ * Description: Writes an unsigned 32-bit number as null-terminated decimal ASCII,
+ *              most significant digit first
+ * Parameters:
+ *      - Copy_U32Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_U32_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8U32ToAscii(u32 Copy_U32Number, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Length = NUM_FMT_U8CountDigits(Copy_U32Number);
+	u8 LOC_U8Position, LOC_U8Digit;
+	u32 LOC_U32Power;
+
+	for (LOC_U8Position = 0; LOC_U8Position < LOC_U8Length - 1; LOC_U8Position++)
+	{
+		LOC_U32Power = FLASH_READ_U32(&NUM_FMT_AU32PowersOfTen[LOC_U8Length - 1 - LOC_U8Position]);
+		LOC_U8Digit = '0';
+		while (Copy_U32Number >= LOC_U32Power)
+		{
+			Copy_U32Number -= LOC_U32Power;
+			LOC_U8Digit++;
+		}
+		Copy_U8Buffer[LOC_U8Position] = LOC_U8Digit;
+	}
+
+	/* What remains is the units digit */
+	Copy_U8Buffer[LOC_U8Length - 1] = (u8)Copy_U32Number + '0';
+	Copy_U8Buffer[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8S32ToAscii
+ * Description: Writes a signed 32-bit number as null-terminated decimal ASCII, the
+ *              whole range including -2147483648 is supported
+ * Parameters:
+ *      - Copy_S32Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_S32_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8S32ToAscii(s32 Copy_S32Number, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Length;
+	if (Copy_S32Number < 0)
+	{
+		Copy_U8Buffer[0] = '-';
+		LOC_U8Length = 1 + NUM_FMT_U8U32ToAscii(0UL - (u32)Copy_S32Number, Copy_U8Buffer + 1);
+	}
+	else
+	{
+		LOC_U8Length = NUM_FMT_U8U32ToAscii((u32)Copy_S32Number, Copy_U8Buffer);
+	}
+	return LOC_U8Length;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8U64ToAscii
+ * Description: Writes an unsigned 64-bit number as null-terminated decimal ASCII,
+ *              most significant digit first
+ * Parameters:
+ *      - Copy_U64Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_U64_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8U64ToAscii(u64 Copy_U64Number, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Length = NUM_FMT_U8CountDigits64(Copy_U64Number);
+	u8 LOC_U8Position, LOC_U8Digit;
+	u64 LOC_U64Power;
+
+	for (LOC_U8Position = 0; LOC_U8Position < LOC_U8Length - 1; LOC_U8Position++)
+	{
+		LOC_U64Power = FLASH_READ_U64(&NUM_FMT_AU64PowersOfTen[LOC_U8Length - 1 - LOC_U8Position]);
+		LOC_U8Digit = '0';
+		while (Copy_U64Number >= LOC_U64Power)
+		{
+			Copy_U64Number -= LOC_U64Power;
+			LOC_U8Digit++;
+		}
+		Copy_U8Buffer[LOC_U8Position] = LOC_U8Digit;
+	}
+
+	/* What remains is the units digit */
+	Copy_U8Buffer[LOC_U8Length - 1] = (u8)Copy_U64Number + '0';
+	Copy_U8Buffer[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8S64ToAscii
+ * Description: Writes a signed 64-bit number as null-terminated decimal ASCII, the
+ *              whole range including the most negative value is supported
+ * Parameters:
+ *      - Copy_S64Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_S64_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8S64ToAscii(s64 Copy_S64Number, u8 *Copy_U8Buffer)
+{
+	u8 LOC_U8Length;
+	if (Copy_S64Number < 0)
+	{
+		Copy_U8Buffer[0] = '-';
+		LOC_U8Length = 1 + NUM_FMT_U8U64ToAscii(0ULL - (u64)Copy_S64Number, Copy_U8Buffer + 1);
+	}
+	else
+	{
+		LOC_U8Length = NUM_FMT_U8U64ToAscii((u64)Copy_S64Number, Copy_U8Buffer);
+	}
+	return LOC_U8Length;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * Module: Number Formatting
+ *
+ * File Name: NUM_FMT.h
+ *
+ * Description: Header file for integer to decimal ASCII conversion without
+ *              division, for targets that have no hardware divider.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_FMT_H_
+#define _NUM_FMT_H_
+
+#include "STD_TYPES.h"
+
+/* Buffer sizes needed for the longest value, sign and terminating null included */
+#define NUM_FMT_U32_BUFFER_SIZE 11
+#define NUM_FMT_S32_BUFFER_SIZE 12
+#define NUM_FMT_U64_BUFFER_SIZE 21
+#define NUM_FMT_S64_BUFFER_SIZE 21
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8CountDigits
+ * Description: Counts the decimal digits of an unsigned 32-bit number
+ * Parameters:
+ *      - Copy_U32Number: The number to measure
+ * Return: Number of digits (1 to 10, 0 has one digit)
+ ************************************************************************************/
+u8 NUM_FMT_U8CountDigits(u32 Copy_U32Number);
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8CountDigits64
+ * Description: Counts the decimal digits of an unsigned 64-bit number
+ * Parameters:
+ *      - Copy_U64Number: The number to measure
+ * Return: Number of digits (1 to 20, 0 has one digit)
+ ************************************************************************************/
+u8 NUM_FMT_U8CountDigits64(u64 Copy_U64Number);
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8U32ToAscii
+ * Description: Writes an unsigned 32-bit number as null-terminated decimal ASCII
+ * Parameters:
+ *      - Copy_U32Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_U32_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8U32ToAscii(u32 Copy_U32Number, u8 *Copy_U8Buffer);
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8S32ToAscii
+ * Description: Writes a signed 32-bit number as null-terminated decimal ASCII
+ * Parameters:
+ *      - Copy_S32Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_S32_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8S32ToAscii(s32 Copy_S32Number, u8 *Copy_U8Buffer);
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8U64ToAscii
+ * Description: Writes an unsigned 64-bit number as null-terminated decimal ASCII
+ * Parameters:
+ *      - Copy_U64Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_U64_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8U64ToAscii(u64 Copy_U64Number, u8 *Copy_U8Buffer);
+
+/************************************************************************************
+ * Function Name: NUM_FMT_U8S64ToAscii
+ * Description: Writes a signed 64-bit number as null-terminated decimal ASCII
+ * Parameters:
+ *      - Copy_S64Number: The number to convert
+ *      - Copy_U8Buffer: Destination of at least NUM_FMT_S64_BUFFER_SIZE bytes
+ * Return: Number of characters written, terminating null excluded
+ ************************************************************************************/
+u8 NUM_FMT_U8S64ToAscii(s64 Copy_S64Number, u8 *Copy_U8Buffer);
+
+#endif /* _NUM_FMT_H_ */
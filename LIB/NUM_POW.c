@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * Module: Integer Powers
+ *
+ * File Name: NUM_POW.c
+ *
+ * Description: Source file for the integer powers. The exponent is read
+ *              from its lowest bit: each bit squares the base once, and each
+ *              set bit multiplies it into the result, so 2^30 takes 5
+ *              squarings and 4 products instead of 30 products. The modular
+ *              products double and add and the reductions shift and subtract
+ *              instead of dividing, as the ATmega32 has no divide instruction.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_POW.h"
+#include "NUM_TOWER.h"
+
+/************************************************************************************
+ * Function Name: NUM_POW_U8PowerS32
+ * Description: Base raised to Exponent by squaring, see NUM_POW.h
+ * Parameters:
+ *      - Copy_PS32Result: Receives the power when there is no error
+ *      - Copy_S32Base: The base
+ *      - Copy_S32Exponent: The exponent
+ * Return: NUM_POW_OK, NUM_POW_DIV_ZERO or NUM_POW_OVERFLOW
+ ************************************************************************************/
+u8 NUM_POW_U8PowerS32(s32 *Copy_PS32Result, s32 Copy_S32Base, s32 Copy_S32Exponent)
+{
+	u8 LOC_U8State = NUM_POW_OK;
+	s32 LOC_S32Power = 1, LOC_S32Square = Copy_S32Base;
+	u32 LOC_U32Exponent = (u32)Copy_S32Exponent;
+
+	if (Copy_S32Exponent < 0)
+	{
+		/* 1 / Base^n truncates to 0 unless the base is a unit */
+		if (0 == Copy_S32Base)
+		{
+			LOC_U8State = NUM_POW_DIV_ZERO;
+		}
+		else if (1 == Copy_S32Base || -1 == Copy_S32Base)
+		{
+			LOC_S32Power = (-1 == Copy_S32Base && (LOC_U32Exponent & 1)) ? -1 : 1;
+		}
+		else
+		{
+			LOC_S32Power = 0;
+		}
+		LOC_U32Exponent = 0;
+	}
+
+	while (LOC_U32Exponent && NUM_POW_OK == LOC_U8State)
+	{
+		if (LOC_U32Exponent & 1)
+		{
+			LOC_U8State = NUM_TOWER_U8CheckedS32('*', LOC_S32Power, LOC_S32Square, &LOC_S32Power);
+		}
+		LOC_U32Exponent >>= 1;
+
+		/* The last square would not be used, and could overflow for nothing */
+		if (LOC_U32Exponent && NUM_POW_OK == LOC_U8State)
+		{
+			LOC_U8State = NUM_TOWER_U8CheckedS32('*', LOC_S32Square, LOC_S32Square, &LOC_S32Square);
+		}
+	}
+
+	if (NUM_POW_OK == LOC_U8State)
+	{
+		*Copy_PS32Result = LOC_S32Power;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32Reduce
+ * Description: Value modulo Modulus by shift and subtract, see NUM_POW.h
+ * Parameters:
+ *      - Copy_U32Value: Any value
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: Value modulo Modulus
+ ************************************************************************************/
+u32 NUM_POW_U32Reduce(u32 Copy_U32Value, u32 Copy_U32Modulus)
+{
+	u32 LOC_U32Remainder = 0, LOC_U32Bit = 0x80000000UL;
+
+	/* Long division keeping only the remainder, which stays below the modulus */
+	for (; LOC_U32Bit; LOC_U32Bit >>= 1)
+	{
+		LOC_U32Remainder <<= 1;
+		if (Copy_U32Value & LOC_U32Bit)
+		{
+			LOC_U32Remainder |= 1;
+		}
+		if (LOC_U32Remainder >= Copy_U32Modulus)
+		{
+			LOC_U32Remainder -= Copy_U32Modulus;
+		}
+	}
+	return LOC_U32Remainder;
+}
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32MulMod
+ * Description: Left * Right modulo Modulus by doubling and adding, see NUM_POW.h
+ * Parameters:
+ *      - Copy_U32Left: Left residue, below the modulus
+ *      - Copy_U32Right: Right residue, below the modulus
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: The product modulo Modulus
+ ************************************************************************************/
+u32 NUM_POW_U32MulMod(u32 Copy_U32Left, u32 Copy_U32Right, u32 Copy_U32Modulus)
+{
+	u32 LOC_U32Product = 0, LOC_U32Bit = 0x80000000UL;
+
+	/* Skip the leading zeros of the right operand */
+	while (LOC_U32Bit > Copy_U32Right)
+	{
+		LOC_U32Bit >>= 1;
+	}
+
+	/* Horner's rule in base 2, both sums stay below twice the modulus */
+	for (; LOC_U32Bit; LOC_U32Bit >>= 1)
+	{
+		LOC_U32Product <<= 1;
+		if (LOC_U32Product >= Copy_U32Modulus)
+		{
+			LOC_U32Product -= Copy_U32Modulus;
+		}
+		if (Copy_U32Right & LOC_U32Bit)
+		{
+			LOC_U32Product += Copy_U32Left;
+			if (LOC_U32Product >= Copy_U32Modulus)
+			{
+				LOC_U32Product -= Copy_U32Modulus;
+			}
+		}
+	}
+	return LOC_U32Product;
+}
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32ModPower
+ * Description: Base raised to Exponent modulo Modulus by squaring, see NUM_POW.h
+ * Parameters:
+ *      - Copy_U32Base: The base
+ *      - Copy_U32Exponent: The exponent
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: The power modulo Modulus
+ ************************************************************************************/
+u32 NUM_POW_U32ModPower(u32 Copy_U32Base, u32 Copy_U32Exponent, u32 Copy_U32Modulus)
+{
+	/* Modulo 1 everything is 0, even x^0 */
+	u32 LOC_U32Power = (Copy_U32Modulus > 1) ? 1 : 0;
+	u32 LOC_U32Square = (Copy_U32Base < Copy_U32Modulus) ? Copy_U32Base : NUM_POW_U32Reduce(Copy_U32Base, Copy_U32Modulus);
+
+	while (Copy_U32Exponent)
+	{
+		if (Copy_U32Exponent & 1)
+		{
+			LOC_U32Power = NUM_POW_U32MulMod(LOC_U32Power, LOC_U32Square, Copy_U32Modulus);
+		}
+		Copy_U32Exponent >>= 1;
+		if (Copy_U32Exponent)
+		{
+			LOC_U32Square = NUM_POW_U32MulMod(LOC_U32Square, LOC_U32Square, Copy_U32Modulus);
+		}
+	}
+	return LOC_U32Power;
+}
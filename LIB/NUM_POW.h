@@ -0,0 +1,79 @@
+/******************************************************************************
+ *
+ * Module: Integer Powers
+ *
+ * File Name: NUM_POW.h
+ *
+ * Description: Header file for powers of 32-bit integers by repeated
+ *              squaring, which takes one squaring per bit of the exponent
+ *              and one multiplication per set bit instead of one
+ *              multiplication per unit, and the same powers modulo an
+ *              integer for exponents of any size.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_POW_H_
+#define _NUM_POW_H_
+
+#include "STD_TYPES.h"
+
+/* Status of an operation, the error codes match the error states of the Calculator */
+#define NUM_POW_OK       0
+#define NUM_POW_DIV_ZERO 2
+#define NUM_POW_OVERFLOW 3
+
+/* Largest modulus of NUM_POW_U32ModPower, twice a residue must fit 32 bits */
+#define NUM_POW_MODULUS_MAX 0x7FFFFFFFUL
+
+/************************************************************************************
+ * Function Name: NUM_POW_U8PowerS32
+ * Description: Base raised to Exponent by squaring. The base is only squared while
+ *              bits of the exponent remain, so a result that fits is never reported
+ *              as an overflow. A negative exponent gives 1 / Base^-Exponent truncated
+ *              toward zero like C division: 0 unless the base is 1 or -1.
+ * Parameters:
+ *      - Copy_PS32Result: Receives the power when there is no error
+ *      - Copy_S32Base: The base
+ *      - Copy_S32Exponent: The exponent, 0 gives 1 for any base
+ * Return: NUM_POW_OK, NUM_POW_DIV_ZERO for 0 to a negative exponent, or
+ *         NUM_POW_OVERFLOW when the power does not fit 32 bits
+ ************************************************************************************/
+u8 NUM_POW_U8PowerS32(s32 *Copy_PS32Result, s32 Copy_S32Base, s32 Copy_S32Exponent);
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32Reduce
+ * Description: Value modulo Modulus by shift and subtract, one bit of Value at a
+ *              time, so no division is needed
+ * Parameters:
+ *      - Copy_U32Value: Any value
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: Value modulo Modulus, 0 to Modulus - 1
+ ************************************************************************************/
+u32 NUM_POW_U32Reduce(u32 Copy_U32Value, u32 Copy_U32Modulus);
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32MulMod
+ * Description: Left * Right modulo Modulus by doubling and adding, one bit of Right
+ *              at a time, so neither a 64-bit product nor a division is needed
+ * Parameters:
+ *      - Copy_U32Left: Left residue, below the modulus
+ *      - Copy_U32Right: Right residue, below the modulus
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: The product modulo Modulus
+ ************************************************************************************/
+u32 NUM_POW_U32MulMod(u32 Copy_U32Left, u32 Copy_U32Right, u32 Copy_U32Modulus);
+
+/************************************************************************************
+ * Function Name: NUM_POW_U32ModPower
+ * Description: Base raised to Exponent modulo Modulus by squaring, every product is
+ *              reduced so nothing can overflow whatever the size of the exponent
+ * Parameters:
+ *      - Copy_U32Base: The base, reduced first if not below the modulus
+ *      - Copy_U32Exponent: The exponent
+ *      - Copy_U32Modulus: The modulus, 1 to NUM_POW_MODULUS_MAX
+ * Return: The power modulo Modulus, 0 to Modulus - 1
+ ************************************************************************************/
+u32 NUM_POW_U32ModPower(u32 Copy_U32Base, u32 Copy_U32Exponent, u32 Copy_U32Modulus);
+
+#endif /* _NUM_POW_H_ */
@@ -0,0 +1,485 @@
+/******************************************************************************
+ *
+ * Module: Rational Numbers
+ *
+ * File Name: NUM_RATIONAL.c
+ *
+ * Description: Source file for the exact fractions. Every operation first
+ *              tries the plain cross products, which is all a chain of
+ *              integers or of fractions sharing a denominator ever needs.
+ *              Only an overflow pays for the reduction, which divides by a
+ *              common divisor found without division. The decimal expansion
+ *              is also division-free past the integer part: each digit is
+ *              the number of times the denominator fits ten additions of the
+ *              remainder.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_RATIONAL.h"
+#include "NUM_TOWER.h"
+#include "NUM_FMT.h"
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Checked
+ * Description: One checked 32-bit operation whose result must also be a valid part
+ *              of a fraction, so it may not be the lowest s32
+ * Parameters:
+ *      - Copy_U8Operator: '+' or '*'
+ *      - Copy_S32Left: Left operand
+ *      - Copy_S32Right: Right operand
+ *      - Copy_PS32Result: Receives the result when it fits
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_RATIONAL_U8Checked(u8 Copy_U8Operator, s32 Copy_S32Left, s32 Copy_S32Right, s32 *Copy_PS32Result)
+{
+	s32 LOC_S32Result;
+
+	if (NUM_TOWER_OK != NUM_TOWER_U8CheckedS32(Copy_U8Operator, Copy_S32Left, Copy_S32Right, &LOC_S32Result)
+	    || LOC_S32Result == -2147483647L - 1)
+	{
+		return NUM_RATIONAL_OVERFLOW;
+	}
+	*Copy_PS32Result = LOC_S32Result;
+	return NUM_RATIONAL_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Sum
+ * Description: Left + Right. A shared denominator only adds the numerators, else
+ *              the plain cross products are used, or when reducing the sum is taken
+ *              over the least common denominator and reduced by the common divisor
+ *              it keeps with that denominator (Knuth, TAOCP 4.5.1).
+ * Parameters:
+ *      - Copy_PResult: Receives the sum when it fits
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ *      - Copy_U8Reduce: 0 for the plain cross products, 1 for operands in lowest terms
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_RATIONAL_U8Sum(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft,
+                             const NUM_RATIONAL_Type *Copy_PRight, u8 Copy_U8Reduce)
+{
+	s32 LOC_S32LeftScale = Copy_PRight->Denominator, LOC_S32RightScale = Copy_PLeft->Denominator;
+	s32 LOC_S32Left, LOC_S32Right, LOC_S32Divisor = 1, LOC_S32Common;
+	NUM_RATIONAL_Type LOC_Result;
+
+	if (Copy_PLeft->Denominator == Copy_PRight->Denominator)
+	{
+		LOC_S32LeftScale = 1;
+		LOC_S32RightScale = 1;
+	}
+	else if (Copy_U8Reduce)
+	{
+		LOC_S32Divisor = (s32)NUM_RATIONAL_U32Gcd(Copy_PLeft->Denominator, Copy_PRight->Denominator);
+		if (LOC_S32Divisor > 1)
+		{
+			LOC_S32LeftScale /= LOC_S32Divisor;
+			LOC_S32RightScale /= LOC_S32Divisor;
+		}
+	}
+
+	if (NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('*', Copy_PLeft->Numerator, LOC_S32LeftScale, &LOC_S32Left)
+	    || NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('*', Copy_PRight->Numerator, LOC_S32RightScale, &LOC_S32Right)
+	    || NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('+', LOC_S32Left, LOC_S32Right, &LOC_Result.Numerator))
+	{
+		return NUM_RATIONAL_OVERFLOW;
+	}
+
+	/* Only a factor of the divisor can be common to the sum and the denominator */
+	LOC_Result.Denominator = Copy_PRight->Denominator;
+	if (LOC_S32Divisor > 1)
+	{
+		LOC_S32Common = (s32)NUM_RATIONAL_U32Gcd((LOC_Result.Numerator < 0) ? -LOC_Result.Numerator : LOC_Result.Numerator, LOC_S32Divisor);
+		if (LOC_S32Common > 1)
+		{
+			LOC_Result.Numerator /= LOC_S32Common;
+			LOC_Result.Denominator /= LOC_S32Common;
+		}
+	}
+	if (NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('*', LOC_Result.Denominator, LOC_S32RightScale, &LOC_Result.Denominator))
+	{
+		return NUM_RATIONAL_OVERFLOW;
+	}
+	*Copy_PResult = LOC_Result;
+	return NUM_RATIONAL_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Product
+ * Description: Left * Right with each numerator first divided by its common divisor
+ *              with the other denominator
+ * Parameters:
+ *      - Copy_PResult: Receives the product when it fits
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ *      - Copy_U8Reduce: 0 for the plain products, 1 to cross-reduce first
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_RATIONAL_U8Product(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft,
+                                 const NUM_RATIONAL_Type *Copy_PRight, u8 Copy_U8Reduce)
+{
+	NUM_RATIONAL_Type LOC_Left = *Copy_PLeft, LOC_Right = *Copy_PRight, LOC_Result;
+	s32 LOC_S32Divisor;
+
+	if (Copy_U8Reduce)
+	{
+		LOC_S32Divisor = (s32)NUM_RATIONAL_U32Gcd((LOC_Left.Numerator < 0) ? -LOC_Left.Numerator : LOC_Left.Numerator, LOC_Right.Denominator);
+		if (LOC_S32Divisor > 1)
+		{
+			LOC_Left.Numerator /= LOC_S32Divisor;
+			LOC_Right.Denominator /= LOC_S32Divisor;
+		}
+		LOC_S32Divisor = (s32)NUM_RATIONAL_U32Gcd((LOC_Right.Numerator < 0) ? -LOC_Right.Numerator : LOC_Right.Numerator, LOC_Left.Denominator);
+		if (LOC_S32Divisor > 1)
+		{
+			LOC_Right.Numerator /= LOC_S32Divisor;
+			LOC_Left.Denominator /= LOC_S32Divisor;
+		}
+	}
+
+	if (NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('*', LOC_Left.Numerator, LOC_Right.Numerator, &LOC_Result.Numerator)
+	    || NUM_RATIONAL_OK != NUM_RATIONAL_U8Checked('*', LOC_Left.Denominator, LOC_Right.Denominator, &LOC_Result.Denominator))
+	{
+		return NUM_RATIONAL_OVERFLOW;
+	}
+	*Copy_PResult = LOC_Result;
+	return NUM_RATIONAL_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Digit
+ * Description: Next digit of the decimal expansion of Remainder / Denominator, by ten
+ *              additions of the remainder, each followed by at most one subtraction
+ *              of the denominator. No sum exceeds twice the denominator.
+ * Parameters:
+ *      - Copy_PU32Remainder: Remainder below the denominator, updated
+ *      - Copy_U32Denominator: The denominator, at most 2^31
+ * Return: The digit, 0 to 9
+ ************************************************************************************/
+static u8 NUM_RATIONAL_U8Digit(u32 *Copy_PU32Remainder, u32 Copy_U32Denominator)
+{
+	u32 LOC_U32Sum = 0;
+	u8 LOC_U8Digit = 0;
+	u8 LOC_U8Addition;
+
+	for (LOC_U8Addition = 0; LOC_U8Addition < 10; LOC_U8Addition++)
+	{
+		LOC_U32Sum += *Copy_PU32Remainder;
+		if (LOC_U32Sum >= Copy_U32Denominator)
+		{
+			LOC_U32Sum -= Copy_U32Denominator;
+			LOC_U8Digit++;
+		}
+	}
+	*Copy_PU32Remainder = LOC_U32Sum;
+	return LOC_U8Digit;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U32Gcd
+ * Description: Greatest common divisor by Stein's binary algorithm
+ * Parameters:
+ *      - Copy_U32Left: First number
+ *      - Copy_U32Right: Second number
+ * Return: The greatest common divisor, 0 only when both numbers are 0
+ ************************************************************************************/
+u32 NUM_RATIONAL_U32Gcd(u32 Copy_U32Left, u32 Copy_U32Right)
+{
+	u32 LOC_U32Swap;
+	u8 LOC_U8Shift = 0;
+
+	if (0 == Copy_U32Left || 0 == Copy_U32Right)
+	{
+		return Copy_U32Left | Copy_U32Right;
+	}
+	/* The powers of two both share are put back at the end */
+	while (0 == ((Copy_U32Left | Copy_U32Right) & 1))
+	{
+		Copy_U32Left >>= 1;
+		Copy_U32Right >>= 1;
+		LOC_U8Shift++;
+	}
+	while (0 == (Copy_U32Left & 1))
+	{
+		Copy_U32Left >>= 1;
+	}
+	/* Both odd: their difference is even and keeps the common divisor */
+	do
+	{
+		while (0 == (Copy_U32Right & 1))
+		{
+			Copy_U32Right >>= 1;
+		}
+		if (Copy_U32Left > Copy_U32Right)
+		{
+			LOC_U32Swap = Copy_U32Left;
+			Copy_U32Left = Copy_U32Right;
+			Copy_U32Right = LOC_U32Swap;
+		}
+		Copy_U32Right -= Copy_U32Left;
+	} while (0 != Copy_U32Right);
+
+	return Copy_U32Left << LOC_U8Shift;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDFromS32
+ * Description: Sets a fraction to an integer
+ * Parameters:
+ *      - Copy_PNumber: The fraction to set
+ *      - Copy_S32Integer: The integer, not the lowest s32
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDFromS32(NUM_RATIONAL_Type *Copy_PNumber, s32 Copy_S32Integer)
+{
+	Copy_PNumber->Numerator = Copy_S32Integer;
+	Copy_PNumber->Denominator = 1;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8AppendDigit
+ * Description: Appends a typed digit to an integer that is not negative
+ * Parameters:
+ *      - Copy_PNumber: The integer being typed
+ *      - Copy_U8Digit: The digit, 0 to 9
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8AppendDigit(NUM_RATIONAL_Type *Copy_PNumber, u8 Copy_U8Digit)
+{
+	if (Copy_PNumber->Numerator > 214748364L || (214748364L == Copy_PNumber->Numerator && Copy_U8Digit > 7))
+	{
+		return NUM_RATIONAL_OVERFLOW;
+	}
+	Copy_PNumber->Numerator = Copy_PNumber->Numerator * 10 + Copy_U8Digit;
+	return NUM_RATIONAL_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDDropDigit
+ * Description: Removes the last typed digit of an integer
+ * Parameters:
+ *      - Copy_PNumber: The integer being typed
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDDropDigit(NUM_RATIONAL_Type *Copy_PNumber)
+{
+	Copy_PNumber->Numerator /= 10;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDNegate
+ * Description: Changes the sign of a fraction
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDNegate(NUM_RATIONAL_Type *Copy_PNumber)
+{
+	Copy_PNumber->Numerator = -Copy_PNumber->Numerator;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDNormalize
+ * Description: Brings a fraction to lowest terms. The two divisions are skipped
+ *              when the parts have no common divisor, the usual case.
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDNormalize(NUM_RATIONAL_Type *Copy_PNumber)
+{
+	s32 LOC_S32Divisor = (s32)NUM_RATIONAL_U32Gcd((Copy_PNumber->Numerator < 0) ? -Copy_PNumber->Numerator : Copy_PNumber->Numerator,
+	                                              Copy_PNumber->Denominator);
+
+	if (LOC_S32Divisor > 1)
+	{
+		Copy_PNumber->Numerator /= LOC_S32Divisor;
+		Copy_PNumber->Denominator /= LOC_S32Divisor;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Add
+ * Description: Adds two fractions, over the least common denominator of their lowest
+ *              terms when the plain cross products overflow
+ * Parameters:
+ *      - Copy_PResult: Receives the sum
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8Add(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight)
+{
+	NUM_RATIONAL_Type LOC_Left, LOC_Right;
+	u8 LOC_U8State = NUM_RATIONAL_U8Sum(Copy_PResult, Copy_PLeft, Copy_PRight, 0);
+
+	if (NUM_RATIONAL_OVERFLOW == LOC_U8State)
+	{
+		LOC_Left = *Copy_PLeft;
+		LOC_Right = *Copy_PRight;
+		NUM_RATIONAL_VOIDNormalize(&LOC_Left);
+		NUM_RATIONAL_VOIDNormalize(&LOC_Right);
+		LOC_U8State = NUM_RATIONAL_U8Sum(Copy_PResult, &LOC_Left, &LOC_Right, 1);
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Sub
+ * Description: Subtracts two fractions, as the sum with the negated right operand
+ * Parameters:
+ *      - Copy_PResult: Receives the difference
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8Sub(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight)
+{
+	NUM_RATIONAL_Type LOC_Right = *Copy_PRight;
+
+	NUM_RATIONAL_VOIDNegate(&LOC_Right);
+	return NUM_RATIONAL_U8Add(Copy_PResult, Copy_PLeft, &LOC_Right);
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Mul
+ * Description: Multiplies two fractions, cross-reducing their lowest terms when the
+ *              plain products overflow
+ * Parameters:
+ *      - Copy_PResult: Receives the product
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8Mul(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight)
+{
+	NUM_RATIONAL_Type LOC_Left, LOC_Right;
+	u8 LOC_U8State = NUM_RATIONAL_U8Product(Copy_PResult, Copy_PLeft, Copy_PRight, 0);
+
+	if (NUM_RATIONAL_OVERFLOW == LOC_U8State)
+	{
+		LOC_Left = *Copy_PLeft;
+		LOC_Right = *Copy_PRight;
+		NUM_RATIONAL_VOIDNormalize(&LOC_Left);
+		NUM_RATIONAL_VOIDNormalize(&LOC_Right);
+		LOC_U8State = NUM_RATIONAL_U8Product(Copy_PResult, &LOC_Left, &LOC_Right, 1);
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Div
+ * Description: Divides two fractions, as the product with the reciprocal of the
+ *              right operand
+ * Parameters:
+ *      - Copy_PResult: Receives the quotient
+ *      - Copy_PLeft: Dividend
+ *      - Copy_PRight: Divisor
+ * Return: NUM_RATIONAL_OK, NUM_RATIONAL_DIV_ZERO or NUM_RATIONAL_OVERFLOW
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8Div(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight)
+{
+	NUM_RATIONAL_Type LOC_Reciprocal;
+
+	if (0 == Copy_PRight->Numerator)
+	{
+		return NUM_RATIONAL_DIV_ZERO;
+	}
+	/* The sign moves to the numerator, neither part can be the lowest s32 */
+	if (Copy_PRight->Numerator < 0)
+	{
+		LOC_Reciprocal.Numerator = -Copy_PRight->Denominator;
+		LOC_Reciprocal.Denominator = -Copy_PRight->Numerator;
+	}
+	else
+	{
+		LOC_Reciprocal.Numerator = Copy_PRight->Denominator;
+		LOC_Reciprocal.Denominator = Copy_PRight->Numerator;
+	}
+	return NUM_RATIONAL_U8Mul(Copy_PResult, Copy_PLeft, &LOC_Reciprocal);
+}
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8ToAscii
+ * Description: Writes a fraction in lowest terms as an integer, a fraction or its
+ *              rounded decimal expansion
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ *      - Copy_U8Buffer: Destination of Copy_U8Width + 1 bytes
+ *      - Copy_U8Width: Most characters to write, at least NUM_RATIONAL_MIN_WIDTH
+ *      - Copy_U8Format: NUM_RATIONAL_FRACTION or NUM_RATIONAL_DECIMAL
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8ToAscii(const NUM_RATIONAL_Type *Copy_PNumber, u8 *Copy_U8Buffer, u8 Copy_U8Width, u8 Copy_U8Format)
+{
+	NUM_RATIONAL_Type LOC_Number = *Copy_PNumber;
+	u32 LOC_U32Magnitude, LOC_U32Remainder;
+	u8 LOC_U8Length = 0, LOC_U8Start, LOC_U8Index, LOC_U8Carry;
+
+	NUM_RATIONAL_VOIDNormalize(&LOC_Number);
+	if (LOC_Number.Numerator < 0)
+	{
+		Copy_U8Buffer[LOC_U8Length++] = '-';
+	}
+	LOC_U32Magnitude = (LOC_Number.Numerator < 0) ? 0UL - (u32)LOC_Number.Numerator : (u32)LOC_Number.Numerator;
+
+	if (1 == LOC_Number.Denominator)
+	{
+		return LOC_U8Length + NUM_FMT_U8U32ToAscii(LOC_U32Magnitude, &Copy_U8Buffer[LOC_U8Length]);
+	}
+	if (NUM_RATIONAL_FRACTION == Copy_U8Format
+	    && LOC_U8Length + NUM_FMT_U8CountDigits(LOC_U32Magnitude) + 1 + NUM_FMT_U8CountDigits(LOC_Number.Denominator) <= Copy_U8Width)
+	{
+		LOC_U8Length += NUM_FMT_U8U32ToAscii(LOC_U32Magnitude, &Copy_U8Buffer[LOC_U8Length]);
+		Copy_U8Buffer[LOC_U8Length++] = '/';
+		return LOC_U8Length + NUM_FMT_U8U32ToAscii(LOC_Number.Denominator, &Copy_U8Buffer[LOC_U8Length]);
+	}
+
+	/* Integer part, then the fraction digit by digit while they fit */
+	LOC_U8Start = LOC_U8Length;
+	LOC_U8Length += NUM_FMT_U8U32ToAscii(LOC_U32Magnitude / (u32)LOC_Number.Denominator, &Copy_U8Buffer[LOC_U8Length]);
+	LOC_U32Remainder = LOC_U32Magnitude % (u32)LOC_Number.Denominator;
+	Copy_U8Buffer[LOC_U8Length++] = '.';
+	while (LOC_U8Length < Copy_U8Width && 0 != LOC_U32Remainder)
+	{
+		Copy_U8Buffer[LOC_U8Length++] = '0' + NUM_RATIONAL_U8Digit(&LOC_U32Remainder, LOC_Number.Denominator);
+	}
+
+	/* Round on the first digit that did not fit, carrying through the nines */
+	LOC_U8Carry = (0 != LOC_U32Remainder && NUM_RATIONAL_U8Digit(&LOC_U32Remainder, LOC_Number.Denominator) >= 5);
+	for (LOC_U8Index = LOC_U8Length; LOC_U8Carry && LOC_U8Index > LOC_U8Start; LOC_U8Index--)
+	{
+		if ('9' == Copy_U8Buffer[LOC_U8Index - 1])
+		{
+			Copy_U8Buffer[LOC_U8Index - 1] = '0';
+		}
+		else if ('.' != Copy_U8Buffer[LOC_U8Index - 1])
+		{
+			Copy_U8Buffer[LOC_U8Index - 1]++;
+			LOC_U8Carry = 0;
+		}
+	}
+	/* Every digit was a nine: a leading one goes in and the last digit makes room */
+	if (LOC_U8Carry)
+	{
+		for (LOC_U8Index = LOC_U8Length - 1; LOC_U8Index > LOC_U8Start; LOC_U8Index--)
+		{
+			Copy_U8Buffer[LOC_U8Index] = Copy_U8Buffer[LOC_U8Index - 1];
+		}
+		Copy_U8Buffer[LOC_U8Start] = '1';
+	}
+
+	/* Trailing zeros of the fraction and a bare point are dropped */
+	while ('0' == Copy_U8Buffer[LOC_U8Length - 1])
+	{
+		LOC_U8Length--;
+	}
+	if ('.' == Copy_U8Buffer[LOC_U8Length - 1])
+	{
+		LOC_U8Length--;
+	}
+	Copy_U8Buffer[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
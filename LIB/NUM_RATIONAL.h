@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * Module: Rational Numbers
+ *
+ * File Name: NUM_RATIONAL.h
+ *
+ * Description: Header file for exact fractions of two 32-bit integers, so
+ *              that 1/3*3 gives 1. Operations do not reduce their results,
+ *              a fraction is only brought to lowest terms when an operation
+ *              would overflow without it, or when it is displayed. The
+ *              common divisor is found with Stein's binary GCD, which only
+ *              shifts and subtracts.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_RATIONAL_H_
+#define _NUM_RATIONAL_H_
+
+#include "STD_TYPES.h"
+
+/* Status of an operation, the error codes match the error states of the Calculator */
+#define NUM_RATIONAL_OK       0
+#define NUM_RATIONAL_DIV_ZERO 2
+#define NUM_RATIONAL_OVERFLOW 3
+
+/* Text forms of NUM_RATIONAL_U8ToAscii */
+#define NUM_RATIONAL_FRACTION 0 /* "-7/3", or the decimal form when it does not fit */
+#define NUM_RATIONAL_DECIMAL  1 /* "-2.333333", rounded to the width */
+
+/* Narrowest text NUM_RATIONAL_U8ToAscii can write any number in */
+#define NUM_RATIONAL_MIN_WIDTH 13
+
+/* A fraction, not necessarily in lowest terms. Neither part is the lowest s32. */
+typedef struct
+{
+	s32 Numerator;   /* Carries the sign */
+	s32 Denominator; /* Above zero */
+} NUM_RATIONAL_Type;
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U32Gcd
+ * Description: Greatest common divisor by Stein's algorithm: common factors of two
+ *              are shifted out first, then the smaller odd number is subtracted from
+ *              the larger until they meet, with no division at all
+ * Parameters:
+ *      - Copy_U32Left: First number
+ *      - Copy_U32Right: Second number
+ * Return: The greatest common divisor, 0 only when both numbers are 0
+ ************************************************************************************/
+u32 NUM_RATIONAL_U32Gcd(u32 Copy_U32Left, u32 Copy_U32Right);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDFromS32
+ * Description: Sets a fraction to an integer
+ * Parameters:
+ *      - Copy_PNumber: The fraction to set
+ *      - Copy_S32Integer: The integer, not the lowest s32
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDFromS32(NUM_RATIONAL_Type *Copy_PNumber, s32 Copy_S32Integer);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8AppendDigit / NUM_RATIONAL_VOIDDropDigit
+ * Description: Decimal entry on an integer that is not negative
+ * Parameters:
+ *      - Copy_PNumber: The integer being typed
+ *      - Copy_U8Digit: The digit, 0 to 9 (Append only)
+ * Return: NUM_RATIONAL_OK or NUM_RATIONAL_OVERFLOW (Append only)
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8AppendDigit(NUM_RATIONAL_Type *Copy_PNumber, u8 Copy_U8Digit);
+void NUM_RATIONAL_VOIDDropDigit(NUM_RATIONAL_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDNegate
+ * Description: Changes the sign of a fraction
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDNegate(NUM_RATIONAL_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_VOIDNormalize
+ * Description: Brings a fraction to lowest terms, 0 becomes 0/1
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ * Return: None
+ ************************************************************************************/
+void NUM_RATIONAL_VOIDNormalize(NUM_RATIONAL_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8Add / NUM_RATIONAL_U8Sub / NUM_RATIONAL_U8Mul /
+ *                NUM_RATIONAL_U8Div
+ * Description: Exact arithmetic on fractions. The result is computed from the
+ *              fractions as they are, and only when that overflows again from
+ *              the operands in lowest terms, over the least common denominator
+ *              or cross-reduced. The result may be one of the operands and is
+ *              left unchanged on an error.
+ * Parameters:
+ *      - Copy_PResult: Receives the result
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_RATIONAL_OK, NUM_RATIONAL_DIV_ZERO, or NUM_RATIONAL_OVERFLOW when the
+ *         result in lowest terms, or the numerator of a sum over the least common
+ *         denominator, does not fit 32 bits
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8Add(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight);
+u8 NUM_RATIONAL_U8Sub(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight);
+u8 NUM_RATIONAL_U8Mul(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight);
+u8 NUM_RATIONAL_U8Div(NUM_RATIONAL_Type *Copy_PResult, const NUM_RATIONAL_Type *Copy_PLeft, const NUM_RATIONAL_Type *Copy_PRight);
+
+/************************************************************************************
+ * Function Name: NUM_RATIONAL_U8ToAscii
+ * Description: Writes a fraction in lowest terms. An integer is written alone, other
+ *              fractions as "numerator/denominator" or as their decimal expansion,
+ *              rounded half away from zero to the width and without trailing zeros.
+ * Parameters:
+ *      - Copy_PNumber: The fraction
+ *      - Copy_U8Buffer: Destination of Copy_U8Width + 1 bytes
+ *      - Copy_U8Width: Most characters to write, at least NUM_RATIONAL_MIN_WIDTH
+ *      - Copy_U8Format: NUM_RATIONAL_FRACTION or NUM_RATIONAL_DECIMAL
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_RATIONAL_U8ToAscii(const NUM_RATIONAL_Type *Copy_PNumber, u8 *Copy_U8Buffer, u8 Copy_U8Width, u8 Copy_U8Format);
+
+#endif /* _NUM_RATIONAL_H_ */
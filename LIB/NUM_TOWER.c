@@ -0,0 +1,1002 @@
+/******************************************************************************
+ *
+ * Module: Numeric Tower
+ *
+ * File Name: NUM_TOWER.c
+ *
+ * Description: Source file for the integers of adaptive width. Overflow is
+ *              found from the sign bits of the operands and the result for
+ *              additions, and from the carries of a multiplication split in
+ *              halves, so no operation needs the next width to check the
+ *              current one. Big numbers are kept in base 100, which makes
+ *              decimal entry and display direct and keeps every partial
+ *              product of a multiplication in 16 bits.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "NUM_TOWER.h"
+#include "NUM_FMT.h"
+
+#if NUM_TOWER_BIG_DIGITS < 20 || (NUM_TOWER_BIG_DIGITS & 1)
+#error "NUM_TOWER_BIG_DIGITS must be even and hold any 64-bit value"
+#endif
+
+/* Big numbers below 100^9 = 10^18 always fit an s64 */
+#define NUM_TOWER_S64_LIMBS 9
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDFromS64
+ * Description: Sets a number from a 64-bit value, at the narrowest width
+ * Parameters:
+ *      - Copy_PNumber: The number to set
+ *      - Copy_S64Value: Its value
+ * Return: None
+ ************************************************************************************/
+static void NUM_TOWER_VOIDFromS64(NUM_TOWER_Type *Copy_PNumber, s64 Copy_S64Value)
+{
+	if (Copy_S64Value >= -32768 && Copy_S64Value <= 32767)
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_16;
+		Copy_PNumber->Value.S16 = (s16)Copy_S64Value;
+	}
+	else if (Copy_S64Value >= -2147483647LL - 1 && Copy_S64Value <= 2147483647LL)
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_32;
+		Copy_PNumber->Value.S32 = (s32)Copy_S64Value;
+	}
+	else
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_64;
+		Copy_PNumber->Value.S64 = Copy_S64Value;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_S64Get
+ * Description: Reads a number that is not big as a 64-bit value
+ * Parameters:
+ *      - Copy_PNumber: The number to read
+ * Return: Its value
+ ************************************************************************************/
+static s64 NUM_TOWER_S64Get(const NUM_TOWER_Type *Copy_PNumber)
+{
+	s64 LOC_S64Value;
+
+	switch (Copy_PNumber->Width)
+	{
+	case NUM_TOWER_WIDTH_16: LOC_S64Value = Copy_PNumber->Value.S16; break;
+	case NUM_TOWER_WIDTH_32: LOC_S64Value = Copy_PNumber->Value.S32; break;
+	default:                 LOC_S64Value = Copy_PNumber->Value.S64; break;
+	}
+	return LOC_S64Value;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Split100
+ * Description: Splits a value below 10000 into its hundreds and the rest, with a
+ *              multiplication by the reciprocal instead of a division. 5243 / 2^19
+ *              is 1/100 to within 2.3e-7, exact up to 43698.
+ * Parameters:
+ *      - Copy_U16Value: The value to split
+ *      - Copy_PU8Rest: Receives the value modulo 100
+ * Return: The value divided by 100
+ ************************************************************************************/
+static u8 NUM_TOWER_U8Split100(u16 Copy_U16Value, u8 *Copy_PU8Rest)
+{
+	u8 LOC_U8Hundreds = (u8)(((u32)Copy_U16Value * 5243UL) >> 19);
+
+	*Copy_PU8Rest = (u8)(Copy_U16Value - (u16)LOC_U8Hundreds * 100);
+	return LOC_U8Hundreds;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDToBig
+ * Description: Reads any number as a sign and base 100 magnitude. A 64-bit magnitude
+ *              is split with the subtraction-based formatter of NUM_FMT, which avoids
+ *              the 64-bit division routine.
+ * Parameters:
+ *      - Copy_PNumber: The number to read
+ *      - Copy_PU8Negative: Receives 1 for a negative number
+ *      - Copy_PU8Limbs: Receives NUM_TOWER_BIG_LIMBS limbs
+ * Return: None
+ ************************************************************************************/
+static void NUM_TOWER_VOIDToBig(const NUM_TOWER_Type *Copy_PNumber, u8 *Copy_PU8Negative, u8 *Copy_PU8Limbs)
+{
+	u8 LOC_U8Digits[NUM_FMT_U64_BUFFER_SIZE], LOC_U8Length, LOC_U8Limb;
+	s64 LOC_S64Value;
+	u64 LOC_U64Magnitude;
+
+	if (NUM_TOWER_WIDTH_BIG == Copy_PNumber->Width)
+	{
+		*Copy_PU8Negative = Copy_PNumber->Value.Big.Negative;
+		for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			Copy_PU8Limbs[LOC_U8Limb] = Copy_PNumber->Value.Big.Limbs[LOC_U8Limb];
+		}
+		return;
+	}
+
+	LOC_S64Value = NUM_TOWER_S64Get(Copy_PNumber);
+	*Copy_PU8Negative = (LOC_S64Value < 0);
+	LOC_U64Magnitude = (LOC_S64Value < 0) ? 0ULL - (u64)LOC_S64Value : (u64)LOC_S64Value;
+	LOC_U8Length = NUM_FMT_U8U64ToAscii(LOC_U64Magnitude, LOC_U8Digits);
+
+	/* Pairs of digits from the units up */
+	for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+	{
+		u8 LOC_U8Units = (LOC_U8Length > 2 * LOC_U8Limb) ? LOC_U8Digits[LOC_U8Length - 1 - 2 * LOC_U8Limb] - '0' : 0;
+		u8 LOC_U8Tens = (LOC_U8Length > 2 * LOC_U8Limb + 1) ? LOC_U8Digits[LOC_U8Length - 2 - 2 * LOC_U8Limb] - '0' : 0;
+
+		Copy_PU8Limbs[LOC_U8Limb] = LOC_U8Tens * 10 + LOC_U8Units;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDFromBig
+ * Description: Sets a number from a sign and base 100 magnitude, moving it back to a
+ *              fixed width when it is below 10^18
+ * Parameters:
+ *      - Copy_PNumber: The number to set
+ *      - Copy_U8Negative: 1 for a negative number
+ *      - Copy_PU8Limbs: NUM_TOWER_BIG_LIMBS limbs
+ * Return: None
+ ************************************************************************************/
+static void NUM_TOWER_VOIDFromBig(NUM_TOWER_Type *Copy_PNumber, u8 Copy_U8Negative, const u8 *Copy_PU8Limbs)
+{
+	u8 LOC_U8Limb, LOC_U8Small = 1;
+	u64 LOC_U64Magnitude = 0;
+
+	for (LOC_U8Limb = NUM_TOWER_S64_LIMBS; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+	{
+		if (Copy_PU8Limbs[LOC_U8Limb])
+		{
+			LOC_U8Small = 0;
+		}
+	}
+
+	if (LOC_U8Small)
+	{
+		for (LOC_U8Limb = NUM_TOWER_S64_LIMBS; LOC_U8Limb > 0; LOC_U8Limb--)
+		{
+			LOC_U64Magnitude = LOC_U64Magnitude * 100 + Copy_PU8Limbs[LOC_U8Limb - 1];
+		}
+		NUM_TOWER_VOIDFromS64(Copy_PNumber, Copy_U8Negative ? -(s64)LOC_U64Magnitude : (s64)LOC_U64Magnitude);
+	}
+	else
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_BIG;
+		Copy_PNumber->Value.Big.Negative = Copy_U8Negative;
+		for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			Copy_PNumber->Value.Big.Limbs[LOC_U8Limb] = Copy_PU8Limbs[LOC_U8Limb];
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_S8BigCompare
+ * Description: Compares two base 100 magnitudes
+ * Parameters:
+ *      - Copy_PU8Left: Left magnitude
+ *      - Copy_PU8Right: Right magnitude
+ *      - Copy_U8Limbs: Limbs in each
+ * Return: -1, 0 or 1 as the left magnitude is smaller, equal or larger
+ ************************************************************************************/
+static s8 NUM_TOWER_S8BigCompare(const u8 *Copy_PU8Left, const u8 *Copy_PU8Right, u8 Copy_U8Limbs)
+{
+	while (Copy_U8Limbs--)
+	{
+		if (Copy_PU8Left[Copy_U8Limbs] != Copy_PU8Right[Copy_U8Limbs])
+		{
+			return (Copy_PU8Left[Copy_U8Limbs] > Copy_PU8Right[Copy_U8Limbs]) ? 1 : -1;
+		}
+	}
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDBigSubtract
+ * Description: Subtracts a base 100 magnitude from a larger or equal one, in place
+ * Parameters:
+ *      - Copy_PU8Left: Left magnitude, receives the difference
+ *      - Copy_PU8Right: Right magnitude
+ *      - Copy_U8Limbs: Limbs in each
+ * Return: None
+ ************************************************************************************/
+static void NUM_TOWER_VOIDBigSubtract(u8 *Copy_PU8Left, const u8 *Copy_PU8Right, u8 Copy_U8Limbs)
+{
+	u8 LOC_U8Limb, LOC_U8Borrow = 0;
+
+	for (LOC_U8Limb = 0; LOC_U8Limb < Copy_U8Limbs; LOC_U8Limb++)
+	{
+		s8 LOC_S8Limb = (s8)(Copy_PU8Left[LOC_U8Limb] - Copy_PU8Right[LOC_U8Limb] - LOC_U8Borrow);
+
+		LOC_U8Borrow = (LOC_S8Limb < 0);
+		Copy_PU8Left[LOC_U8Limb] = LOC_U8Borrow ? (u8)(LOC_S8Limb + 100) : (u8)LOC_S8Limb;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8BigMultiplySmall
+ * Description: Multiplies a base 100 magnitude by a value below 100
+ * Parameters:
+ *      - Copy_PU8Result: Receives Copy_U8Limbs + 1 limbs
+ *      - Copy_PU8Magnitude: The magnitude
+ *      - Copy_U8Factor: The factor, 0 to 99
+ *      - Copy_U8Limbs: Limbs in the magnitude
+ * Return: None
+ ************************************************************************************/
+static void NUM_TOWER_VOIDBigMultiplySmall(u8 *Copy_PU8Result, const u8 *Copy_PU8Magnitude, u8 Copy_U8Factor, u8 Copy_U8Limbs)
+{
+	u8 LOC_U8Limb, LOC_U8Carry = 0;
+
+	for (LOC_U8Limb = 0; LOC_U8Limb < Copy_U8Limbs; LOC_U8Limb++)
+	{
+		LOC_U8Carry = NUM_TOWER_U8Split100((u16)Copy_PU8Magnitude[LOC_U8Limb] * Copy_U8Factor + LOC_U8Carry, &Copy_PU8Result[LOC_U8Limb]);
+	}
+	Copy_PU8Result[Copy_U8Limbs] = LOC_U8Carry;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8BigOperate
+ * Description: Applies an operator to two numbers as big numbers
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/', the divisor is not zero
+ *      - Copy_PResult: Receives the result
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_TOWER_OK or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_TOWER_U8BigOperate(u8 Copy_U8Operator, NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	u8 LOC_U8Left[NUM_TOWER_BIG_LIMBS], LOC_U8Right[NUM_TOWER_BIG_LIMBS + 1];
+	u8 LOC_U8Result[2 * NUM_TOWER_BIG_LIMBS];
+	u8 LOC_U8LeftNegative, LOC_U8RightNegative, LOC_U8Negative, LOC_U8Limb, LOC_U8Other;
+	u8 LOC_U8State = NUM_TOWER_OK;
+
+	NUM_TOWER_VOIDToBig(Copy_PLeft, &LOC_U8LeftNegative, LOC_U8Left);
+	NUM_TOWER_VOIDToBig(Copy_PRight, &LOC_U8RightNegative, LOC_U8Right);
+	/* Spare limb read by the division */
+	LOC_U8Right[NUM_TOWER_BIG_LIMBS] = 0;
+	if ('-' == Copy_U8Operator)
+	{
+		LOC_U8RightNegative = !LOC_U8RightNegative;
+	}
+
+	if ('+' == Copy_U8Operator || '-' == Copy_U8Operator)
+	{
+		if (LOC_U8LeftNegative == LOC_U8RightNegative)
+		{
+			u8 LOC_U8Carry = 0;
+
+			for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+			{
+				u8 LOC_U8Sum = LOC_U8Left[LOC_U8Limb] + LOC_U8Right[LOC_U8Limb] + LOC_U8Carry;
+
+				LOC_U8Carry = (LOC_U8Sum >= 100);
+				LOC_U8Result[LOC_U8Limb] = LOC_U8Carry ? LOC_U8Sum - 100 : LOC_U8Sum;
+			}
+			LOC_U8State = LOC_U8Carry ? NUM_TOWER_OVERFLOW : NUM_TOWER_OK;
+			LOC_U8Negative = LOC_U8LeftNegative;
+		}
+		/* Opposite signs: the larger magnitude loses the smaller one and keeps its sign */
+		else if (NUM_TOWER_S8BigCompare(LOC_U8Left, LOC_U8Right, NUM_TOWER_BIG_LIMBS) >= 0)
+		{
+			NUM_TOWER_VOIDBigSubtract(LOC_U8Left, LOC_U8Right, NUM_TOWER_BIG_LIMBS);
+			for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+			{
+				LOC_U8Result[LOC_U8Limb] = LOC_U8Left[LOC_U8Limb];
+			}
+			LOC_U8Negative = LOC_U8LeftNegative;
+		}
+		else
+		{
+			NUM_TOWER_VOIDBigSubtract(LOC_U8Right, LOC_U8Left, NUM_TOWER_BIG_LIMBS);
+			for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+			{
+				LOC_U8Result[LOC_U8Limb] = LOC_U8Right[LOC_U8Limb];
+			}
+			LOC_U8Negative = LOC_U8RightNegative;
+		}
+	}
+	else if ('*' == Copy_U8Operator)
+	{
+		/* Schoolbook product, every partial sum stays below 10000 */
+		for (LOC_U8Limb = 0; LOC_U8Limb < 2 * NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			LOC_U8Result[LOC_U8Limb] = 0;
+		}
+		for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			u8 LOC_U8Carry = 0;
+
+			if (0 == LOC_U8Left[LOC_U8Limb])
+			{
+				continue;
+			}
+			for (LOC_U8Other = 0; LOC_U8Other < NUM_TOWER_BIG_LIMBS; LOC_U8Other++)
+			{
+				u16 LOC_U16Sum = (u16)LOC_U8Left[LOC_U8Limb] * LOC_U8Right[LOC_U8Other]
+				               + LOC_U8Result[LOC_U8Limb + LOC_U8Other] + LOC_U8Carry;
+
+				LOC_U8Carry = NUM_TOWER_U8Split100(LOC_U16Sum, &LOC_U8Result[LOC_U8Limb + LOC_U8Other]);
+			}
+			LOC_U8Result[LOC_U8Limb + NUM_TOWER_BIG_LIMBS] = LOC_U8Carry;
+		}
+		for (LOC_U8Limb = NUM_TOWER_BIG_LIMBS; LOC_U8Limb < 2 * NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			if (LOC_U8Result[LOC_U8Limb])
+			{
+				LOC_U8State = NUM_TOWER_OVERFLOW;
+			}
+		}
+		LOC_U8Negative = LOC_U8LeftNegative ^ LOC_U8RightNegative;
+	}
+	else
+	{
+		/* Long division, one base 100 digit of the quotient at a time found by bisection. The
+		   remainder stays below 100 times the divisor, so both only take its used limbs + 1. */
+		u8 LOC_U8Remainder[NUM_TOWER_BIG_LIMBS + 1] = {0};
+		u8 LOC_U8Product[NUM_TOWER_BIG_LIMBS + 1];
+		u8 LOC_U8RightLimbs = NUM_TOWER_BIG_LIMBS;
+
+		while (0 == LOC_U8Right[LOC_U8RightLimbs - 1])
+		{
+			LOC_U8RightLimbs--;
+		}
+		for (LOC_U8Limb = NUM_TOWER_BIG_LIMBS; LOC_U8Limb > 0; LOC_U8Limb--)
+		{
+			u8 LOC_U8Low = 0, LOC_U8High = 99;
+
+			for (LOC_U8Other = LOC_U8RightLimbs; LOC_U8Other > 0; LOC_U8Other--)
+			{
+				LOC_U8Remainder[LOC_U8Other] = LOC_U8Remainder[LOC_U8Other - 1];
+			}
+			LOC_U8Remainder[0] = LOC_U8Left[LOC_U8Limb - 1];
+
+			/* The quotient digit is 0 while the remainder is below the divisor */
+			if (NUM_TOWER_S8BigCompare(LOC_U8Remainder, LOC_U8Right, LOC_U8RightLimbs + 1) < 0)
+			{
+				LOC_U8High = 0;
+			}
+			while (LOC_U8Low < LOC_U8High)
+			{
+				u8 LOC_U8Middle = (LOC_U8Low + LOC_U8High + 1) / 2;
+
+				NUM_TOWER_VOIDBigMultiplySmall(LOC_U8Product, LOC_U8Right, LOC_U8Middle, LOC_U8RightLimbs);
+				if (NUM_TOWER_S8BigCompare(LOC_U8Product, LOC_U8Remainder, LOC_U8RightLimbs + 1) <= 0)
+				{
+					LOC_U8Low = LOC_U8Middle;
+				}
+				else
+				{
+					LOC_U8High = LOC_U8Middle - 1;
+				}
+			}
+			if (LOC_U8Low)
+			{
+				NUM_TOWER_VOIDBigMultiplySmall(LOC_U8Product, LOC_U8Right, LOC_U8Low, LOC_U8RightLimbs);
+				NUM_TOWER_VOIDBigSubtract(LOC_U8Remainder, LOC_U8Product, LOC_U8RightLimbs + 1);
+			}
+			LOC_U8Result[LOC_U8Limb - 1] = LOC_U8Low;
+		}
+		LOC_U8Negative = LOC_U8LeftNegative ^ LOC_U8RightNegative;
+	}
+
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		NUM_TOWER_VOIDFromBig(Copy_PResult, LOC_U8Negative, LOC_U8Result);
+		if (NUM_TOWER_WIDTH_BIG == Copy_PResult->Width && 0 == NUM_TOWER_S8Sign(Copy_PResult))
+		{
+			Copy_PResult->Value.Big.Negative = 0;
+		}
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8MultiplyU32
+ * Description: Multiplies two 32-bit magnitudes split in 16-bit halves. At most one
+ *              cross product can be non-zero, and it must fit 16 bits once shifted.
+ * Parameters:
+ *      - Copy_U32Left: Left magnitude
+ *      - Copy_U32Right: Right magnitude
+ *      - Copy_PU32Result: Receives the product when it fits
+ * Return: NUM_TOWER_OK or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_TOWER_U8MultiplyU32(u32 Copy_U32Left, u32 Copy_U32Right, u32 *Copy_PU32Result)
+{
+	u16 LOC_U16LeftHigh = (u16)(Copy_U32Left >> 16), LOC_U16LeftLow = (u16)Copy_U32Left;
+	u16 LOC_U16RightHigh = (u16)(Copy_U32Right >> 16), LOC_U16RightLow = (u16)Copy_U32Right;
+	u32 LOC_U32Cross, LOC_U32Low;
+
+	if (LOC_U16LeftHigh && LOC_U16RightHigh)
+	{
+		return NUM_TOWER_OVERFLOW;
+	}
+	LOC_U32Cross = (u32)LOC_U16LeftHigh * LOC_U16RightLow + (u32)LOC_U16RightHigh * LOC_U16LeftLow;
+	if (LOC_U32Cross > 0xFFFFUL)
+	{
+		return NUM_TOWER_OVERFLOW;
+	}
+	LOC_U32Low = (u32)LOC_U16LeftLow * LOC_U16RightLow;
+	*Copy_PU32Result = LOC_U32Low + (LOC_U32Cross << 16);
+
+	/* The carry out of the last addition */
+	return (*Copy_PU32Result < LOC_U32Low) ? NUM_TOWER_OVERFLOW : NUM_TOWER_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8MultiplyU64
+ * Description: Multiplies two 64-bit magnitudes split in 32-bit halves, see
+ *              NUM_TOWER_U8MultiplyU32
+ * Parameters:
+ *      - Copy_U64Left: Left magnitude
+ *      - Copy_U64Right: Right magnitude
+ *      - Copy_PU64Result: Receives the product when it fits
+ * Return: NUM_TOWER_OK or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_TOWER_U8MultiplyU64(u64 Copy_U64Left, u64 Copy_U64Right, u64 *Copy_PU64Result)
+{
+	u32 LOC_U32LeftHigh = (u32)(Copy_U64Left >> 32), LOC_U32LeftLow = (u32)Copy_U64Left;
+	u32 LOC_U32RightHigh = (u32)(Copy_U64Right >> 32), LOC_U32RightLow = (u32)Copy_U64Right;
+	u64 LOC_U64Cross, LOC_U64Low;
+
+	if (LOC_U32LeftHigh && LOC_U32RightHigh)
+	{
+		return NUM_TOWER_OVERFLOW;
+	}
+	LOC_U64Cross = (u64)LOC_U32LeftHigh * LOC_U32RightLow + (u64)LOC_U32RightHigh * LOC_U32LeftLow;
+	if (LOC_U64Cross > 0xFFFFFFFFULL)
+	{
+		return NUM_TOWER_OVERFLOW;
+	}
+	LOC_U64Low = (u64)LOC_U32LeftLow * LOC_U32RightLow;
+	*Copy_PU64Result = LOC_U64Low + (LOC_U64Cross << 32);
+	return (*Copy_PU64Result < LOC_U64Low) ? NUM_TOWER_OVERFLOW : NUM_TOWER_OK;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8CheckedS32
+ * Description: One operation on plain 32-bit values with overflow checks
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/'
+ *      - Copy_S32Left: Left operand
+ *      - Copy_S32Right: Right operand
+ *      - Copy_PS32Result: Receives the result when there is no error
+ * Return: NUM_TOWER_OK, NUM_TOWER_DIV_ZERO or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+u8 NUM_TOWER_U8CheckedS32(u8 Copy_U8Operator, s32 Copy_S32Left, s32 Copy_S32Right, s32 *Copy_PS32Result)
+{
+	u8 LOC_U8State = NUM_TOWER_OK;
+	u32 LOC_U32Magnitude;
+	s32 LOC_S32Result;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+	case '-':
+		LOC_S32Result = ('+' == Copy_U8Operator) ? (s32)((u32)Copy_S32Left + (u32)Copy_S32Right)
+		                                         : (s32)((u32)Copy_S32Left - (u32)Copy_S32Right);
+		if ('-' == Copy_U8Operator)
+		{
+			Copy_S32Right = ~Copy_S32Right;
+		}
+		/* Same operand signs and a different result sign, the V flag of the AVR */
+		if (((Copy_S32Left ^ LOC_S32Result) & (Copy_S32Right ^ LOC_S32Result)) < 0)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		break;
+	case '*':
+		LOC_U8State = NUM_TOWER_U8MultiplyU32((Copy_S32Left < 0) ? 0UL - (u32)Copy_S32Left : (u32)Copy_S32Left,
+		                                      (Copy_S32Right < 0) ? 0UL - (u32)Copy_S32Right : (u32)Copy_S32Right, &LOC_U32Magnitude);
+		if ((Copy_S32Left < 0) != (Copy_S32Right < 0))
+		{
+			LOC_S32Result = (s32)(0UL - LOC_U32Magnitude);
+			if (LOC_U32Magnitude > 0x80000000UL)
+			{
+				LOC_U8State = NUM_TOWER_OVERFLOW;
+			}
+		}
+		else
+		{
+			LOC_S32Result = (s32)LOC_U32Magnitude;
+			if (LOC_U32Magnitude > 0x7FFFFFFFUL)
+			{
+				LOC_U8State = NUM_TOWER_OVERFLOW;
+			}
+		}
+		break;
+	default:
+		if (0 == Copy_S32Right)
+		{
+			LOC_U8State = NUM_TOWER_DIV_ZERO;
+		}
+		else if (-1 == Copy_S32Right && Copy_S32Left == -2147483647L - 1)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		else
+		{
+			LOC_S32Result = Copy_S32Left / Copy_S32Right;
+		}
+		break;
+	}
+
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		*Copy_PS32Result = LOC_S32Result;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Operate16
+ * Description: Applies an operator to two 16-bit values. Products and sums are made
+ *              at 16 bits where the AVR has them in a few instructions, and only
+ *              stored at 32 bits when they do not fit.
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/', the divisor is not zero
+ *      - Copy_PResult: Receives the result
+ *      - Copy_S16Left: Left operand
+ *      - Copy_S16Right: Right operand
+ * Return: NUM_TOWER_OK, or NUM_TOWER_OVERFLOW to run the operation at 32 bits
+ ************************************************************************************/
+static u8 NUM_TOWER_U8Operate16(u8 Copy_U8Operator, NUM_TOWER_Type *Copy_PResult, s16 Copy_S16Left, s16 Copy_S16Right)
+{
+	u8 LOC_U8State = NUM_TOWER_OK;
+	s16 LOC_S16Result;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+	case '-':
+		LOC_S16Result = ('+' == Copy_U8Operator) ? (s16)((u16)Copy_S16Left + (u16)Copy_S16Right)
+		                                         : (s16)((u16)Copy_S16Left - (u16)Copy_S16Right);
+		if ('-' == Copy_U8Operator)
+		{
+			Copy_S16Right = ~Copy_S16Right;
+		}
+		if ((s16)((Copy_S16Left ^ LOC_S16Result) & (Copy_S16Right ^ LOC_S16Result)) < 0)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		else
+		{
+			Copy_PResult->Width = NUM_TOWER_WIDTH_16;
+			Copy_PResult->Value.S16 = LOC_S16Result;
+		}
+		break;
+	case '*':
+		/* A 16 x 16 bit product always fits 32 bits */
+		NUM_TOWER_VOIDFromS32(Copy_PResult, (s32)Copy_S16Left * Copy_S16Right);
+		break;
+	default:
+		if (-1 == Copy_S16Right && -32768 == Copy_S16Left)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		else
+		{
+			Copy_PResult->Width = NUM_TOWER_WIDTH_16;
+			Copy_PResult->Value.S16 = Copy_S16Left / Copy_S16Right;
+		}
+		break;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Operate64
+ * Description: Applies an operator to two 64-bit values, see NUM_TOWER_U8CheckedS32
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/', the divisor is not zero
+ *      - Copy_PResult: Receives the result
+ *      - Copy_S64Left: Left operand
+ *      - Copy_S64Right: Right operand
+ * Return: NUM_TOWER_OK, or NUM_TOWER_OVERFLOW to run the operation on big numbers
+ ************************************************************************************/
+static u8 NUM_TOWER_U8Operate64(u8 Copy_U8Operator, NUM_TOWER_Type *Copy_PResult, s64 Copy_S64Left, s64 Copy_S64Right)
+{
+	u8 LOC_U8State = NUM_TOWER_OK;
+	u64 LOC_U64Magnitude;
+	s64 LOC_S64Result = 0;
+
+	switch (Copy_U8Operator)
+	{
+	case '+':
+	case '-':
+		LOC_S64Result = ('+' == Copy_U8Operator) ? (s64)((u64)Copy_S64Left + (u64)Copy_S64Right)
+		                                         : (s64)((u64)Copy_S64Left - (u64)Copy_S64Right);
+		if ('-' == Copy_U8Operator)
+		{
+			Copy_S64Right = ~Copy_S64Right;
+		}
+		if (((Copy_S64Left ^ LOC_S64Result) & (Copy_S64Right ^ LOC_S64Result)) < 0)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		break;
+	case '*':
+		LOC_U8State = NUM_TOWER_U8MultiplyU64((Copy_S64Left < 0) ? 0ULL - (u64)Copy_S64Left : (u64)Copy_S64Left,
+		                                      (Copy_S64Right < 0) ? 0ULL - (u64)Copy_S64Right : (u64)Copy_S64Right, &LOC_U64Magnitude);
+		if (NUM_TOWER_OK == LOC_U8State)
+		{
+			if ((Copy_S64Left < 0) != (Copy_S64Right < 0))
+			{
+				LOC_S64Result = (s64)(0ULL - LOC_U64Magnitude);
+				LOC_U8State = (LOC_U64Magnitude > 0x8000000000000000ULL) ? NUM_TOWER_OVERFLOW : NUM_TOWER_OK;
+			}
+			else
+			{
+				LOC_S64Result = (s64)LOC_U64Magnitude;
+				LOC_U8State = (LOC_U64Magnitude > 0x7FFFFFFFFFFFFFFFULL) ? NUM_TOWER_OVERFLOW : NUM_TOWER_OK;
+			}
+		}
+		break;
+	default:
+		if (-1 == Copy_S64Right && Copy_S64Left == -9223372036854775807LL - 1)
+		{
+			LOC_U8State = NUM_TOWER_OVERFLOW;
+		}
+		else
+		{
+			LOC_S64Result = Copy_S64Left / Copy_S64Right;
+		}
+		break;
+	}
+
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		NUM_TOWER_VOIDFromS64(Copy_PResult, LOC_S64Result);
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Operate
+ * Description: Runs an operator at the width of the widest operand and moves up one
+ *              width at a time while the result overflows
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/'
+ *      - Copy_PResult: Receives the result
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_TOWER_OK, NUM_TOWER_DIV_ZERO or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+static u8 NUM_TOWER_U8Operate(u8 Copy_U8Operator, NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	u8 LOC_U8Width = (Copy_PLeft->Width > Copy_PRight->Width) ? Copy_PLeft->Width : Copy_PRight->Width;
+	u8 LOC_U8State = NUM_TOWER_OVERFLOW;
+	NUM_TOWER_Type LOC_Result;
+	s32 LOC_S32Result;
+
+	if ('/' == Copy_U8Operator && 0 == NUM_TOWER_S8Sign(Copy_PRight))
+	{
+		return NUM_TOWER_DIV_ZERO;
+	}
+
+	if (NUM_TOWER_WIDTH_16 == LOC_U8Width)
+	{
+		LOC_U8State = NUM_TOWER_U8Operate16(Copy_U8Operator, &LOC_Result, Copy_PLeft->Value.S16, Copy_PRight->Value.S16);
+		LOC_U8Width = NUM_TOWER_WIDTH_32;
+	}
+	if (NUM_TOWER_OVERFLOW == LOC_U8State && NUM_TOWER_WIDTH_32 == LOC_U8Width)
+	{
+		LOC_U8State = NUM_TOWER_U8CheckedS32(Copy_U8Operator, (s32)NUM_TOWER_S64Get(Copy_PLeft), (s32)NUM_TOWER_S64Get(Copy_PRight), &LOC_S32Result);
+		if (NUM_TOWER_OK == LOC_U8State)
+		{
+			NUM_TOWER_VOIDFromS32(&LOC_Result, LOC_S32Result);
+		}
+		LOC_U8Width = NUM_TOWER_WIDTH_64;
+	}
+	if (NUM_TOWER_OVERFLOW == LOC_U8State && NUM_TOWER_WIDTH_64 == LOC_U8Width)
+	{
+		LOC_U8State = NUM_TOWER_U8Operate64(Copy_U8Operator, &LOC_Result, NUM_TOWER_S64Get(Copy_PLeft), NUM_TOWER_S64Get(Copy_PRight));
+	}
+	if (NUM_TOWER_OVERFLOW == LOC_U8State)
+	{
+		LOC_U8State = NUM_TOWER_U8BigOperate(Copy_U8Operator, &LOC_Result, Copy_PLeft, Copy_PRight);
+	}
+
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		*Copy_PResult = LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDFromS32
+ * Description: Sets a number from a 32-bit value, at the narrowest width
+ * Parameters:
+ *      - Copy_PNumber: The number to set
+ *      - Copy_S32Value: Its value
+ * Return: None
+ ************************************************************************************/
+void NUM_TOWER_VOIDFromS32(NUM_TOWER_Type *Copy_PNumber, s32 Copy_S32Value)
+{
+	if (Copy_S32Value >= -32768L && Copy_S32Value <= 32767L)
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_16;
+		Copy_PNumber->Value.S16 = (s16)Copy_S32Value;
+	}
+	else
+	{
+		Copy_PNumber->Width = NUM_TOWER_WIDTH_32;
+		Copy_PNumber->Value.S32 = Copy_S32Value;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8ToS32
+ * Description: Reads a number back as a 32-bit value
+ * Parameters:
+ *      - Copy_PNumber: The number to read
+ *      - Copy_PS32Value: Receives the value when it fits
+ * Return: NUM_TOWER_OK or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+u8 NUM_TOWER_U8ToS32(const NUM_TOWER_Type *Copy_PNumber, s32 *Copy_PS32Value)
+{
+	u8 LOC_U8State = NUM_TOWER_OVERFLOW;
+
+	if (Copy_PNumber->Width <= NUM_TOWER_WIDTH_32)
+	{
+		*Copy_PS32Value = (s32)NUM_TOWER_S64Get(Copy_PNumber);
+		LOC_U8State = NUM_TOWER_OK;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_S8Sign
+ * Description: Returns the sign of a number
+ * Parameters:
+ *      - Copy_PNumber: The number
+ * Return: -1, 0 or 1
+ ************************************************************************************/
+s8 NUM_TOWER_S8Sign(const NUM_TOWER_Type *Copy_PNumber)
+{
+	s8 LOC_S8Sign = 0;
+	u8 LOC_U8Limb;
+
+	if (NUM_TOWER_WIDTH_BIG == Copy_PNumber->Width)
+	{
+		for (LOC_U8Limb = 0; LOC_U8Limb < NUM_TOWER_BIG_LIMBS; LOC_U8Limb++)
+		{
+			if (Copy_PNumber->Value.Big.Limbs[LOC_U8Limb])
+			{
+				LOC_S8Sign = Copy_PNumber->Value.Big.Negative ? -1 : 1;
+			}
+		}
+	}
+	else
+	{
+		s64 LOC_S64Value = NUM_TOWER_S64Get(Copy_PNumber);
+
+		LOC_S8Sign = (LOC_S64Value > 0) - (LOC_S64Value < 0);
+	}
+	return LOC_S8Sign;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDNegate
+ * Description: Changes the sign of a number
+ * Parameters:
+ *      - Copy_PNumber: The number to negate
+ * Return: None
+ ************************************************************************************/
+void NUM_TOWER_VOIDNegate(NUM_TOWER_Type *Copy_PNumber)
+{
+	u8 LOC_U8Negative, LOC_U8Limbs[NUM_TOWER_BIG_LIMBS];
+
+	switch (Copy_PNumber->Width)
+	{
+	case NUM_TOWER_WIDTH_16:
+		NUM_TOWER_VOIDFromS32(Copy_PNumber, -(s32)Copy_PNumber->Value.S16);
+		break;
+	case NUM_TOWER_WIDTH_32:
+		NUM_TOWER_VOIDFromS64(Copy_PNumber, -(s64)Copy_PNumber->Value.S32);
+		break;
+	default:
+		/* The lowest s64 has no positive counterpart at 64 bits */
+		NUM_TOWER_VOIDToBig(Copy_PNumber, &LOC_U8Negative, LOC_U8Limbs);
+		NUM_TOWER_VOIDFromBig(Copy_PNumber, !LOC_U8Negative && NUM_TOWER_S8Sign(Copy_PNumber), LOC_U8Limbs);
+		break;
+	}
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8AppendDigit
+ * Description: Appends a decimal digit on the right of a number that is not negative
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ *      - Copy_U8Digit: The digit, 0 to 9
+ * Return: NUM_TOWER_OK or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+u8 NUM_TOWER_U8AppendDigit(NUM_TOWER_Type *Copy_PNumber, u8 Copy_U8Digit)
+{
+	NUM_TOWER_Type LOC_Ten, LOC_Digit, LOC_Result;
+	u8 LOC_U8State;
+
+	NUM_TOWER_VOIDFromS32(&LOC_Ten, 10);
+	NUM_TOWER_VOIDFromS32(&LOC_Digit, Copy_U8Digit);
+	LOC_U8State = NUM_TOWER_U8Operate('*', &LOC_Result, Copy_PNumber, &LOC_Ten);
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		LOC_U8State = NUM_TOWER_U8Operate('+', &LOC_Result, &LOC_Result, &LOC_Digit);
+	}
+	if (NUM_TOWER_OK == LOC_U8State)
+	{
+		*Copy_PNumber = LOC_Result;
+	}
+	return LOC_U8State;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDDropDigit
+ * Description: Removes the last decimal digit of a number that is not negative
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ * Return: None
+ ************************************************************************************/
+void NUM_TOWER_VOIDDropDigit(NUM_TOWER_Type *Copy_PNumber)
+{
+	NUM_TOWER_Type LOC_Ten;
+
+	NUM_TOWER_VOIDFromS32(&LOC_Ten, 10);
+	NUM_TOWER_U8Operate('/', Copy_PNumber, Copy_PNumber, &LOC_Ten);
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Add / NUM_TOWER_U8Sub / NUM_TOWER_U8Mul / NUM_TOWER_U8Div
+ * Description: Arithmetic at the width of the widest operand, see NUM_TOWER_U8Operate
+ * Parameters:
+ *      - Copy_PResult: Receives the result
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_TOWER_OK, NUM_TOWER_DIV_ZERO or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+u8 NUM_TOWER_U8Add(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	return NUM_TOWER_U8Operate('+', Copy_PResult, Copy_PLeft, Copy_PRight);
+}
+
+u8 NUM_TOWER_U8Sub(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	return NUM_TOWER_U8Operate('-', Copy_PResult, Copy_PLeft, Copy_PRight);
+}
+
+u8 NUM_TOWER_U8Mul(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	return NUM_TOWER_U8Operate('*', Copy_PResult, Copy_PLeft, Copy_PRight);
+}
+
+u8 NUM_TOWER_U8Div(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight)
+{
+	return NUM_TOWER_U8Operate('/', Copy_PResult, Copy_PLeft, Copy_PRight);
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Digits
+ * Description: Writes the digits of the magnitude of a number, most significant first
+ * Parameters:
+ *      - Copy_PNumber: The number
+ *      - Copy_U8Digits: Receives the ASCII digits, NUM_TOWER_BIG_DIGITS + 1 bytes
+ *      - Copy_PU8Negative: Receives 1 for a negative number
+ * Return: Number of digits
+ ************************************************************************************/
+static u8 NUM_TOWER_U8Digits(const NUM_TOWER_Type *Copy_PNumber, u8 *Copy_U8Digits, u8 *Copy_PU8Negative)
+{
+	u8 LOC_U8Limbs[NUM_TOWER_BIG_LIMBS], LOC_U8Limb, LOC_U8Length = 0;
+
+	if (NUM_TOWER_WIDTH_BIG != Copy_PNumber->Width)
+	{
+		s64 LOC_S64Value = NUM_TOWER_S64Get(Copy_PNumber);
+
+		*Copy_PU8Negative = (LOC_S64Value < 0);
+		return NUM_FMT_U8U64ToAscii((LOC_S64Value < 0) ? 0ULL - (u64)LOC_S64Value : (u64)LOC_S64Value, Copy_U8Digits);
+	}
+
+	NUM_TOWER_VOIDToBig(Copy_PNumber, Copy_PU8Negative, LOC_U8Limbs);
+	for (LOC_U8Limb = NUM_TOWER_BIG_LIMBS; LOC_U8Limb > 0; LOC_U8Limb--)
+	{
+		u8 LOC_U8Units, LOC_U8Tens = NUM_TOWER_U8Split100((u16)LOC_U8Limbs[LOC_U8Limb - 1] * 10, &LOC_U8Units);
+
+		/* Leading zeros are skipped, the limbs hold at least one non-zero digit */
+		if (LOC_U8Length || LOC_U8Tens)
+		{
+			Copy_U8Digits[LOC_U8Length++] = '0' + LOC_U8Tens;
+		}
+		if (LOC_U8Length || LOC_U8Units)
+		{
+			Copy_U8Digits[LOC_U8Length++] = '0' + LOC_U8Units / 10;
+		}
+	}
+	Copy_U8Digits[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8CountDigits
+ * Description: Counts the decimal digits of the magnitude of a number
+ * Parameters:
+ *      - Copy_PNumber: The number to measure
+ * Return: Number of digits (0 has one digit)
+ ************************************************************************************/
+u8 NUM_TOWER_U8CountDigits(const NUM_TOWER_Type *Copy_PNumber)
+{
+	u8 LOC_U8Digits[NUM_TOWER_BIG_DIGITS + 1], LOC_U8Negative;
+
+	return NUM_TOWER_U8Digits(Copy_PNumber, LOC_U8Digits, &LOC_U8Negative);
+}
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8ToAscii
+ * Description: Writes a number in decimal, or in scientific notation when it does not
+ *              fit the given width
+ * Parameters:
+ *      - Copy_PNumber: The number to write
+ *      - Copy_U8Buffer: Receives the null-terminated text, Copy_U8Width + 1 bytes
+ *      - Copy_U8Width: Characters available, at least 8
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_TOWER_U8ToAscii(const NUM_TOWER_Type *Copy_PNumber, u8 *Copy_U8Buffer, u8 Copy_U8Width)
+{
+	u8 LOC_U8Digits[NUM_TOWER_BIG_DIGITS + 2], LOC_U8Negative, LOC_U8Length, LOC_U8Fraction, LOC_U8Exponent;
+	u8 LOC_U8Position = 0, LOC_U8Iterator;
+
+	LOC_U8Length = NUM_TOWER_U8Digits(Copy_PNumber, LOC_U8Digits + 1, &LOC_U8Negative);
+	if (LOC_U8Negative)
+	{
+		Copy_U8Buffer[LOC_U8Position++] = '-';
+	}
+
+	if (LOC_U8Position + LOC_U8Length <= Copy_U8Width)
+	{
+		for (LOC_U8Iterator = 1; LOC_U8Iterator <= LOC_U8Length; LOC_U8Iterator++)
+		{
+			Copy_U8Buffer[LOC_U8Position++] = LOC_U8Digits[LOC_U8Iterator];
+		}
+		Copy_U8Buffer[LOC_U8Position] = '\0';
+		return LOC_U8Position;
+	}
+
+	/* d.ddde<exponent>: the lead digit, the point and the exponent, the rest is the fraction */
+	LOC_U8Exponent = LOC_U8Length - 1;
+	LOC_U8Fraction = Copy_U8Width - LOC_U8Position - 3 - ((LOC_U8Exponent >= 10) ? 2 : 1);
+
+	/* Round half up on the first digit left out, a carry out of the lead digit goes in front */
+	LOC_U8Digits[0] = '0';
+	if (LOC_U8Digits[2 + LOC_U8Fraction] >= '5')
+	{
+		for (LOC_U8Iterator = 1 + LOC_U8Fraction; '9' == LOC_U8Digits[LOC_U8Iterator]; LOC_U8Iterator--)
+		{
+			LOC_U8Digits[LOC_U8Iterator] = '0';
+		}
+		LOC_U8Digits[LOC_U8Iterator]++;
+	}
+	LOC_U8Iterator = ('0' == LOC_U8Digits[0]) ? 1 : 0;
+	LOC_U8Exponent += 1 - LOC_U8Iterator;
+
+	while (LOC_U8Fraction > 0 && '0' == LOC_U8Digits[LOC_U8Iterator + LOC_U8Fraction])
+	{
+		LOC_U8Fraction--;
+	}
+
+	Copy_U8Buffer[LOC_U8Position++] = LOC_U8Digits[LOC_U8Iterator];
+	if (LOC_U8Fraction)
+	{
+		Copy_U8Buffer[LOC_U8Position++] = '.';
+		for (LOC_U8Length = 1; LOC_U8Length <= LOC_U8Fraction; LOC_U8Length++)
+		{
+			Copy_U8Buffer[LOC_U8Position++] = LOC_U8Digits[LOC_U8Iterator + LOC_U8Length];
+		}
+	}
+	Copy_U8Buffer[LOC_U8Position++] = 'e';
+	LOC_U8Position += NUM_FMT_U8U32ToAscii(LOC_U8Exponent, Copy_U8Buffer + LOC_U8Position);
+	return LOC_U8Position;
+}
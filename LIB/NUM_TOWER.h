@@ -0,0 +1,173 @@
+/******************************************************************************
+ *
+ * Module: Numeric Tower
+ *
+ * File Name: NUM_TOWER.h
+ *
+ * Description: Header file for integers that adapt their width to their value.
+ *              A number is kept in the narrowest of s16, s32, s64 and a
+ *              fixed-capacity decimal big number that holds it. Operations
+ *              run at the width of their widest operand, check the result for
+ *              overflow and only move up a width when it does not fit, so the
+ *              small operands of most expressions stay on the cheap 16-bit
+ *              path of the AVR.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _NUM_TOWER_H_
+#define _NUM_TOWER_H_
+
+#include "STD_TYPES.h"
+
+/* Widths, in the order a number is promoted */
+#define NUM_TOWER_WIDTH_16  0
+#define NUM_TOWER_WIDTH_32  1
+#define NUM_TOWER_WIDTH_64  2
+#define NUM_TOWER_WIDTH_BIG 3
+#define NUM_TOWER_WIDTHS    4
+
+/************************************************************************************
+ * Description: Decimal digits of the big number, a multiple of 2. Each pair of digits
+ *              takes one byte in every number, whatever its width, and a result with
+ *              more digits is an overflow.
+ * Default: 24
+ ************************************************************************************/
+#ifndef NUM_TOWER_BIG_DIGITS
+#define NUM_TOWER_BIG_DIGITS 24
+#endif
+
+#define NUM_TOWER_BIG_LIMBS (NUM_TOWER_BIG_DIGITS / 2)
+
+/* Status of an operation, the error codes match the error states of the Calculator */
+#define NUM_TOWER_OK       0
+#define NUM_TOWER_DIV_ZERO 2
+#define NUM_TOWER_OVERFLOW 3
+
+/************************************************************************************
+ * Description: An integer of adaptive width. Width tells which member of Value holds
+ *              it, and is always the narrowest one that can, except that big numbers
+ *              only move back to s64 below 10^18. The big number is a sign and a
+ *              magnitude in base 100, least significant pair of digits first.
+ ************************************************************************************/
+typedef struct
+{
+	u8 Width;
+	union
+	{
+		s16 S16;
+		s32 S32;
+		s64 S64;
+		struct
+		{
+			u8 Negative;
+			u8 Limbs[NUM_TOWER_BIG_LIMBS];
+		} Big;
+	} Value;
+} NUM_TOWER_Type;
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDFromS32
+ * Description: Sets a number from a 32-bit value, at the narrowest width
+ * Parameters:
+ *      - Copy_PNumber: The number to set
+ *      - Copy_S32Value: Its value
+ * Return: None
+ ************************************************************************************/
+void NUM_TOWER_VOIDFromS32(NUM_TOWER_Type *Copy_PNumber, s32 Copy_S32Value);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8ToS32
+ * Description: Reads a number back as a 32-bit value
+ * Parameters:
+ *      - Copy_PNumber: The number to read
+ *      - Copy_PS32Value: Receives the value when it fits
+ * Return: NUM_TOWER_OK, or NUM_TOWER_OVERFLOW when the number needs more than 32 bits
+ ************************************************************************************/
+u8 NUM_TOWER_U8ToS32(const NUM_TOWER_Type *Copy_PNumber, s32 *Copy_PS32Value);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_S8Sign
+ * Description: Returns the sign of a number
+ * Parameters:
+ *      - Copy_PNumber: The number
+ * Return: -1, 0 or 1
+ ************************************************************************************/
+s8 NUM_TOWER_S8Sign(const NUM_TOWER_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_VOIDNegate
+ * Description: Changes the sign of a number, the lowest value of a width moves up a
+ *              width so negating never overflows
+ * Parameters:
+ *      - Copy_PNumber: The number to negate
+ * Return: None
+ ************************************************************************************/
+void NUM_TOWER_VOIDNegate(NUM_TOWER_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8AppendDigit / NUM_TOWER_VOIDDropDigit
+ * Description: Decimal entry on a number that is not negative: append a digit on the
+ *              right (n * 10 + digit), or remove the last one (n / 10).
+ * Parameters:
+ *      - Copy_PNumber: The number being typed
+ *      - Copy_U8Digit: The digit, 0 to 9 (Append only)
+ * Return: NUM_TOWER_OK, or NUM_TOWER_OVERFLOW when the big number is full (Append only)
+ ************************************************************************************/
+u8 NUM_TOWER_U8AppendDigit(NUM_TOWER_Type *Copy_PNumber, u8 Copy_U8Digit);
+void NUM_TOWER_VOIDDropDigit(NUM_TOWER_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8Add / NUM_TOWER_U8Sub / NUM_TOWER_U8Mul / NUM_TOWER_U8Div
+ * Description: Arithmetic at the width of the widest operand, moving up a width on
+ *              overflow. Division truncates toward zero like C. The result may be
+ *              one of the operands and is left unchanged on an error.
+ * Parameters:
+ *      - Copy_PResult: Receives the result
+ *      - Copy_PLeft: Left operand
+ *      - Copy_PRight: Right operand
+ * Return: NUM_TOWER_OK, NUM_TOWER_DIV_ZERO, or NUM_TOWER_OVERFLOW when the result has
+ *         more than NUM_TOWER_BIG_DIGITS digits
+ ************************************************************************************/
+u8 NUM_TOWER_U8Add(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight);
+u8 NUM_TOWER_U8Sub(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight);
+u8 NUM_TOWER_U8Mul(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight);
+u8 NUM_TOWER_U8Div(NUM_TOWER_Type *Copy_PResult, const NUM_TOWER_Type *Copy_PLeft, const NUM_TOWER_Type *Copy_PRight);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8CheckedS32
+ * Description: One operation on plain 32-bit values with the overflow checks of the
+ *              tower, for code that cannot afford the adaptive type
+ * Parameters:
+ *      - Copy_U8Operator: '+', '-', '*' or '/'
+ *      - Copy_S32Left: Left operand
+ *      - Copy_S32Right: Right operand
+ *      - Copy_PS32Result: Receives the result when there is no error
+ * Return: NUM_TOWER_OK, NUM_TOWER_DIV_ZERO or NUM_TOWER_OVERFLOW
+ ************************************************************************************/
+u8 NUM_TOWER_U8CheckedS32(u8 Copy_U8Operator, s32 Copy_S32Left, s32 Copy_S32Right, s32 *Copy_PS32Result);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8CountDigits
+ * Description: Counts the decimal digits of the magnitude of a number
+ * Parameters:
+ *      - Copy_PNumber: The number to measure
+ * Return: Number of digits (0 has one digit)
+ ************************************************************************************/
+u8 NUM_TOWER_U8CountDigits(const NUM_TOWER_Type *Copy_PNumber);
+
+/************************************************************************************
+ * Function Name: NUM_TOWER_U8ToAscii
+ * Description: Writes a number in decimal in at most Copy_U8Width characters. A number
+ *              too long for them is written in scientific notation, e.g.
+ *              "-1.2345679e21", rounded half up to the digits that fit, trailing
+ *              zeros of the mantissa dropped.
+ * Parameters:
+ *      - Copy_PNumber: The number to write
+ *      - Copy_U8Buffer: Receives the null-terminated text, Copy_U8Width + 1 bytes
+ *      - Copy_U8Width: Characters available, at least 8
+ * Return: Number of characters written, excluding the null terminator
+ ************************************************************************************/
+u8 NUM_TOWER_U8ToAscii(const NUM_TOWER_Type *Copy_PNumber, u8 *Copy_U8Buffer, u8 Copy_U8Width);
+
+#endif /* _NUM_TOWER_H_ */
@@ -1,49 +1,62 @@
-/******************************************************************************
- *
- * Module: Standard Types
- *
- * File Name: Std_Types.h
- *
- * Description: Header file for standard types definition
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-
-#ifndef _STD_TYPES_H_
-#define _STD_TYPES_H_
-
-/* Unsigned 16-bit integer */
-typedef unsigned short int u16;
-
-/* Signed 16-bit integer */
-typedef signed short int s16;
-
-/* Unsigned 32-bit integer */
-typedef unsigned long int u32;
-
-/* Signed 32-bit integer */
-typedef signed long int s32;
-
-/* Unsigned 64-bit integer */
-typedef unsigned long long int u64;
-
-/* Signed 64-bit integer */
-typedef signed long long int s64;
-
-/* 32-bit floating-point number */
-typedef float f32;
-
-/* 64-bit floating-point number */
-typedef double f64;
-
-/* 128-bit floating-point number */
-typedef long double f128;
-
-/* Unsigned 8-bit integer */
-typedef unsigned char u8;
-
-/* Signed 8-bit integer */
-typedef signed char s8;
-
-#endif /* _STD_TYPES_H_ */
+/******************************************************************************
+ *
+ * Module: Standard Types
+ *
+ * File Name: Std_Types.h
+ *
+ * Description: Header file for standard types definition
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _STD_TYPES_H_
+#define _STD_TYPES_H_
+
+/* Unsigned 16-bit integer */
+typedef unsigned short int u16;
+
+/* Signed 16-bit integer */
+typedef signed short int s16;
+
+/* 32-bit integers, long is 64 bits wide on most hosts so they use int there */
+#if defined(__AVR__)
+
+/* Unsigned 32-bit integer */
+typedef unsigned long int u32;
+
+/* Signed 32-bit integer */
+typedef signed long int s32;
+
+#else
+
+/* Unsigned 32-bit integer */
+typedef unsigned int u32;
+
+/* Signed 32-bit integer */
+typedef signed int s32;
+
+#endif
+
+/* Unsigned 64-bit integer */
+typedef unsigned long long int u64;
+
+/* Signed 64-bit integer */
+typedef signed long long int s64;
+
+/* 32-bit floating-point number */
+typedef float f32;
+
+/* 64-bit floating-point number */
+typedef double f64;
+
+/* 128-bit floating-point number */
+typedef long double f128;
+
+/* Unsigned 8-bit integer */
+typedef unsigned char u8;
+
+/* Signed 8-bit integer */
+typedef signed char s8;
+
+#endif /* _STD_TYPES_H_ */
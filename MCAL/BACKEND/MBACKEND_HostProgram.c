@@ -0,0 +1,392 @@
+/******************************************************************************
+ *
+ * Module: MBACKEND (MCAL Backend)
+ *
+ * File Name: MBACKEND_HostProgram.c
+ *
+ * Description: Host implementation of the MCAL backend. The I/O space is an
+ *              array, register writes are reported to an optional model, the
+ *              clock is simulated and advances only through the delays, and
+ *              Timer 0 and Timer 2 are modelled far enough to raise their
+ *              compare match interrupts on time. TIFR is write-only here, it
+ *              reads as 0 and writing ones clears the modelled flags. Not part
+ *              of AVR builds.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#if !defined(__AVR__)
+
+#include <stddef.h>
+#include "../../LIB/BIT_MATH.h"
+#include "MBACKEND_Interface.h"
+
+/* Registers the simulated clock looks at, see the ATmega32 datasheet */
+#define MBACKEND_TCCR0 0x53
+#define MBACKEND_TCNT0 0x52
+#define MBACKEND_OCR0  0x5C
+#define MBACKEND_TCCR2 0x45
+#define MBACKEND_TCNT2 0x44
+#define MBACKEND_OCR2  0x43
+#define MBACKEND_TIMSK 0x59
+#define MBACKEND_TIFR  0x58
+#define MBACKEND_SREG  0x5F
+
+/* Global interrupt enable bit of SREG and the CTC bit of TCCR0 and TCCR2 */
+#define MBACKEND_SREG_I   7
+#define MBACKEND_TCCR_CTC 3
+
+/* Number of timers with a compare match interrupt the backend models */
+#define MBACKEND_TIMERS 2
+
+/* Interrupt vectors of the timer driver, weak so a build without it still links */
+void __vector_10(void) __attribute__((weak));
+void __vector_4(void) __attribute__((weak));
+
+/************************************************************************************
+ * Description: Description of a modelled timer and its running state.
+ ************************************************************************************/
+typedef struct
+{
+	u8 Control;                 /* Address of TCCRn */
+	u8 Counter;                 /* Address of TCNTn */
+	u8 Compare;                 /* Address of OCRn */
+	u8 Flag;                    /* OCIEn bit in TIMSK and OCFn bit in TIFR */
+	const u16 *Prescalers;      /* Division factor for each clock select value */
+	void (*Vector)(void);       /* Compare match interrupt vector */
+	u64 Tick;                   /* Nanoseconds per count */
+	u64 Period;                 /* Nanoseconds between compare matches, 0 if stopped */
+	u64 Due;                    /* Time of the next compare match */
+} MBACKEND_TimerType;
+
+/* Clock select values 0 to 7 of Timer 0 and Timer 2, 0 stops the timer */
+static const u16 MBACKEND_AU16Timer0Prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+static const u16 MBACKEND_AU16Timer2Prescalers[8] = {0, 1, 8, 32, 64, 128, 256, 1024};
+
+static MBACKEND_TimerType MBACKEND_AStrTimers[MBACKEND_TIMERS] =
+{
+	{MBACKEND_TCCR0, MBACKEND_TCNT0, MBACKEND_OCR0, 1, MBACKEND_AU16Timer0Prescalers, NULL, 0, 0, 0},
+	{MBACKEND_TCCR2, MBACKEND_TCNT2, MBACKEND_OCR2, 7, MBACKEND_AU16Timer2Prescalers, NULL, 0, 0, 0},
+};
+
+/* The modelled data space */
+static volatile u8 MBACKEND_AU8IoSpace[MBACKEND_IO_SIZE];
+
+/* Interrupt flags of the timers, what TIFR would read on the target */
+static u8 MBACKEND_U8InterruptFlags = 0;
+
+/* Last register handed out and its value at that moment, to detect a write to it */
+static u8 MBACKEND_U8PendingActive = 0;
+static u8 MBACKEND_U8PendingAddress;
+static u8 MBACKEND_U8PendingValue;
+
+/* Models attached to the register space */
+static MBACKEND_WriteHookType MBACKEND_PFWriteHook = NULL;
+static MBACKEND_ReadHookType MBACKEND_PFReadHook = NULL;
+
+/* Simulated time in nanoseconds */
+static u64 MBACKEND_U64Now = 0;
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDRestartTimer
+ * Description: Recomputes the period of a timer after its registers changed and
+ *              restarts counting from the current time, as writing TCNTn does.
+ * Parameters:
+ *      - Copy_PStrTimer: The timer
+ * Return: None
+ *****************************************************************************/
+static void MBACKEND_VOIDRestartTimer(MBACKEND_TimerType *Copy_PStrTimer)
+{
+	u8 LOC_U8Control = MBACKEND_AU8IoSpace[Copy_PStrTimer->Control];
+	u64 LOC_U64Counts = 256;
+
+	/* In CTC mode the counter wraps after the compare value, otherwise after 255 */
+	if (GET_BIT(LOC_U8Control, MBACKEND_TCCR_CTC))
+	{
+		LOC_U64Counts = (u64)MBACKEND_AU8IoSpace[Copy_PStrTimer->Compare] + 1;
+	}
+
+	Copy_PStrTimer->Tick = (u64)Copy_PStrTimer->Prescalers[LOC_U8Control & 0x07] * MBACKEND_NS_PER_CYCLE;
+	Copy_PStrTimer->Period = LOC_U64Counts * Copy_PStrTimer->Tick;
+	Copy_PStrTimer->Due = MBACKEND_U64Now + Copy_PStrTimer->Period;
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDDispatch
+ * Description: Runs the interrupt of every timer whose flag is set, if it is
+ *              enabled and the global interrupt flag is set. The vector runs
+ *              with interrupts disabled and the flags are restored on return.
+ * Parameters: None
+ * Return: None
+ *****************************************************************************/
+static void MBACKEND_VOIDDispatch(void)
+{
+	u8 LOC_U8Index;
+
+	for (LOC_U8Index = 0; LOC_U8Index < MBACKEND_TIMERS; LOC_U8Index++)
+	{
+		MBACKEND_TimerType *LOC_PStrTimer = &MBACKEND_AStrTimers[LOC_U8Index];
+		u8 LOC_U8SREG = MBACKEND_AU8IoSpace[MBACKEND_SREG];
+
+		if (GET_BIT(LOC_U8SREG, MBACKEND_SREG_I)
+			&& GET_BIT(MBACKEND_U8InterruptFlags, LOC_PStrTimer->Flag)
+			&& GET_BIT(MBACKEND_AU8IoSpace[MBACKEND_TIMSK], LOC_PStrTimer->Flag)
+			&& NULL != LOC_PStrTimer->Vector)
+		{
+			MBACKEND_VOIDSync();
+			CLR_BIT(MBACKEND_U8InterruptFlags, LOC_PStrTimer->Flag);
+			CLR_BIT(MBACKEND_AU8IoSpace[MBACKEND_SREG], MBACKEND_SREG_I);
+			LOC_PStrTimer->Vector();
+			MBACKEND_VOIDSync();
+			SET_BIT(MBACKEND_AU8IoSpace[MBACKEND_SREG], MBACKEND_SREG_I);
+		}
+	}
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDSync
+ * Description: Reports the last pending register write to the write hook now.
+ * Parameters: None
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDSync(void)
+{
+	u8 LOC_U8Index;
+	u8 LOC_U8Address = MBACKEND_U8PendingAddress;
+	u8 LOC_U8Value = MBACKEND_AU8IoSpace[LOC_U8Address];
+
+	if (!MBACKEND_U8PendingActive || LOC_U8Value == MBACKEND_U8PendingValue)
+	{
+		MBACKEND_U8PendingActive = 0;
+		return;
+	}
+	MBACKEND_U8PendingActive = 0;
+
+	/* A new timer setting takes effect from now */
+	for (LOC_U8Index = 0; LOC_U8Index < MBACKEND_TIMERS; LOC_U8Index++)
+	{
+		MBACKEND_TimerType *LOC_PStrTimer = &MBACKEND_AStrTimers[LOC_U8Index];
+
+		if (LOC_U8Address == LOC_PStrTimer->Control || LOC_U8Address == LOC_PStrTimer->Counter
+			|| LOC_U8Address == LOC_PStrTimer->Compare)
+		{
+			MBACKEND_VOIDRestartTimer(LOC_PStrTimer);
+		}
+	}
+
+	/* Writing a one to an interrupt flag clears it, the register reads as 0 again */
+	if (MBACKEND_TIFR == LOC_U8Address)
+	{
+		MBACKEND_U8InterruptFlags &= ~LOC_U8Value;
+		MBACKEND_AU8IoSpace[MBACKEND_TIFR] = 0;
+	}
+
+	if (NULL != MBACKEND_PFWriteHook)
+	{
+		MBACKEND_PFWriteHook(LOC_U8Address, MBACKEND_U8PendingValue, LOC_U8Value);
+	}
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_PU8Register
+ * Description: Returns the memory cell modelling a register. A write through the
+ *              returned pointer is reported to the write hook on the next access.
+ * Parameters:
+ *      - Copy_U8Address: Data space address of the register
+ * Return: Pointer to the modelled register
+ *****************************************************************************/
+volatile u8 *MBACKEND_PU8Register(u8 Copy_U8Address)
+{
+	u8 LOC_U8Index;
+
+	MBACKEND_VOIDSync();
+
+	/* A running counter reads as the counts elapsed in the current period */
+	for (LOC_U8Index = 0; LOC_U8Index < MBACKEND_TIMERS; LOC_U8Index++)
+	{
+		MBACKEND_TimerType *LOC_PStrTimer = &MBACKEND_AStrTimers[LOC_U8Index];
+
+		if (Copy_U8Address == LOC_PStrTimer->Counter && 0 != LOC_PStrTimer->Period)
+		{
+			MBACKEND_AU8IoSpace[Copy_U8Address] =
+				(u8)((MBACKEND_U64Now + LOC_PStrTimer->Period - LOC_PStrTimer->Due) / LOC_PStrTimer->Tick);
+		}
+	}
+
+	if (NULL != MBACKEND_PFReadHook)
+	{
+		u8 LOC_U8Value = MBACKEND_AU8IoSpace[Copy_U8Address];
+		MBACKEND_PFReadHook(Copy_U8Address, &LOC_U8Value);
+		MBACKEND_AU8IoSpace[Copy_U8Address] = LOC_U8Value;
+	}
+
+	MBACKEND_U8PendingActive = 1;
+	MBACKEND_U8PendingAddress = Copy_U8Address;
+	MBACKEND_U8PendingValue = MBACKEND_AU8IoSpace[Copy_U8Address];
+
+	return &MBACKEND_AU8IoSpace[Copy_U8Address];
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_U8Peek
+ * Description: Reads a modelled register without running the hooks, for models.
+ * Parameters:
+ *      - Copy_U8Address: Data space address of the register
+ * Return: The current value of the register
+ *****************************************************************************/
+u8 MBACKEND_U8Peek(u8 Copy_U8Address)
+{
+	return (MBACKEND_TIFR == Copy_U8Address) ? MBACKEND_U8InterruptFlags : MBACKEND_AU8IoSpace[Copy_U8Address];
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDSetWriteHook
+ * Description: Installs the model observing register writes.
+ * Parameters:
+ *      - Copy_PFHook: The hook function, NULL to remove it
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDSetWriteHook(MBACKEND_WriteHookType Copy_PFHook)
+{
+	MBACKEND_VOIDSync();
+	MBACKEND_PFWriteHook = Copy_PFHook;
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDSetReadHook
+ * Description: Installs the model feeding register reads.
+ * Parameters:
+ *      - Copy_PFHook: The hook function, NULL to remove it
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDSetReadHook(MBACKEND_ReadHookType Copy_PFHook)
+{
+	MBACKEND_PFReadHook = Copy_PFHook;
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDDelayNs
+ * Description: Advances the simulated clock, running every timer interrupt that
+ *              falls due on the way. A vector that waits itself moves the clock
+ *              further, the remaining compare matches are then caught up.
+ * Parameters:
+ *      - Copy_U64Nanoseconds: Time to wait
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDDelayNs(u64 Copy_U64Nanoseconds)
+{
+	u64 LOC_U64Target = MBACKEND_U64Now + Copy_U64Nanoseconds;
+
+	MBACKEND_AStrTimers[0].Vector = __vector_10;
+	MBACKEND_AStrTimers[1].Vector = __vector_4;
+
+	MBACKEND_VOIDSync();
+
+	/* Interrupts left pending while they were disabled run first */
+	MBACKEND_VOIDDispatch();
+
+	while (1)
+	{
+		MBACKEND_TimerType *LOC_PStrNext = NULL;
+		u8 LOC_U8Index;
+
+		/* Find the earliest compare match up to the target time */
+		for (LOC_U8Index = 0; LOC_U8Index < MBACKEND_TIMERS; LOC_U8Index++)
+		{
+			MBACKEND_TimerType *LOC_PStrTimer = &MBACKEND_AStrTimers[LOC_U8Index];
+
+			if (0 != LOC_PStrTimer->Period && LOC_PStrTimer->Due <= LOC_U64Target
+				&& (NULL == LOC_PStrNext || LOC_PStrTimer->Due < LOC_PStrNext->Due))
+			{
+				LOC_PStrNext = LOC_PStrTimer;
+			}
+		}
+
+		if (NULL == LOC_PStrNext)
+		{
+			break;
+		}
+
+		if (LOC_PStrNext->Due > MBACKEND_U64Now)
+		{
+			MBACKEND_U64Now = LOC_PStrNext->Due;
+		}
+		LOC_PStrNext->Due += LOC_PStrNext->Period;
+
+		SET_BIT(MBACKEND_U8InterruptFlags, LOC_PStrNext->Flag);
+		MBACKEND_VOIDDispatch();
+	}
+
+	if (LOC_U64Target > MBACKEND_U64Now)
+	{
+		MBACKEND_U64Now = LOC_U64Target;
+	}
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDIdle
+ * Description: Advances the simulated clock to the next compare match of a
+ *              running timer and runs the interrupts due by then, or by one
+ *              cycle when no timer runs.
+ * Parameters: None
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDIdle(void)
+{
+	u64 LOC_U64Wait = MBACKEND_NS_PER_CYCLE;
+	u8 LOC_U8Running = 0;
+	u8 LOC_U8Index;
+
+	for (LOC_U8Index = 0; LOC_U8Index < MBACKEND_TIMERS; LOC_U8Index++)
+	{
+		MBACKEND_TimerType *LOC_PStrTimer = &MBACKEND_AStrTimers[LOC_U8Index];
+
+		if (0 != LOC_PStrTimer->Period)
+		{
+			u64 LOC_U64Until = (LOC_PStrTimer->Due > MBACKEND_U64Now) ? LOC_PStrTimer->Due - MBACKEND_U64Now : 0;
+
+			if (!LOC_U8Running || LOC_U64Until < LOC_U64Wait)
+			{
+				LOC_U64Wait = LOC_U64Until;
+			}
+			LOC_U8Running = 1;
+		}
+	}
+
+	MBACKEND_VOIDDelayNs(LOC_U64Wait);
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_U64GetTimeNs
+ * Description: Reads the simulated clock.
+ * Parameters: None
+ * Return: Nanoseconds since the start of the program
+ *****************************************************************************/
+u64 MBACKEND_U64GetTimeNs(void)
+{
+	return MBACKEND_U64Now;
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_VOIDStartCycleCounter
+ * Description: Nothing to start, the cycle count is derived from the simulated clock.
+ * Parameters: None
+ * Return: None
+ *****************************************************************************/
+void MBACKEND_VOIDStartCycleCounter(void)
+{
+}
+
+/*****************************************************************************
+ * Function Name: MBACKEND_U32GetCycles
+ * Description: Reads the simulated clock in CPU cycles.
+ * Parameters: None
+ * Return: CPU cycles since the start of the program, modulo 2^32
+ *****************************************************************************/
+u32 MBACKEND_U32GetCycles(void)
+{
+	return (u32)(MBACKEND_U64Now / MBACKEND_NS_PER_CYCLE);
+}
+
+#endif
@@ -0,0 +1,194 @@
+/******************************************************************************
+ *
+ * Module: MBACKEND (MCAL Backend)
+ *
+ * File Name: MBACKEND_Interface.h
+ *
+ * Description: Header file for the hardware backend under the MCAL drivers.
+ *              It provides register access, busy-wait delays and a clock
+ *              source. AVR builds map them straight onto the silicon, host
+ *              builds link MBACKEND_HostProgram.c which models the I/O space
+ *              in memory, runs a simulated clock and fires the timer compare
+ *              interrupts, so the drivers and the application run unchanged.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MBACKEND_INTERFACE_H_
+#define _MBACKEND_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+/* CPU clock the delays and the timers are derived from */
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+
+#if defined(__AVR__)
+
+#include <avr/delay.h>
+
+/************************************************************************************
+ * Macro Name: MBACKEND_REG
+ * Description: Accesses an I/O register by its data space address. The address is
+ *              a constant, so the compiler emits in/out/sbi/cbi directly.
+ * Parameters:
+ *      - address: Data space address of the register (0x20 to 0x5F)
+ * Return: The register as an lvalue
+ ************************************************************************************/
+#define MBACKEND_REG(address) (*((volatile u8*)(address)))
+
+/* Interrupt vectors are bound by name and must save every register they use */
+#define MBACKEND_ISR_ATTRIBUTE __attribute__((signal, used))
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDStartCycleCounter
+ * Description: Runs Timer 1 freely at the CPU clock so it counts cycles.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static inline void MBACKEND_VOIDStartCycleCounter(void)
+{
+	MBACKEND_REG(0x4F) = 0x00; /* TCCR1A: normal mode */
+	MBACKEND_REG(0x4E) = 0x01; /* TCCR1B: no prescaling */
+}
+
+/************************************************************************************
+ * Function Name: MBACKEND_U32GetCycles
+ * Description: Reads the cycle counter. TCNT1 is read low byte first so the high
+ *              byte is latched with it, the count wraps every 65536 cycles.
+ * Parameters: None
+ * Return: CPU cycles modulo 65536
+ ************************************************************************************/
+static inline u32 MBACKEND_U32GetCycles(void)
+{
+	return *((volatile u16*)0x4C);
+}
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDIdle
+ * Description: Called by a driver spinning on a flag that an interrupt sets. The
+ *              target needs nothing, its interrupts run on their own.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static inline void MBACKEND_VOIDIdle(void)
+{
+}
+
+#else
+
+/* Size of the modelled data space, covers every I/O register of the ATmega32 */
+#define MBACKEND_IO_SIZE 0x60
+
+/* Nanoseconds per CPU cycle of the simulated clock */
+#define MBACKEND_NS_PER_CYCLE (1000000000UL / F_CPU)
+
+/* Each access goes through the backend so it can report the writes it observes */
+#define MBACKEND_REG(address) (*MBACKEND_PU8Register(address))
+
+/* Interrupt vectors are ordinary functions called by the simulated clock */
+#define MBACKEND_ISR_ATTRIBUTE __attribute__((used))
+
+/* Busy-wait delays advance the simulated clock instead of spinning */
+#define _delay_us(us) MBACKEND_VOIDDelayNs((u64)((us) * 1000.0))
+#define _delay_ms(ms) MBACKEND_VOIDDelayNs((u64)((ms) * 1000000.0))
+
+/************************************************************************************
+ * Description: Called with the old and new value of a register once a write to it
+ *              is observed, before the next register access or delay.
+ ************************************************************************************/
+typedef void (*MBACKEND_WriteHookType)(u8 Copy_U8Address, u8 Copy_U8OldValue, u8 Copy_U8NewValue);
+
+/************************************************************************************
+ * Description: Called before a register is read so the model can update the value
+ *              the firmware sees, e.g. a PIN register driven by external hardware.
+ ************************************************************************************/
+typedef void (*MBACKEND_ReadHookType)(u8 Copy_U8Address, u8 *Copy_PU8Value);
+
+/************************************************************************************
+ * Function Name: MBACKEND_PU8Register
+ * Description: Returns the memory cell modelling a register. A write through the
+ *              returned pointer is reported to the write hook on the next access.
+ * Parameters:
+ *      - Copy_U8Address: Data space address of the register
+ * Return: Pointer to the modelled register
+ ************************************************************************************/
+volatile u8 *MBACKEND_PU8Register(u8 Copy_U8Address);
+
+/************************************************************************************
+ * Function Name: MBACKEND_U8Peek
+ * Description: Reads a modelled register without running the hooks, for models.
+ * Parameters:
+ *      - Copy_U8Address: Data space address of the register
+ * Return: The current value of the register
+ ************************************************************************************/
+u8 MBACKEND_U8Peek(u8 Copy_U8Address);
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDSync
+ * Description: Reports the last pending register write to the write hook now.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MBACKEND_VOIDSync(void);
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDSetWriteHook / MBACKEND_VOIDSetReadHook
+ * Description: Installs the model observing register writes or feeding register
+ *              reads. NULL removes it.
+ * Parameters:
+ *      - Copy_PFHook: The hook function
+ * Return: None
+ ************************************************************************************/
+void MBACKEND_VOIDSetWriteHook(MBACKEND_WriteHookType Copy_PFHook);
+void MBACKEND_VOIDSetReadHook(MBACKEND_ReadHookType Copy_PFHook);
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDDelayNs
+ * Description: Advances the simulated clock, running every timer interrupt that
+ *              falls due on the way, as a busy-wait would on the target.
+ * Parameters:
+ *      - Copy_U64Nanoseconds: Time to wait
+ * Return: None
+ ************************************************************************************/
+void MBACKEND_VOIDDelayNs(u64 Copy_U64Nanoseconds);
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDIdle
+ * Description: Called by a driver spinning on a flag that an interrupt sets. The
+ *              simulated clock only moves in delays, so it is advanced to the next
+ *              compare match and the interrupts due by then are run.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MBACKEND_VOIDIdle(void);
+
+/************************************************************************************
+ * Function Name: MBACKEND_VOIDStartCycleCounter
+ * Description: Nothing to start, the cycle count is derived from the simulated clock.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MBACKEND_VOIDStartCycleCounter(void);
+
+/************************************************************************************
+ * Function Name: MBACKEND_U32GetCycles
+ * Description: Reads the simulated clock in CPU cycles.
+ * Parameters: None
+ * Return: CPU cycles since the start of the program, modulo 2^32
+ ************************************************************************************/
+u32 MBACKEND_U32GetCycles(void);
+
+/************************************************************************************
+ * Function Name: MBACKEND_U64GetTimeNs
+ * Description: Reads the simulated clock.
+ * Parameters: None
+ * Return: Nanoseconds since the start of the program
+ ************************************************************************************/
+u64 MBACKEND_U64GetTimeNs(void);
+
+#endif
+
+#endif /* _MBACKEND_INTERFACE_H_ */
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *
+ * Module: MDIO (MCAL Digital I/O)
+ *
+ * File Name: MDIO_CFG.h
+ *
+ * Description: Configuration file for the MDIO module
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MDIO_CFG_H_
+#define _MDIO_CFG_H_
+
+/************************************************************************************
+ * Description: Keep a RAM copy of every PORT register. MDIO_VOIDWritePortMasked then
+ *              computes the new value from the copy and skips the write when nothing
+ *              changes. On the ATmega32 reading PORTx is a single-cycle instruction,
+ *              so the copy only pays off when register accesses are expensive. Every
+ *              PORT writer then updates the register and the copy with interrupts
+ *              held off, so an interrupt never computes from a stale copy.
+ * Default: 0
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ ************************************************************************************/
+#define MDIO_PORT_SHADOW 0
+
+/************************************************************************************
+ * Description: Record every DDR and PORT write and every PIN read in a ring buffer
+ *              with a cycle timestamp, see MDIO_VOIDTraceClear. On the target the
+ *              timestamp is Timer 1 running at the CPU clock and wraps every 65536
+ *              cycles, on the host it is the simulated clock. When disabled the
+ *              trace points compile to nothing. May be set from the command line.
+ * Default: 0
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ ************************************************************************************/
+#ifndef MDIO_TRACE
+#define MDIO_TRACE 0
+#endif
+
+/************************************************************************************
+ * Description: Number of records kept by the trace, the oldest are overwritten.
+ *              Must be a power of two no larger than 32768. A record takes 8 bytes.
+ * Default: 64
+ ************************************************************************************/
+#ifndef MDIO_TRACE_SIZE
+#define MDIO_TRACE_SIZE 64
+#endif
+
+#endif /* _MDIO_CFG_H_ */
@@ -1,90 +1,388 @@
-/******************************************************************************
- *
- * Module: MDIO (MCAL Digital I/O)
- *
- * File Name: MDIO_Interface.h
- *
- * Description: Header file for the MDIO module functions
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-#ifndef _MDIO_INTERFACE_H_
-#define _MDIO_INTERFACE_H_
-
-#include "../../LIB/STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-#include "MDIO_Private.h"
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPinDirection
- * Description: Sets the direction of a specific pin in a given port (input or output)
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- *      - Copy_U8Direction: The direction (1 for output, 0 for input)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPinDirection(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Direction);
-
-/************************************************************************************
- * Function Name: MDIO_U8GetPinValue
- * Description: Gets the current value of a specific pin in a given port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- * Return: The value of the pin (0 or 1)
- ************************************************************************************/
-u8 MDIO_U8GetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin);
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPortValue
- * Description: Sets the value of all pins in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8PortValue: The value to set for all pins in the port (0 to 255)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPortValue(u8 Copy_U8Port, u8 Copy_U8PortValue);
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPinValue
- * Description: Sets the value of a specific pin in a given port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- *      - Copy_U8Value: The value to set (1 or 0)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Value);
-
-/************************************************************************************
- * Function Name: MDIO_VOIDTogglePinValue
- * Description: Toggles the value of a specific pin in a given port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDTogglePinValue(u8 Copy_U8Port, u8 Copy_U8Pin);
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPortDirection
- * Description: Sets the direction (input or output) of all pins in a given port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Direction: The direction for all pins in the port (0 for input, 255 for output)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPortDirection(u8 Copy_U8Port, u8 Copy_U8Direction);
-
-/************************************************************************************
- * Function Name: MDIO_U8GetPortValue
- * Description: Gets the current value of all pins in a given port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- * Return: The value of all pins in the port (0 to 255)
- ************************************************************************************/
-u8 MDIO_U8GetPortValue(u8 Copy_U8Port);
-
-#endif
+/******************************************************************************
+ *
+ * Module: MDIO (MCAL Digital I/O)
+ *
+ * File Name: MDIO_Interface.h
+ *
+ * Description: Header file for the MDIO module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _MDIO_INTERFACE_H_
+#define _MDIO_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../BACKEND/MBACKEND_Interface.h"
+#include "MDIO_Private.h"
+#include "MDIO_CFG.h"
+
+#if MDIO_PORT_SHADOW == 1
+/* Last value written to every PORT register, owned by MDIO_Program.c */
+extern u8 MDIO_AU8PortShadow[4];
+#endif
+
+/* Kind of access held by a trace record */
+#define MDIO_TRACE_KIND_READ  0
+#define MDIO_TRACE_KIND_WRITE 1
+
+/************************************************************************************
+ * Description: One register access recorded by the trace.
+ ************************************************************************************/
+typedef struct
+{
+	u32 Cycle;      /* Cycle counter of the backend when the access was made */
+	u8 Address;     /* Data space address of the DDR, PORT or PIN register */
+	u8 Value;       /* Value of the register after a write, or the value read */
+	u8 Kind;        /* MDIO_TRACE_KIND_READ or MDIO_TRACE_KIND_WRITE */
+} MDIO_TraceType;
+
+#if MDIO_TRACE == 1
+/* Trace points of the DIO functions, used by the inline accessors too */
+#define MDIO_TRACE_WRITE(address, value) MDIO_VOIDTraceRecord(MDIO_TRACE_KIND_WRITE, (address), (value))
+#define MDIO_TRACE_READ(address, value)  MDIO_VOIDTraceRecord(MDIO_TRACE_KIND_READ, (address), (value))
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceRecord
+ * Description: Appends a record to the trace, overwriting the oldest when it is full.
+ *              Safe to call from interrupts.
+ * Parameters:
+ *      - Copy_U8Kind: MDIO_TRACE_KIND_READ or MDIO_TRACE_KIND_WRITE
+ *      - Copy_U8Address: Data space address of the register
+ *      - Copy_U8Value: Value written or read
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceRecord(u8 Copy_U8Kind, u8 Copy_U8Address, u8 Copy_U8Value);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceClear
+ * Description: Empties the trace and starts the cycle counter of the backend.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceClear(void);
+
+/************************************************************************************
+ * Function Name: MDIO_U16TraceCount
+ * Description: Returns the number of records held by the trace.
+ * Parameters: None
+ * Return: Number of records, at most MDIO_TRACE_SIZE
+ ************************************************************************************/
+u16 MDIO_U16TraceCount(void);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceGet
+ * Description: Copies a record out of the trace.
+ * Parameters:
+ *      - Copy_U16Index: Index of the record, 0 is the oldest
+ *      - Copy_PStrRecord: Receives the record
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceGet(u16 Copy_U16Index, MDIO_TraceType *Copy_PStrRecord);
+#else
+#define MDIO_TRACE_WRITE(address, value) ((void)0)
+#define MDIO_TRACE_READ(address, value)  ((void)0)
+#endif
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinDirection
+ * Description: Sets the direction of a specific pin in a given port (input or output)
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ *      - Copy_U8Direction: The direction (1 for output, 0 for input)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPinDirection(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Direction);
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPinValue
+ * Description: Gets the current value of a specific pin in a given port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ * Return: The value of the pin (0 or 1)
+ ************************************************************************************/
+u8 MDIO_U8GetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortValue
+ * Description: Sets the value of all pins in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8PortValue: The value to set for all pins in the port (0 to 255)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPortValue(u8 Copy_U8Port, u8 Copy_U8PortValue);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinValue
+ * Description: Sets the value of a specific pin in a given port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ *      - Copy_U8Value: The value to set (1 or 0)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Value);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTogglePinValue
+ * Description: Toggles the value of a specific pin in a given port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTogglePinValue(u8 Copy_U8Port, u8 Copy_U8Pin);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortDirection
+ * Description: Sets the direction (input or output) of all pins in a given port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Direction: The direction for all pins in the port (0 for input, 255 for output)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPortDirection(u8 Copy_U8Port, u8 Copy_U8Direction);
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPortValue
+ * Description: Gets the current value of all pins in a given port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ * Return: The value of all pins in the port (0 to 255)
+ ************************************************************************************/
+u8 MDIO_U8GetPortValue(u8 Copy_U8Port);
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDWritePortMasked
+ * Description: Sets the pins selected by a mask to the matching bits of a value in
+ *              a single register write, leaving the other pins untouched. Interrupts
+ *              are held off during the read-modify-write. With MDIO_PORT_SHADOW the
+ *              write is skipped when no pin changes.
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Mask: The pins to change (1 bit per pin)
+ *      - Copy_U8Value: The new levels of the selected pins
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDWritePortMasked(u8 Copy_U8Port, u8 Copy_U8Mask, u8 Copy_U8Value);
+
+/************************************************************************************
+ * Function Name: MDIO_U8ReadPortMasked
+ * Description: Reads the pins selected by a mask in a single register read
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Mask: The pins to read (1 bit per pin)
+ * Return: The levels of the selected pins, other bits are 0
+ ************************************************************************************/
+u8 MDIO_U8ReadPortMasked(u8 Copy_U8Port, u8 Copy_U8Mask);
+
+/************************************************************************************
+ * Inline API: The functions below behave like their out-of-line counterparts but are
+ * expanded at the call site. When the port and pin are compile-time constants, as
+ * they are in HLCD_CFG.h and the keypad driver, the access reduces to a single
+ * sbi, cbi, sbis, in or out instruction. Otherwise the out-of-line function is called.
+ ************************************************************************************/
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinDirectionInline
+ * Description: Inline version of MDIO_VOIDSetPinDirection
+ ************************************************************************************/
+static inline __attribute__((always_inline)) void MDIO_VOIDSetPinDirectionInline(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Direction)
+{
+	if (__builtin_constant_p(Copy_U8Port) && __builtin_constant_p(Copy_U8Pin) && Copy_U8Port < 4 && Copy_U8Pin < 8)
+	{
+		if (1 == Copy_U8Direction)
+		{
+			SET_BIT(MDIO_DDR_REG(Copy_U8Port), Copy_U8Pin);
+		}
+		else if (0 == Copy_U8Direction)
+		{
+			CLR_BIT(MDIO_DDR_REG(Copy_U8Port), Copy_U8Pin);
+		}
+
+		MDIO_TRACE_WRITE(MDIO_DDR_ADDRESS(Copy_U8Port), MDIO_DDR_REG(Copy_U8Port));
+	}
+	else
+	{
+		MDIO_VOIDSetPinDirection(Copy_U8Port, Copy_U8Pin, Copy_U8Direction);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPinValueInline
+ * Description: Inline version of MDIO_U8GetPinValue
+ ************************************************************************************/
+static inline __attribute__((always_inline)) u8 MDIO_U8GetPinValueInline(u8 Copy_U8Port, u8 Copy_U8Pin)
+{
+	u8 LOC_U8RetValue;
+
+	if (__builtin_constant_p(Copy_U8Port) && __builtin_constant_p(Copy_U8Pin) && Copy_U8Port < 4 && Copy_U8Pin < 8)
+	{
+		LOC_U8RetValue = MDIO_PIN_REG(Copy_U8Port);
+		MDIO_TRACE_READ(MDIO_PIN_ADDRESS(Copy_U8Port), LOC_U8RetValue);
+		LOC_U8RetValue = GET_BIT(LOC_U8RetValue, Copy_U8Pin);
+	}
+	else
+	{
+		LOC_U8RetValue = MDIO_U8GetPinValue(Copy_U8Port, Copy_U8Pin);
+	}
+
+	return LOC_U8RetValue;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortValueInline
+ * Description: Inline version of MDIO_VOIDSetPortValue
+ ************************************************************************************/
+static inline __attribute__((always_inline)) void MDIO_VOIDSetPortValueInline(u8 Copy_U8Port, u8 Copy_U8PortValue)
+{
+	if (__builtin_constant_p(Copy_U8Port) && Copy_U8Port < 4)
+	{
+#if MDIO_PORT_SHADOW == 1
+		/* The shadow and the register change together, out of reach of interrupts */
+		u8 LOC_U8Status = MDIO_SREG_REG;
+
+		CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+		MDIO_AU8PortShadow[Copy_U8Port] = Copy_U8PortValue;
+#endif
+		MDIO_PORT_REG(Copy_U8Port) = Copy_U8PortValue;
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), Copy_U8PortValue);
+
+#if MDIO_PORT_SHADOW == 1
+		MDIO_SREG_REG = LOC_U8Status;
+#endif
+	}
+	else
+	{
+		MDIO_VOIDSetPortValue(Copy_U8Port, Copy_U8PortValue);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinValueInline
+ * Description: Inline version of MDIO_VOIDSetPinValue. With a constant port and pin a
+ *              variable value costs one branch between sbi and cbi.
+ ************************************************************************************/
+static inline __attribute__((always_inline)) void MDIO_VOIDSetPinValueInline(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Value)
+{
+	if (__builtin_constant_p(Copy_U8Port) && __builtin_constant_p(Copy_U8Pin) && Copy_U8Port < 4 && Copy_U8Pin < 8)
+	{
+#if MDIO_PORT_SHADOW == 1
+		/* Interrupts wait until the shadow holds the new pin level too */
+		u8 LOC_U8Status = MDIO_SREG_REG;
+
+		CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+#endif
+		if (1 == Copy_U8Value)
+		{
+			SET_BIT(MDIO_PORT_REG(Copy_U8Port), Copy_U8Pin);
+		}
+		else if (0 == Copy_U8Value)
+		{
+			CLR_BIT(MDIO_PORT_REG(Copy_U8Port), Copy_U8Pin);
+		}
+
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), MDIO_PORT_REG(Copy_U8Port));
+
+#if MDIO_PORT_SHADOW == 1
+		MDIO_AU8PortShadow[Copy_U8Port] = MDIO_PORT_REG(Copy_U8Port);
+		MDIO_SREG_REG = LOC_U8Status;
+#endif
+	}
+	else
+	{
+		MDIO_VOIDSetPinValue(Copy_U8Port, Copy_U8Pin, Copy_U8Value);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortDirectionInline
+ * Description: Inline version of MDIO_VOIDSetPortDirection
+ ************************************************************************************/
+static inline __attribute__((always_inline)) void MDIO_VOIDSetPortDirectionInline(u8 Copy_U8Port, u8 Copy_U8Direction)
+{
+	if (__builtin_constant_p(Copy_U8Port) && Copy_U8Port < 4)
+	{
+		MDIO_DDR_REG(Copy_U8Port) = Copy_U8Direction;
+		MDIO_TRACE_WRITE(MDIO_DDR_ADDRESS(Copy_U8Port), Copy_U8Direction);
+	}
+	else
+	{
+		MDIO_VOIDSetPortDirection(Copy_U8Port, Copy_U8Direction);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPortValueInline
+ * Description: Inline version of MDIO_U8GetPortValue
+ ************************************************************************************/
+static inline __attribute__((always_inline)) u8 MDIO_U8GetPortValueInline(u8 Copy_U8Port)
+{
+	u8 LOC_U8RetValue;
+
+	if (__builtin_constant_p(Copy_U8Port) && Copy_U8Port < 4)
+	{
+		LOC_U8RetValue = MDIO_PIN_REG(Copy_U8Port);
+		MDIO_TRACE_READ(MDIO_PIN_ADDRESS(Copy_U8Port), LOC_U8RetValue);
+	}
+	else
+	{
+		LOC_U8RetValue = MDIO_U8GetPortValue(Copy_U8Port);
+	}
+
+	return LOC_U8RetValue;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDWritePortMaskedInline
+ * Description: Inline version of MDIO_VOIDWritePortMasked. With a constant port the
+ *              whole update is in, and, or and out between saving and restoring SREG.
+ ************************************************************************************/
+static inline __attribute__((always_inline)) void MDIO_VOIDWritePortMaskedInline(u8 Copy_U8Port, u8 Copy_U8Mask, u8 Copy_U8Value)
+{
+	u8 LOC_U8Status, LOC_U8NewValue;
+
+	if (__builtin_constant_p(Copy_U8Port) && Copy_U8Port < 4)
+	{
+		/* Hold off interrupts for the read-modify-write */
+		LOC_U8Status = MDIO_SREG_REG;
+		CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+
+#if MDIO_PORT_SHADOW == 1
+		LOC_U8NewValue = (MDIO_AU8PortShadow[Copy_U8Port] & ~Copy_U8Mask) | (Copy_U8Value & Copy_U8Mask);
+
+		/* Skip the register access when no pin changes */
+		if (LOC_U8NewValue != MDIO_AU8PortShadow[Copy_U8Port])
+		{
+			MDIO_AU8PortShadow[Copy_U8Port] = LOC_U8NewValue;
+			MDIO_PORT_REG(Copy_U8Port) = LOC_U8NewValue;
+			MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), LOC_U8NewValue);
+		}
+#else
+		LOC_U8NewValue = (MDIO_PORT_REG(Copy_U8Port) & ~Copy_U8Mask) | (Copy_U8Value & Copy_U8Mask);
+		MDIO_PORT_REG(Copy_U8Port) = LOC_U8NewValue;
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), LOC_U8NewValue);
+#endif
+
+		MDIO_SREG_REG = LOC_U8Status;
+	}
+	else
+	{
+		MDIO_VOIDWritePortMasked(Copy_U8Port, Copy_U8Mask, Copy_U8Value);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8ReadPortMaskedInline
+ * Description: Inline version of MDIO_U8ReadPortMasked
+ ************************************************************************************/
+static inline __attribute__((always_inline)) u8 MDIO_U8ReadPortMaskedInline(u8 Copy_U8Port, u8 Copy_U8Mask)
+{
+	return MDIO_U8GetPortValueInline(Copy_U8Port) & Copy_U8Mask;
+}
+
+#endif
@@ -1,341 +1,587 @@
-/******************************************************************************
- *
- * Module: MDIO (MCAL Digital I/O)
- *
- * File Name: MDIO_Program.c
- *
- * Description: Source file for the MDIO module functions
- *
- * Author: Omar Khedr
- *
- ******************************************************************************/
-
-#include "MDIO_Interface.h"
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPinDirection
- * Description: Sets the direction of a specific pin in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- *      - Copy_U8Direction: The direction (1 for output, 0 for input)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPinDirection(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Direction)
-{
-	/* Check if the desired direction is output (1) */
-	if (1 == Copy_U8Direction)
-	{
-		/* Use the switch statement to handle different ports */
-		switch (Copy_U8Port)
-		{
-		case 0:
-			/* Set the corresponding bit in DDRA register to configure as output */
-			SET_BIT(DDRA_REG, Copy_U8Pin);
-			break;
-		case 1:
-			/* Set the corresponding bit in DDRB register to configure as output */
-			SET_BIT(DDRB_REG, Copy_U8Pin);
-			break;
-		case 2:
-			/* Set the corresponding bit in DDRC register to configure as output */
-			SET_BIT(DDRC_REG, Copy_U8Pin);
-			break;
-		case 3:
-			/* Set the corresponding bit in DDRD register to configure as output */
-			SET_BIT(DDRD_REG, Copy_U8Pin);
-			break;
-		default:
-			/* Invalid port, do nothing */
-			break;
-		}
-	}
-	/* Check if the desired direction is input (0) */
-	else if (0 == Copy_U8Direction)
-	{
-		/* Use the switch statement to handle different ports */
-		switch (Copy_U8Port)
-		{
-		case 0:
-			/* Clear the corresponding bit in DDRA register to configure as input */
-			CLR_BIT(DDRA_REG, Copy_U8Pin);
-			break;
-		case 1:
-			/* Clear the corresponding bit in DDRB register to configure as input */
-			CLR_BIT(DDRB_REG, Copy_U8Pin);
-			break;
-		case 2:
-			/* Clear the corresponding bit in DDRC register to configure as input */
-			CLR_BIT(DDRC_REG, Copy_U8Pin);
-			break;
-		case 3:
-			/* Clear the corresponding bit in DDRD register to configure as input */
-			CLR_BIT(DDRD_REG, Copy_U8Pin);
-			break;
-		default:
-			/* Invalid port, do nothing */
-			break;
-		}
-	}
-	else
-	{
-		/* Invalid direction value, do nothing */
-	}
-}
-
-/************************************************************************************
- * Function Name: MDIO_U8GetPinValue
- * Description: Reads the value of a specific pin in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- * Return: The value of the pin (0 or 1)
- ************************************************************************************/
-u8 MDIO_U8GetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin)
-{
-	u8 LOC_U8RetValue;  /* Variable to store the pin value */
-
-	/* Use the switch statement to handle different ports */
-	switch (Copy_U8Port)
-	{
-	case 0:
-		/* Get the value of the specified pin from PINA register */
-		LOC_U8RetValue = GET_BIT(PINA_REG, Copy_U8Pin);
-		break;
-	case 1:
-		/* Get the value of the specified pin from PINB register */
-		LOC_U8RetValue = GET_BIT(PINB_REG, Copy_U8Pin);
-		break;
-	case 2:
-		/* Get the value of the specified pin from PINC register */
-		LOC_U8RetValue = GET_BIT(PINC_REG, Copy_U8Pin);
-		break;
-	case 3:
-		/* Get the value of the specified pin from PIND register */
-		LOC_U8RetValue = GET_BIT(PIND_REG, Copy_U8Pin);
-		break;
-	default:
-		/* Invalid port, do nothing */
-		break;
-	}
-
-	/* Return the value of the pin (0 or 1) */
-	return LOC_U8RetValue;
-}
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPortValue
- * Description: Sets the value of all pins in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8PortValue: The value to set (8-bit value)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPortValue(u8 Copy_U8Port, u8 Copy_U8PortValue)
-{
-	/* Use the switch statement to handle different ports */
-	switch (Copy_U8Port)
-	{
-	case 0:
-		/* Assign the value to the PORTA register */
-		PORTA_REG = Copy_U8PortValue;
-		break;
-	case 1:
-		/* Assign the value to the PORTB register */
-		PORTB_REG = Copy_U8PortValue;
-		break;
-	case 2:
-		/* Assign the value to the PORTC register */
-		PORTC_REG = Copy_U8PortValue;
-		break;
-	case 3:
-		/* Assign the value to the PORTD register */
-		PORTD_REG = Copy_U8PortValue;
-		break;
-	default:
-		/* Invalid port, do nothing */
-		break;
-	}
-}
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPinValue
- * Description: Sets the value of a specific pin in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- *      - Copy_U8Value: The value to set (1 for HIGH, 0 for LOW)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Value)
-{
-	/* Check if the desired value is HIGH (1) */
-	if (1 == Copy_U8Value)
-	{
-		/* Use the switch statement to handle different ports */
-		switch (Copy_U8Port)
-		{
-		case 0:
-			/* Set the corresponding bit in PORTA register to HIGH */
-			SET_BIT(PORTA_REG, Copy_U8Pin);
-			break;
-		case 1:
-			/* Set the corresponding bit in PORTB register to HIGH */
-			SET_BIT(PORTB_REG, Copy_U8Pin);
-			break;
-		case 2:
-			/* Set the corresponding bit in PORTC register to HIGH */
-			SET_BIT(PORTC_REG, Copy_U8Pin);
-			break;
-		case 3:
-			/* Set the corresponding bit in PORTD register to HIGH */
-			SET_BIT(PORTD_REG, Copy_U8Pin);
-			break;
-		default:
-			/* Invalid port, do nothing */
-			break;
-		}
-	}
-	/* Check if the desired value is LOW (0) */
-	else if (0 == Copy_U8Value)
-	{
-		/* Use the switch statement to handle different ports */
-		switch (Copy_U8Port)
-		{
-		case 0:
-			/* Clear the corresponding bit in PORTA register to LOW */
-			CLR_BIT(PORTA_REG, Copy_U8Pin);
-			break;
-		case 1:
-			/* Clear the corresponding bit in PORTB register to LOW */
-			CLR_BIT(PORTB_REG, Copy_U8Pin);
-			break;
-		case 2:
-			/* Clear the corresponding bit in PORTC register to LOW */
-			CLR_BIT(PORTC_REG, Copy_U8Pin);
-			break;
-		case 3:
-			/* Clear the corresponding bit in PORTD register to LOW */
-			CLR_BIT(PORTD_REG, Copy_U8Pin);
-			break;
-		default:
-			/* Invalid port, do nothing */
-			break;
-		}
-	}
-	else
-	{
-		/* Invalid value, do nothing */
-	}
-}
-
-/************************************************************************************
- * Function Name: MDIO_VOIDTogglePinValue
- * Description: Toggles the value of a specific pin in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Pin: The pin number (0 to 7)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDTogglePinValue(u8 Copy_U8Port, u8 Copy_U8Pin)
-{
-	/* Use the switch statement to handle different ports */
-	switch (Copy_U8Port)
-	{
-	case 0:
-		/* Toggle the value of the pin in PORTA register */
-		TOGGLE_BIT(PORTA_REG, Copy_U8Pin);
-		break;
-	case 1:
-		/* Toggle the value of the pin in PORTB register */
-		TOGGLE_BIT(PORTB_REG, Copy_U8Pin);
-		break;
-	case 2:
-		/* Toggle the value of the pin in PORTC register */
-		TOGGLE_BIT(PORTC_REG, Copy_U8Pin);
-		break;
-	case 3:
-		/* Toggle the value of the pin in PORTD register */
-		TOGGLE_BIT(PORTD_REG, Copy_U8Pin);
-		break;
-	default:
-		/* Invalid port, do nothing */
-		break;
-	}
-}
-
-
-/************************************************************************************
- * Function Name: MDIO_VOIDSetPortDirection
- * Description: Sets the direction of all pins in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- *      - Copy_U8Direction: The direction to set (8-bit value, each bit represents a pin)
- * Return: None
- ************************************************************************************/
-void MDIO_VOIDSetPortDirection(u8 Copy_U8Port, u8 Copy_U8Direction)
-{
-	/* Use the switch statement to handle different ports */
-	switch (Copy_U8Port)
-	{
-	case 0:
-		/* Set the direction for all pins in PORTA register */
-		DDRA_REG = Copy_U8Direction;
-		break;
-	case 1:
-		/* Set the direction for all pins in PORTB register */
-		DDRB_REG = Copy_U8Direction;
-		break;
-	case 2:
-		/* Set the direction for all pins in PORTC register */
-		DDRC_REG = Copy_U8Direction;
-		break;
-	case 3:
-		/* Set the direction for all pins in PORTD register */
-		DDRD_REG = Copy_U8Direction;
-		break;
-	default:
-		/* Invalid port, do nothing */
-		break;
-	}
-}
-
-/************************************************************************************
- * Function Name: MDIO_U8GetPortValue
- * Description: Reads the value of all pins in a specific port
- * Parameters:
- *      - Copy_U8Port: The port number (0 to 3)
- * Return: The value of the port (8-bit value where each bit represents a pin)
- ************************************************************************************/
-u8 MDIO_U8GetPortValue(u8 Copy_U8Port)
-{
-	u8 LOC_U8RetValue;  /* Variable to store the port value */
-
-	/* Use the switch statement to handle different ports */
-	switch (Copy_U8Port)
-	{
-	case 0:
-		/* Get the value of all pins from PINA register */
-		LOC_U8RetValue = PINA_REG;
-		break;
-	case 1:
-		/* Get the value of all pins from PINB register */
-		LOC_U8RetValue = PINB_REG;
-		break;
-	case 2:
-		/* Get the value of all pins from PINC register */
-		LOC_U8RetValue = PINC_REG;
-		break;
-	case 3:
-		/* Get the value of all pins from PIND register */
-		LOC_U8RetValue = PIND_REG;
-		break;
-	default:
-		/* Invalid port, do nothing */
-		break;
-	}
-
-	/* Return the value of the port (8-bit value) */
-	return LOC_U8RetValue;
-}
-
+/******************************************************************************
+ *
+ * Module: MDIO (MCAL Digital I/O)
+ *
+ * File Name: MDIO_Program.c
+ *
+ * Description: Source file for the MDIO module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "MDIO_Interface.h"
+
+#if MDIO_PORT_SHADOW == 1
+/* Last value written to every PORT register */
+u8 MDIO_AU8PortShadow[4];
+#endif
+
+#if MDIO_TRACE == 1
+/* Trace ring buffer, the next record goes to the head */
+static MDIO_TraceType MDIO_AStrTrace[MDIO_TRACE_SIZE];
+static u16 MDIO_U16TraceHead;
+static u16 MDIO_U16TraceUsed;
+#endif
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinDirection
+ * Description: Sets the direction of a specific pin in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ *      - Copy_U8Direction: The direction (1 for output, 0 for input)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPinDirection(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Direction)
+{
+	/* Check if the desired direction is output (1) */
+	if (1 == Copy_U8Direction)
+	{
+		/* Use the switch statement to handle different ports */
+		switch (Copy_U8Port)
+		{
+		case 0:
+			/* Set the corresponding bit in DDRA register to configure as output */
+			SET_BIT(DDRA_REG, Copy_U8Pin);
+			break;
+		case 1:
+			/* Set the corresponding bit in DDRB register to configure as output */
+			SET_BIT(DDRB_REG, Copy_U8Pin);
+			break;
+		case 2:
+			/* Set the corresponding bit in DDRC register to configure as output */
+			SET_BIT(DDRC_REG, Copy_U8Pin);
+			break;
+		case 3:
+			/* Set the corresponding bit in DDRD register to configure as output */
+			SET_BIT(DDRD_REG, Copy_U8Pin);
+			break;
+		default:
+			/* Invalid port, do nothing */
+			break;
+		}
+	}
+	/* Check if the desired direction is input (0) */
+	else if (0 == Copy_U8Direction)
+	{
+		/* Use the switch statement to handle different ports */
+		switch (Copy_U8Port)
+		{
+		case 0:
+			/* Clear the corresponding bit in DDRA register to configure as input */
+			CLR_BIT(DDRA_REG, Copy_U8Pin);
+			break;
+		case 1:
+			/* Clear the corresponding bit in DDRB register to configure as input */
+			CLR_BIT(DDRB_REG, Copy_U8Pin);
+			break;
+		case 2:
+			/* Clear the corresponding bit in DDRC register to configure as input */
+			CLR_BIT(DDRC_REG, Copy_U8Pin);
+			break;
+		case 3:
+			/* Clear the corresponding bit in DDRD register to configure as input */
+			CLR_BIT(DDRD_REG, Copy_U8Pin);
+			break;
+		default:
+			/* Invalid port, do nothing */
+			break;
+		}
+	}
+	else
+	{
+		/* Invalid direction value, do nothing */
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_WRITE(MDIO_DDR_ADDRESS(Copy_U8Port), MDIO_DDR_REG(Copy_U8Port));
+	}
+#endif
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPinValue
+ * Description: Reads the value of a specific pin in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ * Return: The value of the pin (0 or 1)
+ ************************************************************************************/
+u8 MDIO_U8GetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin)
+{
+	u8 LOC_U8PortValue = 0; /* The one sample of the PIN register the pin is taken from */
+
+	/* Use the switch statement to handle different ports */
+	switch (Copy_U8Port)
+	{
+	case 0:
+		/* Sample the PINA register */
+		LOC_U8PortValue = PINA_REG;
+		break;
+	case 1:
+		/* Sample the PINB register */
+		LOC_U8PortValue = PINB_REG;
+		break;
+	case 2:
+		/* Sample the PINC register */
+		LOC_U8PortValue = PINC_REG;
+		break;
+	case 3:
+		/* Sample the PIND register */
+		LOC_U8PortValue = PIND_REG;
+		break;
+	default:
+		/* Invalid port, do nothing */
+		break;
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_READ(MDIO_PIN_ADDRESS(Copy_U8Port), LOC_U8PortValue);
+	}
+#endif
+
+	/* Return the value of the pin (0 or 1) */
+	return GET_BIT(LOC_U8PortValue, Copy_U8Pin);
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortValue
+ * Description: Sets the value of all pins in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8PortValue: The value to set (8-bit value)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPortValue(u8 Copy_U8Port, u8 Copy_U8PortValue)
+{
+#if MDIO_PORT_SHADOW == 1
+	u8 LOC_U8Status = MDIO_SREG_REG;
+
+	/* An interrupt between the write and the shadow refresh would see a stale shadow */
+	CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+#endif
+
+	/* Use the switch statement to handle different ports */
+	switch (Copy_U8Port)
+	{
+	case 0:
+		/* Assign the value to the PORTA register */
+		PORTA_REG = Copy_U8PortValue;
+		break;
+	case 1:
+		/* Assign the value to the PORTB register */
+		PORTB_REG = Copy_U8PortValue;
+		break;
+	case 2:
+		/* Assign the value to the PORTC register */
+		PORTC_REG = Copy_U8PortValue;
+		break;
+	case 3:
+		/* Assign the value to the PORTD register */
+		PORTD_REG = Copy_U8PortValue;
+		break;
+	default:
+		/* Invalid port, do nothing */
+		break;
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), MDIO_PORT_REG(Copy_U8Port));
+	}
+#endif
+
+#if MDIO_PORT_SHADOW == 1
+	/* Keep the shadow in step with the register */
+	if (Copy_U8Port < 4)
+	{
+		MDIO_AU8PortShadow[Copy_U8Port] = MDIO_PORT_REG(Copy_U8Port);
+	}
+	MDIO_SREG_REG = LOC_U8Status;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPinValue
+ * Description: Sets the value of a specific pin in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ *      - Copy_U8Value: The value to set (1 for HIGH, 0 for LOW)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPinValue(u8 Copy_U8Port, u8 Copy_U8Pin, u8 Copy_U8Value)
+{
+#if MDIO_PORT_SHADOW == 1
+	u8 LOC_U8Status = MDIO_SREG_REG;
+
+	/* An interrupt between the write and the shadow refresh would see a stale shadow */
+	CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+#endif
+
+	/* Check if the desired value is HIGH (1) */
+	if (1 == Copy_U8Value)
+	{
+		/* Use the switch statement to handle different ports */
+		switch (Copy_U8Port)
+		{
+		case 0:
+			/* Set the corresponding bit in PORTA register to HIGH */
+			SET_BIT(PORTA_REG, Copy_U8Pin);
+			break;
+		case 1:
+			/* Set the corresponding bit in PORTB register to HIGH */
+			SET_BIT(PORTB_REG, Copy_U8Pin);
+			break;
+		case 2:
+			/* Set the corresponding bit in PORTC register to HIGH */
+			SET_BIT(PORTC_REG, Copy_U8Pin);
+			break;
+		case 3:
+			/* Set the corresponding bit in PORTD register to HIGH */
+			SET_BIT(PORTD_REG, Copy_U8Pin);
+			break;
+		default:
+			/* Invalid port, do nothing */
+			break;
+		}
+	}
+	/* Check if the desired value is LOW (0) */
+	else if (0 == Copy_U8Value)
+	{
+		/* Use the switch statement to handle different ports */
+		switch (Copy_U8Port)
+		{
+		case 0:
+			/* Clear the corresponding bit in PORTA register to LOW */
+			CLR_BIT(PORTA_REG, Copy_U8Pin);
+			break;
+		case 1:
+			/* Clear the corresponding bit in PORTB register to LOW */
+			CLR_BIT(PORTB_REG, Copy_U8Pin);
+			break;
+		case 2:
+			/* Clear the corresponding bit in PORTC register to LOW */
+			CLR_BIT(PORTC_REG, Copy_U8Pin);
+			break;
+		case 3:
+			/* Clear the corresponding bit in PORTD register to LOW */
+			CLR_BIT(PORTD_REG, Copy_U8Pin);
+			break;
+		default:
+			/* Invalid port, do nothing */
+			break;
+		}
+	}
+	else
+	{
+		/* Invalid value, do nothing */
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), MDIO_PORT_REG(Copy_U8Port));
+	}
+#endif
+
+#if MDIO_PORT_SHADOW == 1
+	/* Keep the shadow in step with the register */
+	if (Copy_U8Port < 4)
+	{
+		MDIO_AU8PortShadow[Copy_U8Port] = MDIO_PORT_REG(Copy_U8Port);
+	}
+	MDIO_SREG_REG = LOC_U8Status;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTogglePinValue
+ * Description: Toggles the value of a specific pin in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Pin: The pin number (0 to 7)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTogglePinValue(u8 Copy_U8Port, u8 Copy_U8Pin)
+{
+#if MDIO_PORT_SHADOW == 1
+	u8 LOC_U8Status = MDIO_SREG_REG;
+
+	/* An interrupt between the write and the shadow refresh would see a stale shadow */
+	CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+#endif
+
+	/* Use the switch statement to handle different ports */
+	switch (Copy_U8Port)
+	{
+	case 0:
+		/* Toggle the value of the pin in PORTA register */
+		TOGGLE_BIT(PORTA_REG, Copy_U8Pin);
+		break;
+	case 1:
+		/* Toggle the value of the pin in PORTB register */
+		TOGGLE_BIT(PORTB_REG, Copy_U8Pin);
+		break;
+	case 2:
+		/* Toggle the value of the pin in PORTC register */
+		TOGGLE_BIT(PORTC_REG, Copy_U8Pin);
+		break;
+	case 3:
+		/* Toggle the value of the pin in PORTD register */
+		TOGGLE_BIT(PORTD_REG, Copy_U8Pin);
+		break;
+	default:
+		/* Invalid port, do nothing */
+		break;
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), MDIO_PORT_REG(Copy_U8Port));
+	}
+#endif
+
+#if MDIO_PORT_SHADOW == 1
+	/* Keep the shadow in step with the register */
+	if (Copy_U8Port < 4)
+	{
+		MDIO_AU8PortShadow[Copy_U8Port] = MDIO_PORT_REG(Copy_U8Port);
+	}
+	MDIO_SREG_REG = LOC_U8Status;
+#endif
+}
+
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDSetPortDirection
+ * Description: Sets the direction of all pins in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Direction: The direction to set (8-bit value, each bit represents a pin)
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDSetPortDirection(u8 Copy_U8Port, u8 Copy_U8Direction)
+{
+	/* Use the switch statement to handle different ports */
+	switch (Copy_U8Port)
+	{
+	case 0:
+		/* Set the direction for all pins in PORTA register */
+		DDRA_REG = Copy_U8Direction;
+		break;
+	case 1:
+		/* Set the direction for all pins in PORTB register */
+		DDRB_REG = Copy_U8Direction;
+		break;
+	case 2:
+		/* Set the direction for all pins in PORTC register */
+		DDRC_REG = Copy_U8Direction;
+		break;
+	case 3:
+		/* Set the direction for all pins in PORTD register */
+		DDRD_REG = Copy_U8Direction;
+		break;
+	default:
+		/* Invalid port, do nothing */
+		break;
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_WRITE(MDIO_DDR_ADDRESS(Copy_U8Port), MDIO_DDR_REG(Copy_U8Port));
+	}
+#endif
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8GetPortValue
+ * Description: Reads the value of all pins in a specific port
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ * Return: The value of the port (8-bit value where each bit represents a pin)
+ ************************************************************************************/
+u8 MDIO_U8GetPortValue(u8 Copy_U8Port)
+{
+	u8 LOC_U8RetValue = 0;  /* Variable to store the port value */
+
+	/* Use the switch statement to handle different ports */
+	switch (Copy_U8Port)
+	{
+	case 0:
+		/* Get the value of all pins from PINA register */
+		LOC_U8RetValue = PINA_REG;
+		break;
+	case 1:
+		/* Get the value of all pins from PINB register */
+		LOC_U8RetValue = PINB_REG;
+		break;
+	case 2:
+		/* Get the value of all pins from PINC register */
+		LOC_U8RetValue = PINC_REG;
+		break;
+	case 3:
+		/* Get the value of all pins from PIND register */
+		LOC_U8RetValue = PIND_REG;
+		break;
+	default:
+		/* Invalid port, do nothing */
+		break;
+	}
+
+#if MDIO_TRACE == 1
+	if (Copy_U8Port < 4)
+	{
+		MDIO_TRACE_READ(MDIO_PIN_ADDRESS(Copy_U8Port), LOC_U8RetValue);
+	}
+#endif
+
+	/* Return the value of the port (8-bit value) */
+	return LOC_U8RetValue;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDWritePortMasked
+ * Description: Sets the pins selected by a mask to the matching bits of a value in
+ *              a single register write, leaving the other pins untouched. Interrupts
+ *              are held off during the read-modify-write so an interrupt changing
+ *              other pins of the same port cannot be overwritten.
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Mask: The pins to change (1 bit per pin)
+ *      - Copy_U8Value: The new levels of the selected pins
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDWritePortMasked(u8 Copy_U8Port, u8 Copy_U8Mask, u8 Copy_U8Value)
+{
+	u8 LOC_U8Status, LOC_U8NewValue;
+
+	/* Only the four ports can be written */
+	if (Copy_U8Port < 4)
+	{
+		/* Hold off interrupts for the read-modify-write */
+		LOC_U8Status = MDIO_SREG_REG;
+		CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+
+#if MDIO_PORT_SHADOW == 1
+		LOC_U8NewValue = (MDIO_AU8PortShadow[Copy_U8Port] & ~Copy_U8Mask) | (Copy_U8Value & Copy_U8Mask);
+
+		/* Skip the register access when no pin changes */
+		if (LOC_U8NewValue != MDIO_AU8PortShadow[Copy_U8Port])
+		{
+			MDIO_AU8PortShadow[Copy_U8Port] = LOC_U8NewValue;
+			MDIO_PORT_REG(Copy_U8Port) = LOC_U8NewValue;
+			MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), LOC_U8NewValue);
+		}
+#else
+		LOC_U8NewValue = (MDIO_PORT_REG(Copy_U8Port) & ~Copy_U8Mask) | (Copy_U8Value & Copy_U8Mask);
+		MDIO_PORT_REG(Copy_U8Port) = LOC_U8NewValue;
+		MDIO_TRACE_WRITE(MDIO_PORT_ADDRESS(Copy_U8Port), LOC_U8NewValue);
+#endif
+
+		MDIO_SREG_REG = LOC_U8Status;
+	}
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U8ReadPortMasked
+ * Description: Reads the pins selected by a mask in a single register read
+ * Parameters:
+ *      - Copy_U8Port: The port number (0 to 3)
+ *      - Copy_U8Mask: The pins to read (1 bit per pin)
+ * Return: The levels of the selected pins, other bits are 0
+ ************************************************************************************/
+u8 MDIO_U8ReadPortMasked(u8 Copy_U8Port, u8 Copy_U8Mask)
+{
+	return MDIO_U8GetPortValue(Copy_U8Port) & Copy_U8Mask;
+}
+
+#if MDIO_TRACE == 1
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceRecord
+ * Description: Appends a record to the trace, overwriting the oldest when it is full.
+ *              Safe to call from interrupts.
+ * Parameters:
+ *      - Copy_U8Kind: MDIO_TRACE_KIND_READ or MDIO_TRACE_KIND_WRITE
+ *      - Copy_U8Address: Data space address of the register
+ *      - Copy_U8Value: Value written or read
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceRecord(u8 Copy_U8Kind, u8 Copy_U8Address, u8 Copy_U8Value)
+{
+	MDIO_TraceType *LOC_PStrRecord;
+	u8 LOC_U8Status;
+
+	/* An interrupt recording in between must not take the same slot */
+	LOC_U8Status = MDIO_SREG_REG;
+	CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+
+	LOC_PStrRecord = &MDIO_AStrTrace[MDIO_U16TraceHead];
+	LOC_PStrRecord->Cycle = MBACKEND_U32GetCycles();
+	LOC_PStrRecord->Address = Copy_U8Address;
+	LOC_PStrRecord->Value = Copy_U8Value;
+	LOC_PStrRecord->Kind = Copy_U8Kind;
+
+	MDIO_U16TraceHead = (MDIO_U16TraceHead + 1) & (MDIO_TRACE_SIZE - 1);
+	if (MDIO_U16TraceUsed < MDIO_TRACE_SIZE)
+	{
+		MDIO_U16TraceUsed++;
+	}
+
+	MDIO_SREG_REG = LOC_U8Status;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceClear
+ * Description: Empties the trace and starts the cycle counter of the backend.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceClear(void)
+{
+	u8 LOC_U8Status;
+
+	LOC_U8Status = MDIO_SREG_REG;
+	CLR_BIT(MDIO_SREG_REG, MDIO_SREG_I);
+
+	MBACKEND_VOIDStartCycleCounter();
+	MDIO_U16TraceHead = 0;
+	MDIO_U16TraceUsed = 0;
+
+	MDIO_SREG_REG = LOC_U8Status;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_U16TraceCount
+ * Description: Returns the number of records held by the trace.
+ * Parameters: None
+ * Return: Number of records, at most MDIO_TRACE_SIZE
+ ************************************************************************************/
+u16 MDIO_U16TraceCount(void)
+{
+	return MDIO_U16TraceUsed;
+}
+
+/************************************************************************************
+ * Function Name: MDIO_VOIDTraceGet
+ * Description: Copies a record out of the trace.
+ * Parameters:
+ *      - Copy_U16Index: Index of the record, 0 is the oldest
+ *      - Copy_PStrRecord: Receives the record
+ * Return: None
+ ************************************************************************************/
+void MDIO_VOIDTraceGet(u16 Copy_U16Index, MDIO_TraceType *Copy_PStrRecord)
+{
+	u16 LOC_U16Slot = (MDIO_U16TraceHead - MDIO_U16TraceUsed + Copy_U16Index) & (MDIO_TRACE_SIZE - 1);
+
+	*Copy_PStrRecord = MDIO_AStrTrace[LOC_U16Slot];
+}
+#endif
@@ -0,0 +1,36 @@
+/******************************************************************************
+ *
+ * Module: MGIE (MCAL Global Interrupt Enable)
+ *
+ * File Name: MGIE_Interface.h
+ *
+ * Description: Header file for the MGIE module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _MGIE_INTERFACE_H_
+#define _MGIE_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../BACKEND/MBACKEND_Interface.h"
+#include "MGIE_Private.h"
+
+/************************************************************************************
+ * Function Name: MGIE_VOIDEnable
+ * Description: Sets the I flag so enabled peripheral interrupts are serviced
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MGIE_VOIDEnable(void);
+
+/************************************************************************************
+ * Function Name: MGIE_VOIDDisable
+ * Description: Clears the I flag so no interrupt is serviced
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MGIE_VOIDDisable(void);
+
+#endif
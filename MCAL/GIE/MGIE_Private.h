@@ -0,0 +1,22 @@
+/******************************************************************************
+ *
+ * Module: MGIE (MCAL Global Interrupt Enable)
+ *
+ * File Name: MGIE_Private.h
+ *
+ * Description: Private header file for the MGIE module
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MGIE_PRIVATE_H_
+#define _MGIE_PRIVATE_H_
+
+/* Status Register, bit 7 is the global interrupt enable (I) flag */
+#define SREG_REG MBACKEND_REG(0x5F)
+
+/* Position of the I flag in SREG */
+#define SREG_I 7
+
+#endif /* _MGIE_PRIVATE_H_ */
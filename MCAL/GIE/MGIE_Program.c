@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * Module: MGIE (MCAL Global Interrupt Enable)
+ *
+ * File Name: MGIE_Program.c
+ *
+ * Description: Source file for the MGIE module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "MGIE_Interface.h"
+
+/************************************************************************************
+ * Function Name: MGIE_VOIDEnable
+ * Description: Sets the I flag so enabled peripheral interrupts are serviced
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MGIE_VOIDEnable(void)
+{
+	SET_BIT(SREG_REG, SREG_I);
+}
+
+/************************************************************************************
+ * Function Name: MGIE_VOIDDisable
+ * Description: Clears the I flag so no interrupt is serviced
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MGIE_VOIDDisable(void)
+{
+	CLR_BIT(SREG_REG, SREG_I);
+}
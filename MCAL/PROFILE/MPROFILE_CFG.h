@@ -0,0 +1,172 @@
+/******************************************************************************
+ *
+ * Module: MPROFILE (MCAL Cycle Profiler)
+ *
+ * File Name: MPROFILE_CFG.h
+ *
+ * Description: Configuration file for the MPROFILE module to enable the
+ *              profiler and list the instrumented regions.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MPROFILE_CFG_H_
+#define _MPROFILE_CFG_H_
+
+/************************************************************************************
+ * Description: Count the calls and the CPU cycles spent in each region marked with
+ *              MPROFILE_ENTER and MPROFILE_EXIT. On the target the cycles are counted
+ *              by Timer 1, which the profiler then owns, on the host by the simulated
+ *              clock. When disabled the marks compile to nothing and the module adds
+ *              no code or data. May be set from the command line.
+ * Default: 0
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ ************************************************************************************/
+#ifndef MPROFILE_ENABLE
+#define MPROFILE_ENABLE 0
+#endif
+
+/************************************************************************************
+ * Description: Instrumented regions, each has its own record. MPROFILE_REGIONS is the
+ *              number of regions and MPROFILE_REGION_NAMES their names in the same
+ *              order, at most MPROFILE_NAME_SIZE - 1 characters so they fit the LCD.
+ *              The number regions are indexed by NUM_TOWER width and must stay in
+ *              that order. The other numbers are counted by operator instead. The
+ *              function regions are indexed by Calculator function code, from
+ *              MPROFILE_SQRT up, and must stay in that order too.
+ ************************************************************************************/
+#define MPROFILE_ERROR_STATE      0 /* Calculator_U8ErrorState */
+#define MPROFILE_OPERATIONS_ORDER 1 /* Calculator_U8OperationsOrder */
+#define MPROFILE_OPERATION        2 /* Calculator_VOIDOperationCalculation */
+#define MPROFILE_STREAM_FEED      3 /* Calculator_VOIDStreamFeed */
+#define MPROFILE_SEND_CHARACTER   4 /* HLCD_VOIDSendCharacter */
+#define MPROFILE_PRESSED_VALUE    5 /* HKPD_U8GetPressedValue */
+#define MPROFILE_SCAN_TICK        6 /* HKPD_VOIDScanTick */
+#define MPROFILE_NUMBER_16        7 /* Calculator_U8NumberApply, widest operand s16 */
+#define MPROFILE_NUMBER_32        8 /* Calculator_U8NumberApply, widest operand s32 */
+#define MPROFILE_NUMBER_64        9 /* Calculator_U8NumberApply, widest operand s64 */
+#define MPROFILE_NUMBER_BIG      10 /* Calculator_U8NumberApply, widest operand big */
+#define MPROFILE_OPERATOR_ADD    11 /* Calculator_U8NumberApply, fixed, float or rational '+' */
+#define MPROFILE_OPERATOR_SUB    12 /* Calculator_U8NumberApply, fixed, float or rational '-' */
+#define MPROFILE_OPERATOR_MUL    13 /* Calculator_U8NumberApply, fixed, float or rational '*' */
+#define MPROFILE_OPERATOR_DIV    14 /* Calculator_U8NumberApply, fixed, float or rational '/' */
+#define MPROFILE_POWER           15 /* Calculator_U8NumberPower, '^' of any number type */
+#define MPROFILE_MOD_POWER       16 /* Calculator_U8NumberModPower, '^' then '%' */
+#define MPROFILE_SQRT            17 /* Calculator_U8NumberFunction, square root */
+#define MPROFILE_SIN             18 /* Calculator_U8NumberFunction, sine */
+#define MPROFILE_COS             19 /* Calculator_U8NumberFunction, cosine */
+#define MPROFILE_ATAN            20 /* Calculator_U8NumberFunction, arctangent */
+#define MPROFILE_EXP             21 /* Calculator_U8NumberFunction, exponential */
+#define MPROFILE_LN              22 /* Calculator_U8NumberFunction, natural logarithm */
+#define MPROFILE_FORMAT          23 /* NUM_FMT_U8S32ToAscii, s32 results */
+#define MPROFILE_REGIONS         24
+
+#define MPROFILE_NAME_SIZE 11
+
+#define MPROFILE_REGION_NAMES \
+{ \
+	"ErrorState", \
+	"OpsOrder",   \
+	"Operation",  \
+	"StreamFeed", \
+	"SendChar",   \
+	"PressedVal", \
+	"ScanTick",   \
+	"Num16",      \
+	"Num32",      \
+	"Num64",      \
+	"NumBig",     \
+	"OpAdd",      \
+	"OpSub",      \
+	"OpMul",      \
+	"OpDiv",      \
+	"Power",      \
+	"ModPower",   \
+	"Sqrt",       \
+	"Sin",        \
+	"Cos",        \
+	"Atan",       \
+	"Exp",        \
+	"Ln",         \
+	"Format",     \
+}
+
+/************************************************************************************
+ * Description: Follow every key press through the pipeline and keep latency
+ *              histograms for each kind of key, see MPROFILE_U16LatencyPercentile.
+ *              The stages are timestamped with the cycle counter of the profiler,
+ *              so Timer 1 is taken on the target as well. May be set from the
+ *              command line.
+ * Default: 0
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ ************************************************************************************/
+#ifndef MPROFILE_LATENCY
+#define MPROFILE_LATENCY 0
+#endif
+
+/************************************************************************************
+ * Description: Kinds of key press, each with its own histograms. MPROFILE_CLASS_OF
+ *              maps a key to its kind and MPROFILE_CLASS_NAMES names them, at most
+ *              MPROFILE_NAME_SIZE - 1 characters.
+ ************************************************************************************/
+#define MPROFILE_CLASS_ECHO     0 /* Digits and operators, echoed on the display */
+#define MPROFILE_CLASS_EVALUATE 1 /* '=', evaluation and result */
+#define MPROFILE_CLASS_DELETE   2 /* 'C', deletion of the last character */
+#define MPROFILE_CLASSES        3
+
+#define MPROFILE_CLASS_OF(key) \
+	(('=' == (key)) ? MPROFILE_CLASS_EVALUATE : (('C' == (key)) ? MPROFILE_CLASS_DELETE : MPROFILE_CLASS_ECHO))
+
+#define MPROFILE_CLASS_NAMES { "Echo", "Equals", "Delete" }
+
+/************************************************************************************
+ * Description: Stages of the pipeline. Every latency is measured from the first scan
+ *              that saw the key pressed.
+ ************************************************************************************/
+#define MPROFILE_STAGE_ACCEPTED  0 /* The debounce accepted the press */
+#define MPROFILE_STAGE_CONSUMED  1 /* The main loop took the event */
+#define MPROFILE_STAGE_EVALUATED 2 /* The calculator is done with the key */
+#define MPROFILE_STAGE_DISPLAYED 3 /* The last LCD byte the key caused was written */
+#define MPROFILE_STAGES          4
+
+/************************************************************************************
+ * Description: Upper bounds of the histogram buckets in microseconds. Percentiles are
+ *              reported as the bound of the bucket they fall in, the last bucket
+ *              holds everything above the previous bound. The buckets are finest
+ *              just above the 4 to 5 ms the debounce of the keypad takes. Each
+ *              histogram takes two bytes per bucket, for every stage of every kind
+ *              of key.
+ ************************************************************************************/
+#define MPROFILE_LATENCY_BUCKETS 16
+
+#define MPROFILE_LATENCY_BOUNDS \
+{ \
+	1000, 2000, 3000, 4000, 4100, 4200, 4400, 4600, \
+	4800, 5000, 5500, 6000, 8000, 12000, 20000, 0xFFFF \
+}
+
+/************************************************************************************
+ * Description: Presses accepted by the keypad and not yet taken by the main loop.
+ *              Must be a power of two no smaller than HKPD_EVENT_QUEUE_SIZE, so it
+ *              cannot fill up before the keypad event queue does.
+ * Default: 16
+ ************************************************************************************/
+#define MPROFILE_LATENCY_QUEUE_SIZE 16
+
+/************************************************************************************
+ * Description: Presses taken by the main loop whose LCD writes are still queued.
+ *              Must be a power of two. A press arriving while it is full is not
+ *              measured.
+ * Default: 4
+ ************************************************************************************/
+#define MPROFILE_LATENCY_PENDING_SIZE 4
+
+/* Number of keys the scan can tell apart */
+#define MPROFILE_LATENCY_SOURCES 16
+
+#endif /* _MPROFILE_CFG_H_ */
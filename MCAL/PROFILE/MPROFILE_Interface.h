@@ -0,0 +1,226 @@
+/******************************************************************************
+ *
+ * Module: MPROFILE (MCAL Cycle Profiler)
+ *
+ * File Name: MPROFILE_Interface.h
+ *
+ * Description: Header file for the MPROFILE module. Regions of code are marked
+ *              with MPROFILE_ENTER and MPROFILE_EXIT, and the profiler keeps
+ *              the number of calls, the total and the longest duration of each
+ *              in CPU cycles. Key presses are timestamped at each stage of the
+ *              pipeline into latency histograms. Everything compiles out unless
+ *              MPROFILE_ENABLE or MPROFILE_LATENCY is set.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _MPROFILE_INTERFACE_H_
+#define _MPROFILE_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../BACKEND/MBACKEND_Interface.h"
+#include "MPROFILE_CFG.h"
+
+/* Both features count cycles on the same clock */
+#if MPROFILE_ENABLE == 1 || MPROFILE_LATENCY == 1
+#define MPROFILE_ACTIVE 1
+#else
+#define MPROFILE_ACTIVE 0
+#endif
+
+#if MPROFILE_ACTIVE == 1
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDInitialization
+ * Description: Starts the cycle counter, measures the cost of an empty region so
+ *              it can be left out of the results, and clears every record and
+ *              histogram. Interrupts are enabled on the target so Timer 1 overflows
+ *              are counted.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDInitialization(void);
+#endif
+
+#if MPROFILE_ENABLE == 1
+
+/************************************************************************************
+ * Description: What the profiler knows about a region. Cycles spent in interrupts
+ *              taken inside the region are counted with it.
+ ************************************************************************************/
+typedef struct
+{
+	u32 Calls;       /* Completed calls */
+	u32 TotalCycles; /* Sum of the durations, stops at 0xFFFFFFFF */
+	u32 MaxCycles;   /* Longest duration */
+} MPROFILE_RecordType;
+
+/************************************************************************************
+ * Macro Name: MPROFILE_ENTER / MPROFILE_EXIT
+ * Description: Mark the start and the end of a region, every path out of the region
+ *              must go through MPROFILE_EXIT. A region must not be entered again
+ *              before it is left, and each region is used either from interrupts or
+ *              from the main loop, not both.
+ * Parameters:
+ *      - region: One of the regions of MPROFILE_CFG.h
+ ************************************************************************************/
+#define MPROFILE_ENTER(region) MPROFILE_VOIDEnter(region)
+#define MPROFILE_EXIT(region)  MPROFILE_VOIDExit(region)
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDEnter
+ * Description: Notes the cycle count at the start of a region, see MPROFILE_ENTER.
+ * Parameters:
+ *      - Copy_U8Region: The region entered
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDEnter(u8 Copy_U8Region);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDExit
+ * Description: Adds the duration since MPROFILE_VOIDEnter to the record of a
+ *              region, see MPROFILE_EXIT.
+ * Parameters:
+ *      - Copy_U8Region: The region left
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDExit(u8 Copy_U8Region);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDGetRecord
+ * Description: Copies the record of a region, consistent even when the region
+ *              runs from an interrupt.
+ * Parameters:
+ *      - Copy_U8Region: The region to read
+ *      - Copy_PStrRecord: Receives the record
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDGetRecord(u8 Copy_U8Region, MPROFILE_RecordType *Copy_PStrRecord);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDGetName
+ * Description: Copies the name of a region from program memory.
+ * Parameters:
+ *      - Copy_U8Region: The region
+ *      - Copy_PU8Name: Receives the name, MPROFILE_NAME_SIZE bytes with the null
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDGetName(u8 Copy_U8Region, u8 *Copy_PU8Name);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDClear
+ * Description: Clears every record, regions in progress are still completed.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDClear(void);
+
+#else
+
+#define MPROFILE_ENTER(region) ((void)0)
+#define MPROFILE_EXIT(region)  ((void)0)
+
+#endif
+
+#if MPROFILE_LATENCY == 1
+
+/************************************************************************************
+ * Macro Name: MPROFILE_LATENCY_DETECT / MPROFILE_LATENCY_ACCEPT
+ * Description: Timestamp a key in the keypad scan: DETECT when a scan first reads it
+ *              pressed, ACCEPT when its press event is queued. A key detected again
+ *              before it is accepted, after a bounce, keeps the later time. A press
+ *              accepted without a detection, an auto-repeat, starts at ACCEPT.
+ * Parameters:
+ *      - source: Index of the key, below MPROFILE_LATENCY_SOURCES
+ ************************************************************************************/
+#define MPROFILE_LATENCY_DETECT(source) MPROFILE_VOIDLatencyDetect(source)
+#define MPROFILE_LATENCY_ACCEPT(source) MPROFILE_VOIDLatencyAccept(source)
+
+/************************************************************************************
+ * Macro Name: MPROFILE_LATENCY_CONSUME / MPROFILE_LATENCY_EVALUATED /
+ *             MPROFILE_LATENCY_FLUSHED
+ * Description: Timestamp a press in the main loop: CONSUME when its event is taken,
+ *              once per press event and in the same order, EVALUATED when the
+ *              calculator is done with it and FLUSHED once its LCD writes are
+ *              queued. The press is complete when the last of these writes reaches
+ *              the LCD. A press not flushed before the next one is consumed is not
+ *              measured.
+ * Parameters:
+ *      - key: The key taken, selects the histograms with MPROFILE_CLASS_OF
+ ************************************************************************************/
+#define MPROFILE_LATENCY_CONSUME(key) MPROFILE_VOIDLatencyConsume(key)
+#define MPROFILE_LATENCY_EVALUATED()  MPROFILE_VOIDLatencyEvaluated()
+#define MPROFILE_LATENCY_FLUSHED()    MPROFILE_VOIDLatencyFlushed()
+
+/************************************************************************************
+ * Macro Name: MPROFILE_LATENCY_ENQUEUED / MPROFILE_LATENCY_WRITTEN
+ * Description: Follow the LCD write queue: ENQUEUED when the producer adds a
+ *              transaction, WRITTEN when the queue interrupt has sent one. Not needed
+ *              when the LCD is written synchronously.
+ ************************************************************************************/
+#define MPROFILE_LATENCY_ENQUEUED() MPROFILE_VOIDLatencyEnqueued()
+#define MPROFILE_LATENCY_WRITTEN()  MPROFILE_VOIDLatencyWritten()
+
+/* Functions behind the macros above */
+void MPROFILE_VOIDLatencyDetect(u8 Copy_U8Source);
+void MPROFILE_VOIDLatencyAccept(u8 Copy_U8Source);
+void MPROFILE_VOIDLatencyConsume(u8 Copy_U8Key);
+void MPROFILE_VOIDLatencyEvaluated(void);
+void MPROFILE_VOIDLatencyFlushed(void);
+void MPROFILE_VOIDLatencyEnqueued(void);
+void MPROFILE_VOIDLatencyWritten(void);
+
+/************************************************************************************
+ * Function Name: MPROFILE_U16LatencyCount
+ * Description: Returns the number of complete presses of a kind.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ * Return:
+ *      - u16: Presses measured, saturating at 65535
+ ************************************************************************************/
+u16 MPROFILE_U16LatencyCount(u8 Copy_U8Class);
+
+/************************************************************************************
+ * Function Name: MPROFILE_U16LatencyPercentile
+ * Description: Returns a percentile of the latency of a stage for a kind of press.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ *      - Copy_U8Stage: One of the MPROFILE_STAGE_ values
+ *      - Copy_U8Percent: The percentile, 1 to 100
+ * Return:
+ *      - u16: Upper bound in microseconds of the bucket holding the percentile, 0 if
+ *             nothing was measured, 0xFFFF above the last finite bound
+ ************************************************************************************/
+u16 MPROFILE_U16LatencyPercentile(u8 Copy_U8Class, u8 Copy_U8Stage, u8 Copy_U8Percent);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyGetName
+ * Description: Copies the name of a kind of press from program memory.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ *      - Copy_PU8Name: Receives the name, MPROFILE_NAME_SIZE bytes with the null
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyGetName(u8 Copy_U8Class, u8 *Copy_PU8Name);
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyClear
+ * Description: Empties every histogram, presses in flight are still measured.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyClear(void);
+
+#else
+
+#define MPROFILE_LATENCY_DETECT(source) ((void)0)
+#define MPROFILE_LATENCY_ACCEPT(source) ((void)0)
+#define MPROFILE_LATENCY_CONSUME(key)   ((void)0)
+#define MPROFILE_LATENCY_EVALUATED()    ((void)0)
+#define MPROFILE_LATENCY_FLUSHED()      ((void)0)
+#define MPROFILE_LATENCY_ENQUEUED()     ((void)0)
+#define MPROFILE_LATENCY_WRITTEN()      ((void)0)
+
+#endif
+
+#endif /* _MPROFILE_INTERFACE_H_ */
@@ -0,0 +1,31 @@
+/******************************************************************************
+ *
+ * Module: MPROFILE (MCAL Cycle Profiler)
+ *
+ * File Name: MPROFILE_Private.h
+ *
+ * Description: Private header file for the MPROFILE module
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MPROFILE_PRIVATE_H_
+#define _MPROFILE_PRIVATE_H_
+
+/* Status Register and its global interrupt enable flag */
+#define MPROFILE_SREG_REG MBACKEND_REG(0x5F)
+#define MPROFILE_SREG_I   7
+
+/* Timer/Counter Interrupt Mask and Flag Registers, shared by all timers */
+#define MPROFILE_TIMSK_REG MBACKEND_REG(0x59)
+#define MPROFILE_TIFR_REG  MBACKEND_REG(0x58)
+
+/* TIMSK and TIFR bits of the Timer 1 overflow */
+#define MPROFILE_TIMSK_TOIE1 2
+#define MPROFILE_TIFR_TOV1   2
+
+/* Timer 1 Overflow interrupt vector */
+#define MPROFILE_TIMER1_OVF_VECTOR __vector_9
+
+#endif /* _MPROFILE_PRIVATE_H_ */
@@ -0,0 +1,594 @@
+/******************************************************************************
+ *
+ * Module: MPROFILE (MCAL Cycle Profiler)
+ *
+ * File Name: MPROFILE_Program.c
+ *
+ * Description: Source file for the MPROFILE module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "MPROFILE_Interface.h"
+
+#if MPROFILE_ACTIVE == 1
+
+#include "../../LIB/FLASH_MEM.h"
+#include "../GIE/MGIE_Interface.h"
+#include "MPROFILE_Private.h"
+
+#if MPROFILE_ENABLE == 1
+/* Region names, kept in program memory */
+static FLASH_CONST u8 MPROFILE_AU8Names[MPROFILE_REGIONS][MPROFILE_NAME_SIZE] = MPROFILE_REGION_NAMES;
+
+/* Records of the regions and the cycle count at which each was last entered */
+static MPROFILE_RecordType MPROFILE_AStrRecords[MPROFILE_REGIONS];
+static u32 MPROFILE_AU32Start[MPROFILE_REGIONS];
+
+/* Cycles an empty region measures, taken off every duration */
+static u32 MPROFILE_U32Overhead;
+#endif
+
+#if MPROFILE_LATENCY == 1
+/************************************************************************************
+ * Description: Timestamps of a press, in cycles. Stamp is indexed by MPROFILE_STAGE_
+ *              and Ticket is the number of LCD transactions queued when the press
+ *              was flushed.
+ ************************************************************************************/
+typedef struct
+{
+	u32 Detect;
+	u32 Stamp[MPROFILE_STAGES];
+	u16 Ticket;
+	u8 Class;
+} MPROFILE_LatencyType;
+
+/* Class names and bucket bounds, kept in program memory */
+static FLASH_CONST u8 MPROFILE_AU8ClassNames[MPROFILE_CLASSES][MPROFILE_NAME_SIZE] = MPROFILE_CLASS_NAMES;
+static FLASH_CONST u16 MPROFILE_AU16Bounds[MPROFILE_LATENCY_BUCKETS] = MPROFILE_LATENCY_BOUNDS;
+
+/* Histograms of every stage of every class */
+static u16 MPROFILE_AU16Histogram[MPROFILE_CLASSES][MPROFILE_STAGES][MPROFILE_LATENCY_BUCKETS];
+
+/* Last detection of each key, a bit of MPROFILE_U16DetectValid tells it is pending */
+static u32 MPROFILE_AU32Detect[MPROFILE_LATENCY_SOURCES];
+static u16 MPROFILE_U16DetectValid;
+
+/* Presses accepted by the scan interrupt and not yet consumed, detection and acceptance */
+static u32 MPROFILE_AU32AcceptedDetect[MPROFILE_LATENCY_QUEUE_SIZE];
+static u32 MPROFILE_AU32AcceptedStamp[MPROFILE_LATENCY_QUEUE_SIZE];
+static volatile u8 MPROFILE_U8AcceptedHead, MPROFILE_U8AcceptedTail;
+
+/* Press being handled by the main loop */
+static MPROFILE_LatencyType MPROFILE_StrCurrent;
+static u8 MPROFILE_U8CurrentValid;
+
+/* Presses waiting for their last LCD write, and the LCD transactions queued and sent */
+static MPROFILE_LatencyType MPROFILE_AStrPending[MPROFILE_LATENCY_PENDING_SIZE];
+static u8 MPROFILE_U8PendingHead, MPROFILE_U8PendingTail;
+static u16 MPROFILE_U16Enqueued, MPROFILE_U16Written;
+#endif
+
+#if defined(__AVR__)
+/* Timer 1 overflows, the upper half of the 32-bit cycle count */
+static volatile u16 MPROFILE_U16Overflows;
+
+/************************************************************************************
+ * Function Name: __vector_9
+ * Description: Timer 1 overflow interrupt service routine, extends the count
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_TIMER1_OVF_VECTOR(void) MBACKEND_ISR_ATTRIBUTE;
+void MPROFILE_TIMER1_OVF_VECTOR(void)
+{
+	MPROFILE_U16Overflows++;
+}
+#endif
+
+/************************************************************************************
+ * Function Name: MPROFILE_U32Now
+ * Description: Reads the cycle counter. On the target Timer 1 is extended to 32 bits
+ *              with its overflows, an overflow still pending while interrupts are
+ *              held off is accounted for when the timer has already wrapped.
+ * Parameters: None
+ * Return: CPU cycles modulo 2^32
+ ************************************************************************************/
+static u32 MPROFILE_U32Now(void)
+{
+#if defined(__AVR__)
+	u8 LOC_U8Status;
+	u16 LOC_U16Low, LOC_U16High;
+
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	LOC_U16Low = (u16)MBACKEND_U32GetCycles();
+	LOC_U16High = MPROFILE_U16Overflows;
+	if (GET_BIT(MPROFILE_TIFR_REG, MPROFILE_TIFR_TOV1) && LOC_U16Low < 0x8000)
+	{
+		LOC_U16High++;
+	}
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+
+	return ((u32)LOC_U16High << 16) | LOC_U16Low;
+#else
+	return MBACKEND_U32GetCycles();
+#endif
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDInitialization
+ * Description: Starts the cycle counter, measures the cost of an empty region so
+ *              it can be left out of the results, and clears every record and
+ *              histogram. Interrupts are enabled on the target so Timer 1 overflows
+ *              are counted.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDInitialization(void)
+{
+#if MPROFILE_ENABLE == 1
+	u8 LOC_U8Status;
+#endif
+
+	MBACKEND_VOIDStartCycleCounter();
+#if defined(__AVR__)
+	SET_BIT(MPROFILE_TIMSK_REG, MPROFILE_TIMSK_TOIE1);
+#endif
+
+#if MPROFILE_ENABLE == 1
+	/* Nothing may interrupt the empty region */
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	MPROFILE_U32Overhead = 0;
+	MPROFILE_AStrRecords[0].TotalCycles = 0;
+	MPROFILE_VOIDEnter(0);
+	MPROFILE_VOIDExit(0);
+	MPROFILE_U32Overhead = MPROFILE_AStrRecords[0].TotalCycles;
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+
+	MPROFILE_VOIDClear();
+#endif
+
+#if MPROFILE_LATENCY == 1
+	MPROFILE_VOIDLatencyClear();
+#endif
+
+	MGIE_VOIDEnable();
+}
+
+#if MPROFILE_ENABLE == 1
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDEnter
+ * Description: Notes the cycle count at the start of a region, see MPROFILE_ENTER.
+ * Parameters:
+ *      - Copy_U8Region: The region entered
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDEnter(u8 Copy_U8Region)
+{
+	/* Read last so the call itself is not counted */
+	MPROFILE_AU32Start[Copy_U8Region] = MPROFILE_U32Now();
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDExit
+ * Description: Adds the duration since MPROFILE_VOIDEnter to the record of a
+ *              region, see MPROFILE_EXIT.
+ * Parameters:
+ *      - Copy_U8Region: The region left
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDExit(u8 Copy_U8Region)
+{
+	u32 LOC_U32Cycles = MPROFILE_U32Now() - MPROFILE_AU32Start[Copy_U8Region];
+	MPROFILE_RecordType *LOC_PStrRecord = &MPROFILE_AStrRecords[Copy_U8Region];
+
+	LOC_U32Cycles = (LOC_U32Cycles > MPROFILE_U32Overhead) ? LOC_U32Cycles - MPROFILE_U32Overhead : 0;
+
+	LOC_PStrRecord->Calls++;
+	if (LOC_PStrRecord->TotalCycles + LOC_U32Cycles >= LOC_PStrRecord->TotalCycles)
+	{
+		LOC_PStrRecord->TotalCycles += LOC_U32Cycles;
+	}
+	else
+	{
+		LOC_PStrRecord->TotalCycles = 0xFFFFFFFF;
+	}
+	if (LOC_U32Cycles > LOC_PStrRecord->MaxCycles)
+	{
+		LOC_PStrRecord->MaxCycles = LOC_U32Cycles;
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDGetRecord
+ * Description: Copies the record of a region, consistent even when the region
+ *              runs from an interrupt.
+ * Parameters:
+ *      - Copy_U8Region: The region to read
+ *      - Copy_PStrRecord: Receives the record
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDGetRecord(u8 Copy_U8Region, MPROFILE_RecordType *Copy_PStrRecord)
+{
+	u8 LOC_U8Status;
+
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	*Copy_PStrRecord = MPROFILE_AStrRecords[Copy_U8Region];
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDGetName
+ * Description: Copies the name of a region from program memory.
+ * Parameters:
+ *      - Copy_U8Region: The region
+ *      - Copy_PU8Name: Receives the name, MPROFILE_NAME_SIZE bytes with the null
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDGetName(u8 Copy_U8Region, u8 *Copy_PU8Name)
+{
+	u8 LOC_U8Index;
+
+	for (LOC_U8Index = 0; LOC_U8Index < MPROFILE_NAME_SIZE; LOC_U8Index++)
+	{
+		Copy_PU8Name[LOC_U8Index] = FLASH_READ_U8(&MPROFILE_AU8Names[Copy_U8Region][LOC_U8Index]);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDClear
+ * Description: Clears every record, regions in progress are still completed.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDClear(void)
+{
+	u8 LOC_U8Status, LOC_U8Region;
+
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	for (LOC_U8Region = 0; LOC_U8Region < MPROFILE_REGIONS; LOC_U8Region++)
+	{
+		MPROFILE_AStrRecords[LOC_U8Region].Calls = 0;
+		MPROFILE_AStrRecords[LOC_U8Region].TotalCycles = 0;
+		MPROFILE_AStrRecords[LOC_U8Region].MaxCycles = 0;
+	}
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+}
+#endif
+
+#if MPROFILE_LATENCY == 1
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyRecord
+ * Description: Adds a complete press to the histograms of its class. Must run with
+ *              interrupts held off or from an interrupt.
+ * Parameters:
+ *      - Copy_PStrPress: The press, every stage stamped
+ * Return: None
+ ************************************************************************************/
+static void MPROFILE_VOIDLatencyRecord(const MPROFILE_LatencyType *Copy_PStrPress)
+{
+	u8 LOC_U8Stage, LOC_U8Bucket;
+	u32 LOC_U32Microseconds;
+	u16 *LOC_PU16Count;
+
+	for (LOC_U8Stage = 0; LOC_U8Stage < MPROFILE_STAGES; LOC_U8Stage++)
+	{
+		/* A constant power of two at the usual clocks, so no division is made */
+		LOC_U32Microseconds = (Copy_PStrPress->Stamp[LOC_U8Stage] - Copy_PStrPress->Detect) / (F_CPU / 1000000UL);
+
+		LOC_U8Bucket = 0;
+		while (LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS - 1
+		       && LOC_U32Microseconds >= FLASH_READ_U16(&MPROFILE_AU16Bounds[LOC_U8Bucket]))
+		{
+			LOC_U8Bucket++;
+		}
+
+		LOC_PU16Count = &MPROFILE_AU16Histogram[Copy_PStrPress->Class][LOC_U8Stage][LOC_U8Bucket];
+		if (*LOC_PU16Count != 0xFFFF)
+		{
+			(*LOC_PU16Count)++;
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyDetect
+ * Description: A scan read the key pressed for the first time, see
+ *              MPROFILE_LATENCY_DETECT.
+ * Parameters:
+ *      - Copy_U8Source: Index of the key
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyDetect(u8 Copy_U8Source)
+{
+	MPROFILE_AU32Detect[Copy_U8Source] = MPROFILE_U32Now();
+	SET_BIT(MPROFILE_U16DetectValid, Copy_U8Source);
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyAccept
+ * Description: The press event of the key was queued, see MPROFILE_LATENCY_ACCEPT.
+ * Parameters:
+ *      - Copy_U8Source: Index of the key
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyAccept(u8 Copy_U8Source)
+{
+	u8 LOC_U8Head = MPROFILE_U8AcceptedHead;
+	u8 LOC_U8Next = (LOC_U8Head + 1) & (MPROFILE_LATENCY_QUEUE_SIZE - 1);
+	u32 LOC_U32Now = MPROFILE_U32Now();
+
+	if (LOC_U8Next != MPROFILE_U8AcceptedTail)
+	{
+		MPROFILE_AU32AcceptedDetect[LOC_U8Head] = GET_BIT(MPROFILE_U16DetectValid, Copy_U8Source)
+		                                          ? MPROFILE_AU32Detect[Copy_U8Source] : LOC_U32Now;
+		MPROFILE_AU32AcceptedStamp[LOC_U8Head] = LOC_U32Now;
+		MPROFILE_U8AcceptedHead = LOC_U8Next;
+	}
+	CLR_BIT(MPROFILE_U16DetectValid, Copy_U8Source);
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyConsume
+ * Description: The main loop took the next press event, see
+ *              MPROFILE_LATENCY_CONSUME. A press the scan did not stamp, e.g. with
+ *              a polled keypad, starts here.
+ * Parameters:
+ *      - Copy_U8Key: The key taken
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyConsume(u8 Copy_U8Key)
+{
+	u8 LOC_U8Tail = MPROFILE_U8AcceptedTail;
+	u32 LOC_U32Now = MPROFILE_U32Now();
+
+	MPROFILE_StrCurrent.Class = MPROFILE_CLASS_OF(Copy_U8Key);
+	MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_CONSUMED] = LOC_U32Now;
+	MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_EVALUATED] = LOC_U32Now;
+
+	if (LOC_U8Tail != MPROFILE_U8AcceptedHead)
+	{
+		MPROFILE_StrCurrent.Detect = MPROFILE_AU32AcceptedDetect[LOC_U8Tail];
+		MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_ACCEPTED] = MPROFILE_AU32AcceptedStamp[LOC_U8Tail];
+		MPROFILE_U8AcceptedTail = (LOC_U8Tail + 1) & (MPROFILE_LATENCY_QUEUE_SIZE - 1);
+	}
+	else
+	{
+		MPROFILE_StrCurrent.Detect = LOC_U32Now;
+		MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_ACCEPTED] = LOC_U32Now;
+	}
+
+	MPROFILE_U8CurrentValid = 1;
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyEvaluated
+ * Description: The calculator is done with the current press, see
+ *              MPROFILE_LATENCY_EVALUATED.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyEvaluated(void)
+{
+	MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_EVALUATED] = MPROFILE_U32Now();
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyFlushed
+ * Description: The LCD writes of the current press are queued, see
+ *              MPROFILE_LATENCY_FLUSHED. The press is complete right away when none
+ *              of them is still waiting in the queue.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyFlushed(void)
+{
+	u8 LOC_U8Status, LOC_U8Next;
+
+	if (MPROFILE_U8CurrentValid)
+	{
+		MPROFILE_U8CurrentValid = 0;
+		MPROFILE_StrCurrent.Ticket = MPROFILE_U16Enqueued;
+
+		/* The queue interrupt completes pending presses */
+		LOC_U8Status = MPROFILE_SREG_REG;
+		CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+		if ((s16)(MPROFILE_StrCurrent.Ticket - MPROFILE_U16Written) <= 0)
+		{
+			MPROFILE_StrCurrent.Stamp[MPROFILE_STAGE_DISPLAYED] = MPROFILE_U32Now();
+			MPROFILE_VOIDLatencyRecord(&MPROFILE_StrCurrent);
+		}
+		else
+		{
+			LOC_U8Next = (MPROFILE_U8PendingHead + 1) & (MPROFILE_LATENCY_PENDING_SIZE - 1);
+			if (LOC_U8Next != MPROFILE_U8PendingTail)
+			{
+				MPROFILE_AStrPending[MPROFILE_U8PendingHead] = MPROFILE_StrCurrent;
+				MPROFILE_U8PendingHead = LOC_U8Next;
+			}
+		}
+
+		MPROFILE_SREG_REG = LOC_U8Status;
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyEnqueued
+ * Description: An LCD transaction was queued, see MPROFILE_LATENCY_ENQUEUED.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyEnqueued(void)
+{
+	MPROFILE_U16Enqueued++;
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyWritten
+ * Description: An LCD transaction was sent, see MPROFILE_LATENCY_WRITTEN. Completes
+ *              the presses whose last write it was.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyWritten(void)
+{
+	MPROFILE_LatencyType *LOC_PStrPress;
+
+	MPROFILE_U16Written++;
+
+	while (MPROFILE_U8PendingTail != MPROFILE_U8PendingHead)
+	{
+		LOC_PStrPress = &MPROFILE_AStrPending[MPROFILE_U8PendingTail];
+		if ((s16)(LOC_PStrPress->Ticket - MPROFILE_U16Written) > 0)
+		{
+			break;
+		}
+		LOC_PStrPress->Stamp[MPROFILE_STAGE_DISPLAYED] = MPROFILE_U32Now();
+		MPROFILE_VOIDLatencyRecord(LOC_PStrPress);
+		MPROFILE_U8PendingTail = (MPROFILE_U8PendingTail + 1) & (MPROFILE_LATENCY_PENDING_SIZE - 1);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_U16LatencyCount
+ * Description: Returns the number of complete presses of a kind.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ * Return:
+ *      - u16: Presses measured, saturating at 65535
+ ************************************************************************************/
+u16 MPROFILE_U16LatencyCount(u8 Copy_U8Class)
+{
+	u8 LOC_U8Status, LOC_U8Bucket;
+	u32 LOC_U32Count = 0;
+
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	for (LOC_U8Bucket = 0; LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS; LOC_U8Bucket++)
+	{
+		LOC_U32Count += MPROFILE_AU16Histogram[Copy_U8Class][MPROFILE_STAGE_DISPLAYED][LOC_U8Bucket];
+	}
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+
+	return (LOC_U32Count > 0xFFFF) ? 0xFFFF : (u16)LOC_U32Count;
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_U16LatencyPercentile
+ * Description: Returns a percentile of the latency of a stage for a kind of press.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ *      - Copy_U8Stage: One of the MPROFILE_STAGE_ values
+ *      - Copy_U8Percent: The percentile, 1 to 100
+ * Return:
+ *      - u16: Upper bound in microseconds of the bucket holding the percentile, 0 if
+ *             nothing was measured, 0xFFFF above the last finite bound
+ ************************************************************************************/
+u16 MPROFILE_U16LatencyPercentile(u8 Copy_U8Class, u8 Copy_U8Stage, u8 Copy_U8Percent)
+{
+	u16 LOC_AU16Counts[MPROFILE_LATENCY_BUCKETS];
+	u32 LOC_U32Total = 0, LOC_U32Rank, LOC_U32Seen = 0;
+	u16 LOC_U16Bound = 0;
+	u8 LOC_U8Status, LOC_U8Bucket;
+
+	/* Take a consistent copy, the queue interrupt may be adding to it */
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+	for (LOC_U8Bucket = 0; LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS; LOC_U8Bucket++)
+	{
+		LOC_AU16Counts[LOC_U8Bucket] = MPROFILE_AU16Histogram[Copy_U8Class][Copy_U8Stage][LOC_U8Bucket];
+	}
+	MPROFILE_SREG_REG = LOC_U8Status;
+
+	for (LOC_U8Bucket = 0; LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS; LOC_U8Bucket++)
+	{
+		LOC_U32Total += LOC_AU16Counts[LOC_U8Bucket];
+	}
+
+	if (LOC_U32Total)
+	{
+		/* Nearest rank: the smallest sample with at least Percent % of them at or below it */
+		LOC_U32Rank = (LOC_U32Total * Copy_U8Percent + 99) / 100;
+		if (0 == LOC_U32Rank)
+		{
+			LOC_U32Rank = 1;
+		}
+
+		for (LOC_U8Bucket = 0; LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS; LOC_U8Bucket++)
+		{
+			LOC_U32Seen += LOC_AU16Counts[LOC_U8Bucket];
+			if (LOC_U32Seen >= LOC_U32Rank)
+			{
+				LOC_U16Bound = FLASH_READ_U16(&MPROFILE_AU16Bounds[LOC_U8Bucket]);
+				break;
+			}
+		}
+	}
+
+	return LOC_U16Bound;
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyGetName
+ * Description: Copies the name of a kind of press from program memory.
+ * Parameters:
+ *      - Copy_U8Class: One of the MPROFILE_CLASS_ values
+ *      - Copy_PU8Name: Receives the name, MPROFILE_NAME_SIZE bytes with the null
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyGetName(u8 Copy_U8Class, u8 *Copy_PU8Name)
+{
+	u8 LOC_U8Index;
+
+	for (LOC_U8Index = 0; LOC_U8Index < MPROFILE_NAME_SIZE; LOC_U8Index++)
+	{
+		Copy_PU8Name[LOC_U8Index] = FLASH_READ_U8(&MPROFILE_AU8ClassNames[Copy_U8Class][LOC_U8Index]);
+	}
+}
+
+/************************************************************************************
+ * Function Name: MPROFILE_VOIDLatencyClear
+ * Description: Empties every histogram, presses in flight are still measured.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MPROFILE_VOIDLatencyClear(void)
+{
+	u8 LOC_U8Status, LOC_U8Class, LOC_U8Stage, LOC_U8Bucket;
+
+	LOC_U8Status = MPROFILE_SREG_REG;
+	CLR_BIT(MPROFILE_SREG_REG, MPROFILE_SREG_I);
+
+	for (LOC_U8Class = 0; LOC_U8Class < MPROFILE_CLASSES; LOC_U8Class++)
+	{
+		for (LOC_U8Stage = 0; LOC_U8Stage < MPROFILE_STAGES; LOC_U8Stage++)
+		{
+			for (LOC_U8Bucket = 0; LOC_U8Bucket < MPROFILE_LATENCY_BUCKETS; LOC_U8Bucket++)
+			{
+				MPROFILE_AU16Histogram[LOC_U8Class][LOC_U8Stage][LOC_U8Bucket] = 0;
+			}
+		}
+	}
+
+	MPROFILE_SREG_REG = LOC_U8Status;
+}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Module: MSTACK (MCAL Stack Monitor)
+ *
+ * File Name: MSTACK_CFG.h
+ *
+ * Description: Configuration file for the MSTACK module to enable the stack
+ *              painting and choose the paint value.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MSTACK_CFG_H_
+#define _MSTACK_CFG_H_
+
+/************************************************************************************
+ * Description: Paint the free SRAM at reset so the deepest point the stack has reached
+ *              can be read back with MSTACK_U16GetHighWater. The paint loop of
+ *              .init1 takes six cycles per byte before main, about 12300 cycles on
+ *              the 2 KB of the ATmega32: 1.5 ms at 8 MHz, 12 ms at the 1 MHz factory
+ *              clock. It uses no SRAM, and the query is only linked when called.
+ *              Only the profile chord of main shows the result, so enable it
+ *              together with MPROFILE_ENABLE. May be set from the command line.
+ * Default: 0
+ * Options:
+ *      - 0: Disabled
+ *      - 1: Enabled
+ ************************************************************************************/
+#ifndef MSTACK_ENABLE
+#define MSTACK_ENABLE 0
+#endif
+
+/************************************************************************************
+ * Description: Value painted on the free SRAM. A stack byte that happens to hold it
+ *              at the deepest point is not seen as used, so the high water can read
+ *              a few bytes low. Avoid 0x00 and 0xFF, which stack frames hold often.
+ * Default: 0xC5
+ ************************************************************************************/
+#define MSTACK_CANARY 0xC5
+
+#endif /* _MSTACK_CFG_H_ */
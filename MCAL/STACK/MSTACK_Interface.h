@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ * Module: MSTACK (MCAL Stack Monitor)
+ *
+ * File Name: MSTACK_Interface.h
+ *
+ * Description: Header file for the MSTACK module. The SRAM between the end of
+ *              .bss and the top of the stack is painted at reset, before main
+ *              runs, and the stack high-water mark is found later as the
+ *              lowest byte that lost its paint.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _MSTACK_INTERFACE_H_
+#define _MSTACK_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "MSTACK_CFG.h"
+
+#if MSTACK_ENABLE == 1
+/************************************************************************************
+ * Function Name: MSTACK_U16GetSize
+ * Description: Returns the SRAM the stack can grow into, from the end of .bss and
+ *              .noinit to the last SRAM byte. Nothing allocates from the heap in
+ *              this project, so all of it belongs to the stack. Returns 0 on the
+ *              host, where no SRAM is painted.
+ * Parameters: None
+ * Return:
+ *      - u16: Size of the stack area in bytes.
+ ************************************************************************************/
+u16 MSTACK_U16GetSize(void);
+
+/************************************************************************************
+ * Function Name: MSTACK_U16GetHighWater
+ * Description: Returns the deepest the stack has been since reset, interrupts
+ *              included. Scans the painted area from its bottom, so it takes about
+ *              five cycles per byte never used. Returns 0 on the host.
+ * Parameters: None
+ * Return:
+ *      - u16: Stack used at its deepest, in bytes. MSTACK_U16GetSize minus this is
+ *             the margin left before the stack runs into .bss.
+ ************************************************************************************/
+u16 MSTACK_U16GetHighWater(void);
+#endif
+
+#endif /* _MSTACK_INTERFACE_H_ */
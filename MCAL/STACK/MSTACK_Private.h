@@ -0,0 +1,24 @@
+/******************************************************************************
+ *
+ * Module: MSTACK (MCAL Stack Monitor)
+ *
+ * File Name: MSTACK_Private.h
+ *
+ * Description: Private header file for the MSTACK module
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MSTACK_PRIVATE_H_
+#define _MSTACK_PRIVATE_H_
+
+/* Symbols of the avr-libc linker script: the first byte after .bss and .noinit,
+ * where the heap would start, and the last SRAM byte, where the stack starts */
+extern u8 __heap_start;
+extern u8 __stack;
+
+#define MSTACK_BOTTOM (&__heap_start)
+#define MSTACK_TOP    (&__stack)
+
+#endif /* _MSTACK_PRIVATE_H_ */
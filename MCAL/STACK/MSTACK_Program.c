@@ -0,0 +1,94 @@
+/******************************************************************************
+ *
+ * Module: MSTACK (MCAL Stack Monitor)
+ *
+ * File Name: MSTACK_Program.c
+ *
+ * Description: Source file for the MSTACK module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include "MSTACK_Interface.h"
+
+#if MSTACK_ENABLE == 1
+#if defined(__AVR__)
+
+#include "MSTACK_Private.h"
+
+/************************************************************************************
+ * Function Name: MSTACK_VOIDPaint
+ * Description: Fills MSTACK_BOTTOM to MSTACK_TOP with MSTACK_CANARY. Placed in
+ *              .init1 so the startup code runs it before the stack pointer is set
+ *              and before anything is pushed, it is never called. The stack is not
+ *              usable yet, so it is written in registers only, and .bss is left for
+ *              the startup code to clear.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+static void MSTACK_VOIDPaint(void) __attribute__((naked, used, section(".init1")));
+static void MSTACK_VOIDPaint(void)
+{
+	__asm__ __volatile__ (
+		"	ldi r30, lo8(__heap_start)\n"
+		"	ldi r31, hi8(__heap_start)\n"
+		"	ldi r24, %0\n"
+		"	ldi r25, hi8(__stack)\n"
+		"	rjmp 2f\n"
+		"1:	st Z+, r24\n"
+		"2:	cpi r30, lo8(__stack)\n"
+		"	cpc r31, r25\n"
+		"	brlo 1b\n"
+		"	breq 1b\n"
+		:
+		: "M" (MSTACK_CANARY));
+}
+
+/************************************************************************************
+ * Function Name: MSTACK_U16GetSize
+ * Description: Returns the SRAM the stack can grow into
+ * Parameters: None
+ * Return:
+ *      - u16: Size of the stack area in bytes
+ ************************************************************************************/
+u16 MSTACK_U16GetSize(void)
+{
+	return (u16)(MSTACK_TOP - MSTACK_BOTTOM) + 1;
+}
+
+/************************************************************************************
+ * Function Name: MSTACK_U16GetHighWater
+ * Description: Returns the deepest the stack has been since reset
+ * Parameters: None
+ * Return:
+ *      - u16: Stack used at its deepest, in bytes
+ ************************************************************************************/
+u16 MSTACK_U16GetHighWater(void)
+{
+	/* The stack grows down from MSTACK_TOP, the bytes it never reached keep their paint */
+	const volatile u8 *LOC_PU8Byte = MSTACK_BOTTOM;
+
+	while (LOC_PU8Byte <= MSTACK_TOP && MSTACK_CANARY == *LOC_PU8Byte)
+	{
+		LOC_PU8Byte++;
+	}
+
+	return (u16)(MSTACK_TOP - LOC_PU8Byte) + 1;
+}
+
+#else
+
+/* The host build runs on the stack of the host process, there is nothing to paint */
+u16 MSTACK_U16GetSize(void)
+{
+	return 0;
+}
+
+u16 MSTACK_U16GetHighWater(void)
+{
+	return 0;
+}
+
+#endif /* __AVR__ */
+#endif /* MSTACK_ENABLE */
@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * Module: MTIMER (MCAL Timers)
+ *
+ * File Name: MTIMER_CFG.h
+ *
+ * Description: Configuration file for the MTIMER module to select the clock
+ *              source of each timer.
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MTIMER_CFG_H_
+#define _MTIMER_CFG_H_
+
+/************************************************************************************
+ * Description: Clock select values of the Timer 0 and Timer 1 control registers.
+ ************************************************************************************/
+#define MTIMER_PRESCALER_1    1
+#define MTIMER_PRESCALER_8    2
+#define MTIMER_PRESCALER_64   3
+#define MTIMER_PRESCALER_256  4
+#define MTIMER_PRESCALER_1024 5
+
+/************************************************************************************
+ * Description: Clock prescaler of Timer 0. With the 8 MHz system clock a division
+ *              by 64 gives one count every 8 us.
+ * Default: MTIMER_PRESCALER_64
+ ************************************************************************************/
+#define MTIMER_TIMER0_PRESCALER MTIMER_PRESCALER_64
+
+/************************************************************************************
+ * Description: Clock select values of the Timer 2 control register, which has more
+ *              divisions than the other timers.
+ ************************************************************************************/
+#define MTIMER2_PRESCALER_1    1
+#define MTIMER2_PRESCALER_8    2
+#define MTIMER2_PRESCALER_32   3
+#define MTIMER2_PRESCALER_64   4
+#define MTIMER2_PRESCALER_128  5
+#define MTIMER2_PRESCALER_256  6
+#define MTIMER2_PRESCALER_1024 7
+
+/************************************************************************************
+ * Description: Clock prescaler of Timer 2. With the 8 MHz system clock a division
+ *              by 64 gives one count every 8 us.
+ * Default: MTIMER2_PRESCALER_64
+ ************************************************************************************/
+#define MTIMER_TIMER2_PRESCALER MTIMER2_PRESCALER_64
+
+#endif /* _MTIMER_CFG_H_ */
@@ -0,0 +1,100 @@
+/******************************************************************************
+ *
+ * Module: MTIMER (MCAL Timers)
+ *
+ * File Name: MTIMER_Interface.h
+ *
+ * Description: Header file for the MTIMER module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+#ifndef _MTIMER_INTERFACE_H_
+#define _MTIMER_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../BACKEND/MBACKEND_Interface.h"
+#include "MTIMER_Private.h"
+#include "MTIMER_CFG.h"
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0Init
+ * Description: Starts Timer 0 in Clear Timer on Compare mode with the configured
+ *              prescaler. The compare interrupt is left disabled.
+ * Parameters:
+ *      - Copy_U8CompareValue: Counts per period minus one (0 to 255)
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0Init(u8 Copy_U8CompareValue);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0Restart
+ * Description: Restarts the count of Timer 0 and clears a pending compare match, so
+ *              the next interrupt comes one full period from now
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0Restart(void);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0SetCallback
+ * Description: Sets the function called from the Timer 0 compare match interrupt
+ * Parameters:
+ *      - Copy_PtrCallback: The function to call, or NULL for none
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0SetCallback(void (*Copy_PtrCallback)(void));
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0EnableInterrupt
+ * Description: Enables the Timer 0 compare match interrupt
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0EnableInterrupt(void);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0DisableInterrupt
+ * Description: Disables the Timer 0 compare match interrupt, the timer keeps counting
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0DisableInterrupt(void);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2Init
+ * Description: Starts Timer 2 in Clear Timer on Compare mode with the configured
+ *              prescaler. The compare interrupt is left disabled.
+ * Parameters:
+ *      - Copy_U8CompareValue: Counts per period minus one (0 to 255)
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2Init(u8 Copy_U8CompareValue);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2SetCallback
+ * Description: Sets the function called from the Timer 2 compare match interrupt
+ * Parameters:
+ *      - Copy_PtrCallback: The function to call, or NULL for none
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2SetCallback(void (*Copy_PtrCallback)(void));
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2EnableInterrupt
+ * Description: Enables the Timer 2 compare match interrupt
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2EnableInterrupt(void);
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2DisableInterrupt
+ * Description: Disables the Timer 2 compare match interrupt, the timer keeps counting
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2DisableInterrupt(void);
+
+#endif
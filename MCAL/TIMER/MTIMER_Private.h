@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ * Module: MTIMER (MCAL Timers)
+ *
+ * File Name: MTIMER_Private.h
+ *
+ * Description: Private header file for the MTIMER module
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#ifndef _MTIMER_PRIVATE_H_
+#define _MTIMER_PRIVATE_H_
+
+/* Timer/Counter 0 Control Register */
+#define TCCR0_REG MBACKEND_REG(0x53)
+
+/* Timer/Counter 0 Register */
+#define TCNT0_REG MBACKEND_REG(0x52)
+
+/* Timer/Counter 0 Output Compare Register */
+#define OCR0_REG MBACKEND_REG(0x5C)
+
+/* Timer/Counter 2 Control Register */
+#define TCCR2_REG MBACKEND_REG(0x45)
+
+/* Timer/Counter 2 Register */
+#define TCNT2_REG MBACKEND_REG(0x44)
+
+/* Timer/Counter 2 Output Compare Register */
+#define OCR2_REG MBACKEND_REG(0x43)
+
+/* Timer/Counter Interrupt Mask Register, shared by all timers */
+#define TIMSK_REG MBACKEND_REG(0x59)
+
+/* Timer/Counter Interrupt Flag Register, shared by all timers */
+#define TIFR_REG MBACKEND_REG(0x58)
+
+/* TCCR0 and TCCR2 bits */
+#define TCCR0_WGM01 3
+#define TCCR2_WGM21 3
+
+/* TIMSK and TIFR bits of Timer 0 */
+#define TIMSK_OCIE0 1
+#define TIFR_OCF0   1
+
+/* TIMSK and TIFR bits of Timer 2 */
+#define TIMSK_OCIE2 7
+#define TIFR_OCF2   7
+
+/* Timer 0 Compare Match interrupt vector */
+#define MTIMER_TIMER0_COMP_VECTOR __vector_10
+
+/* Timer 2 Compare Match interrupt vector */
+#define MTIMER_TIMER2_COMP_VECTOR __vector_4
+
+#endif /* _MTIMER_PRIVATE_H_ */
@@ -0,0 +1,177 @@
+/******************************************************************************
+ *
+ * Module: MTIMER (MCAL Timers)
+ *
+ * File Name: MTIMER_Program.c
+ *
+ * Description: Source file for the MTIMER module functions
+ *
+ * Author: Omar Khedr
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "MTIMER_Interface.h"
+
+/* Function called from the Timer 0 compare match interrupt */
+static void (*MTIMER_PtrTimer0Callback)(void) = NULL;
+
+/* Function called from the Timer 2 compare match interrupt */
+static void (*MTIMER_PtrTimer2Callback)(void) = NULL;
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0Init
+ * Description: Starts Timer 0 in Clear Timer on Compare mode with the configured
+ *              prescaler. The compare interrupt is left disabled.
+ * Parameters:
+ *      - Copy_U8CompareValue: Counts per period minus one (0 to 255)
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0Init(u8 Copy_U8CompareValue)
+{
+	/* Stop the timer while it is configured */
+	TCCR0_REG = 0;
+	TCNT0_REG = 0;
+	OCR0_REG = Copy_U8CompareValue;
+
+	/* Clear a stale compare flag, flags are cleared by writing one */
+	TIFR_REG = (1 << TIFR_OCF0);
+
+	/* CTC mode, the clock select bits start the timer */
+	TCCR0_REG = (1 << TCCR0_WGM01) | MTIMER_TIMER0_PRESCALER;
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0Restart
+ * Description: Restarts the count of Timer 0 and clears a pending compare match, so
+ *              the next interrupt comes one full period from now. The counter keeps
+ *              running while the interrupt is disabled, enabling it again without
+ *              this fires at once and then again after part of a period.
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0Restart(void)
+{
+	TCNT0_REG = 0;
+	TIFR_REG = (1 << TIFR_OCF0);
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0SetCallback
+ * Description: Sets the function called from the Timer 0 compare match interrupt
+ * Parameters:
+ *      - Copy_PtrCallback: The function to call, or NULL for none
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0SetCallback(void (*Copy_PtrCallback)(void))
+{
+	MTIMER_PtrTimer0Callback = Copy_PtrCallback;
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0EnableInterrupt
+ * Description: Enables the Timer 0 compare match interrupt
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0EnableInterrupt(void)
+{
+	SET_BIT(TIMSK_REG, TIMSK_OCIE0);
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer0DisableInterrupt
+ * Description: Disables the Timer 0 compare match interrupt, the timer keeps counting
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer0DisableInterrupt(void)
+{
+	CLR_BIT(TIMSK_REG, TIMSK_OCIE0);
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2Init
+ * Description: Starts Timer 2 in Clear Timer on Compare mode with the configured
+ *              prescaler. The compare interrupt is left disabled.
+ * Parameters:
+ *      - Copy_U8CompareValue: Counts per period minus one (0 to 255)
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2Init(u8 Copy_U8CompareValue)
+{
+	/* Stop the timer while it is configured */
+	TCCR2_REG = 0;
+	TCNT2_REG = 0;
+	OCR2_REG = Copy_U8CompareValue;
+
+	/* Clear a stale compare flag, flags are cleared by writing one */
+	TIFR_REG = (1 << TIFR_OCF2);
+
+	/* CTC mode, the clock select bits start the timer */
+	TCCR2_REG = (1 << TCCR2_WGM21) | MTIMER_TIMER2_PRESCALER;
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2SetCallback
+ * Description: Sets the function called from the Timer 2 compare match interrupt
+ * Parameters:
+ *      - Copy_PtrCallback: The function to call, or NULL for none
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2SetCallback(void (*Copy_PtrCallback)(void))
+{
+	MTIMER_PtrTimer2Callback = Copy_PtrCallback;
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2EnableInterrupt
+ * Description: Enables the Timer 2 compare match interrupt
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2EnableInterrupt(void)
+{
+	SET_BIT(TIMSK_REG, TIMSK_OCIE2);
+}
+
+/************************************************************************************
+ * Function Name: MTIMER_VOIDTimer2DisableInterrupt
+ * Description: Disables the Timer 2 compare match interrupt, the timer keeps counting
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_VOIDTimer2DisableInterrupt(void)
+{
+	CLR_BIT(TIMSK_REG, TIMSK_OCIE2);
+}
+
+/************************************************************************************
+ * Function Name: __vector_10
+ * Description: Timer 0 compare match interrupt service routine
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_TIMER0_COMP_VECTOR(void) MBACKEND_ISR_ATTRIBUTE;
+void MTIMER_TIMER0_COMP_VECTOR(void)
+{
+	if (NULL != MTIMER_PtrTimer0Callback)
+	{
+		MTIMER_PtrTimer0Callback();
+	}
+}
+
+/************************************************************************************
+ * Function Name: __vector_4
+ * Description: Timer 2 compare match interrupt service routine
+ * Parameters: None
+ * Return: None
+ ************************************************************************************/
+void MTIMER_TIMER2_COMP_VECTOR(void) MBACKEND_ISR_ATTRIBUTE;
+void MTIMER_TIMER2_COMP_VECTOR(void)
+{
+	if (NULL != MTIMER_PtrTimer2Callback)
+	{
+		MTIMER_PtrTimer2Callback();
+	}
+}
@@ -1,110 +1,226 @@
-/******************************************************************************
- *
- * Module: Main
- *
- * File Name: main.c
- *
- * Description: Main program to operate the calculator application, handling
- *              user inputs via keypad and displaying results on an LCD.
- *
- * Author: Omar Khedr, Ali Ashraf
- *
- ******************************************************************************/
-
-#include "Application/Calculator_Interface.h"
-
-/******************************************************************************
- * Function Name: main
- * Description: The entry point for the calculator program. Initializes the
- *              LCD and keypad modules, processes user inputs, evaluates
- *              mathematical expressions, and displays results.
- *
- * Parameters:
- *      - None
- *
- * Returns:
- *      - int: Program exit status (0 for success).
- ******************************************************************************/
-int main(void)
-{
-    /* Initialization of LCD and Keypad modules */
-    HLCD_VOIDInitialization();
-    HKPD_VOIDInitialization();
-
-    /* Local variables */
-    u8 LOC_U8KeyPressed, LOC_U8ShiftDisplay = 0, LOC_U8Flag = 1, LOC_U8Counter = 0;
-    u8 LOC_U8ExpressionArray[45];
-    LOC_U8ExpressionArray[0] = '!'; /* Initial marker for the expression */
-
-    while (1)
-    {
-        /* Get the pressed key from the keypad */
-        LOC_U8KeyPressed = HKPD_U8GetPressedValue();
-
-        /* Process the key if it's valid and the flag is active */
-        if (30 != LOC_U8KeyPressed && LOC_U8Flag)
-        {
-            LOC_U8Counter++;
-            if (LOC_U8KeyPressed == 'C') /* Handle clear operation */
-            {
-                HLCD_VOIDDeleteCharacter(LOC_U8Counter - 2);
-                LOC_U8Counter -= 2;
-            }
-            else if (LOC_U8KeyPressed == '=') /* Handle calculation */
-            {
-                LOC_U8ExpressionArray[LOC_U8Counter] = LOC_U8KeyPressed;
-                LOC_U8Counter = Calculator_VOIDCalculation(LOC_U8ExpressionArray);
-            }
-            else /* Add the character to the expression and display it */
-            {
-                LOC_U8ExpressionArray[LOC_U8Counter] = LOC_U8KeyPressed;
-                HLCD_VOIDSendCharacter(LOC_U8KeyPressed);
-            }
-
-            /* Check if the display needs to shift for longer expressions */
-            if (LOC_U8Counter == 15)
-            {
-                LOC_U8ShiftDisplay = 1;
-            }
-
-            while (LOC_U8ShiftDisplay)
-            {
-                LOC_U8KeyPressed = HKPD_U8GetPressedValue();
-                if (LOC_U8KeyPressed != 30)
-                {
-                    if (LOC_U8KeyPressed == 'C') /* Handle clear in shifted display */
-                    {
-                        HLCD_VOIDDeleteCharacter(LOC_U8Counter - 1);
-                        LOC_U8Counter--;
-                        HLCD_VOIDShiftDisplayRight(1);
-                        if (LOC_U8Counter <= 15)
-                        {
-                            LOC_U8ShiftDisplay = 0;
-                        }
-                    }
-                    else if (LOC_U8KeyPressed == '=') /* Handle calculation in shifted display */
-                    {
-                        LOC_U8ExpressionArray[LOC_U8Counter + 1] = LOC_U8KeyPressed;
-                        LOC_U8Counter = Calculator_VOIDCalculation(LOC_U8ExpressionArray);
-                    }
-                    else /* Add character and shift display left */
-                    {
-                        LOC_U8Counter++;
-                        HLCD_VOIDShiftDisplayLeft(1);
-                        LOC_U8ExpressionArray[LOC_U8Counter] = LOC_U8KeyPressed;
-                        HLCD_VOIDSendCharacter(LOC_U8KeyPressed);
-                    }
-
-                    /* Disable shifting and input if the maximum limit is reached */
-                    if (LOC_U8Counter >= 39)
-                    {
-                        LOC_U8ShiftDisplay = 0;
-                        LOC_U8Flag = 0;
-                    }
-                }
-            }
-        }
-    }
-
-    return 0; /* Return success status */
-}
+/******************************************************************************
+ *
+ * Module: Main
+ *
+ * File Name: main.c
+ *
+ * Description: Main program to operate the calculator application, handling
+ *              user inputs via keypad and displaying results on an LCD.
+ *
+ * Author: Omar Khedr, Ali Ashraf
+ *
+ ******************************************************************************/
+
+#include "Application/Calculator_Interface.h"
+#include "MCAL/STACK/MSTACK_Interface.h"
+
+#if MPROFILE_ACTIVE == 1
+/* Pages of the profile dump: the regions, the latency of each kind of key, then the stack */
+#if MPROFILE_ENABLE == 1
+#define MAIN_REGION_PAGES MPROFILE_REGIONS
+#else
+#define MAIN_REGION_PAGES 0
+#endif
+#if MPROFILE_LATENCY == 1
+#define MAIN_LATENCY_PAGES (MAIN_REGION_PAGES + MPROFILE_CLASSES)
+#else
+#define MAIN_LATENCY_PAGES MAIN_REGION_PAGES
+#endif
+#if MSTACK_ENABLE == 1
+#define MAIN_PROFILE_PAGES (MAIN_LATENCY_PAGES + 1)
+#else
+#define MAIN_PROFILE_PAGES MAIN_LATENCY_PAGES
+#endif
+
+#if MPROFILE_LATENCY == 1
+/******************************************************************************
+ * Function Name: MAIN_VOIDSendMilliseconds
+ * Description: Displays a latency in milliseconds with one decimal.
+ *
+ * Parameters:
+ *      - Copy_U16Microseconds: The latency
+ *
+ * Returns: None
+ ******************************************************************************/
+static void MAIN_VOIDSendMilliseconds(u16 Copy_U16Microseconds)
+{
+    HLCD_VOIDSendNumber(Copy_U16Microseconds / 1000);
+    HLCD_VOIDSendCharacter('.');
+    HLCD_VOIDSendCharacter('0' + (Copy_U16Microseconds % 1000) / 100);
+}
+#endif
+
+/******************************************************************************
+ * Function Name: MAIN_VOIDShowProfile
+ * Description: Shows one page of the profile dump. A profiled region shows its
+ *              name and number of calls on the first line, the average and the
+ *              longest duration in CPU cycles on the second. A kind of key
+ *              shows its name and number of presses, then the p50, p95 and p99
+ *              latency in ms from the first scan to the last LCD write. The
+ *              last page shows the stack high-water mark over the stack area,
+ *              in bytes.
+ *
+ * Parameters:
+ *      - Copy_U8Page: The page to show, below MAIN_PROFILE_PAGES
+ *
+ * Returns: None
+ ******************************************************************************/
+static void MAIN_VOIDShowProfile(u8 Copy_U8Page)
+{
+    u8 LOC_U8Name[MPROFILE_NAME_SIZE];
+
+    HLCD_VOIDClearDisplay();
+
+#if MPROFILE_ENABLE == 1
+    if (Copy_U8Page < MAIN_REGION_PAGES)
+    {
+        MPROFILE_RecordType LOC_Record;
+
+        MPROFILE_VOIDGetRecord(Copy_U8Page, &LOC_Record);
+        MPROFILE_VOIDGetName(Copy_U8Page, LOC_U8Name);
+
+        HLCD_VOIDSendString(LOC_U8Name);
+        HLCD_VOIDSendCharacter(' ');
+        HLCD_VOIDSendNumber(LOC_Record.Calls);
+        HLCD_VOIDSetPosition(1, 0);
+        HLCD_VOIDSendNumber(LOC_Record.Calls ? LOC_Record.TotalCycles / LOC_Record.Calls : 0);
+        HLCD_VOIDSendCharacter('/');
+        HLCD_VOIDSendNumber(LOC_Record.MaxCycles);
+    }
+#endif
+
+#if MPROFILE_LATENCY == 1
+    if (Copy_U8Page >= MAIN_REGION_PAGES && Copy_U8Page < MAIN_LATENCY_PAGES)
+    {
+        u8 LOC_U8Class = Copy_U8Page - MAIN_REGION_PAGES;
+
+        MPROFILE_VOIDLatencyGetName(LOC_U8Class, LOC_U8Name);
+
+        HLCD_VOIDSendString(LOC_U8Name);
+        HLCD_VOIDSendCharacter(' ');
+        HLCD_VOIDSendNumber(MPROFILE_U16LatencyCount(LOC_U8Class));
+        HLCD_VOIDSetPosition(1, 0);
+        MAIN_VOIDSendMilliseconds(MPROFILE_U16LatencyPercentile(LOC_U8Class, MPROFILE_STAGE_DISPLAYED, 50));
+        HLCD_VOIDSendCharacter(' ');
+        MAIN_VOIDSendMilliseconds(MPROFILE_U16LatencyPercentile(LOC_U8Class, MPROFILE_STAGE_DISPLAYED, 95));
+        HLCD_VOIDSendCharacter(' ');
+        MAIN_VOIDSendMilliseconds(MPROFILE_U16LatencyPercentile(LOC_U8Class, MPROFILE_STAGE_DISPLAYED, 99));
+    }
+#endif
+
+#if MSTACK_ENABLE == 1
+    if (Copy_U8Page >= MAIN_LATENCY_PAGES)
+    {
+        HLCD_VOIDSendString("Stack");
+        HLCD_VOIDSetPosition(1, 0);
+        HLCD_VOIDSendNumber(MSTACK_U16GetHighWater());
+        HLCD_VOIDSendCharacter('/');
+        HLCD_VOIDSendNumber(MSTACK_U16GetSize());
+    }
+#endif
+}
+
+/******************************************************************************
+ * Function Name: MAIN_U8ProfileChord
+ * Description: Handles the hidden chord of the profile dump. Pressing '='
+ *              while 'C' is held shows the next page instead of the result.
+ *              Releasing 'C' leaves the dump and starts a new expression on a
+ *              cleared display.
+ *
+ * Parameters:
+ *      - Copy_PStrStream: Streaming session of the calculator
+ *      - Copy_U8KeyEvent: Key event taken from the keypad
+ *
+ * Returns:
+ *      - u8: 1 if the event belonged to the chord, 0 if it is for the calculator.
+ ******************************************************************************/
+static u8 MAIN_U8ProfileChord(Calculator_StreamType *Copy_PStrStream, u8 Copy_U8KeyEvent)
+{
+    static u8 LOC_U8ClearHeld = 0;
+    static u8 LOC_U8Page = MAIN_PROFILE_PAGES; /* MAIN_PROFILE_PAGES while no page is shown */
+    u8 LOC_U8Consumed = 0;
+
+    if ('C' == HKPD_EVENT_KEY(Copy_U8KeyEvent))
+    {
+        LOC_U8ClearHeld = !(Copy_U8KeyEvent & HKPD_EVENT_RELEASE);
+        if (!LOC_U8ClearHeld && LOC_U8Page < MAIN_PROFILE_PAGES)
+        {
+            HLCD_VOIDClearDisplay();
+            Calculator_VOIDStreamReset(Copy_PStrStream);
+            LOC_U8Page = MAIN_PROFILE_PAGES;
+            LOC_U8Consumed = 1;
+        }
+    }
+    else if (LOC_U8ClearHeld && '=' == Copy_U8KeyEvent)
+    {
+        LOC_U8Page = (LOC_U8Page + 1 < MAIN_PROFILE_PAGES) ? LOC_U8Page + 1 : 0;
+        MAIN_VOIDShowProfile(LOC_U8Page);
+        LOC_U8Consumed = 1;
+    }
+
+    /* Other keys are ignored while the dump is shown */
+    return LOC_U8Consumed || LOC_U8Page < MAIN_PROFILE_PAGES;
+}
+#endif
+
+/******************************************************************************
+ * Function Name: main
+ * Description: The entry point for the calculator program. Initializes the
+ *              LCD and keypad modules, processes user inputs, evaluates
+ *              mathematical expressions, and displays results.
+ *
+ * Parameters:
+ *      - None
+ *
+ * Returns:
+ *      - int: Program exit status (0 for success).
+ ******************************************************************************/
+int main(void)
+{
+#if MPROFILE_ACTIVE == 1
+    /* Start counting cycles before the drivers run */
+    MPROFILE_VOIDInitialization();
+#endif
+
+    /* Initialization of LCD and Keypad modules */
+    HLCD_VOIDInitialization();
+    HKPD_VOIDInitialization();
+
+    /* Local variables */
+    u8 LOC_U8KeyEvent;
+
+    /* Streaming session, the expression can be as long as the user wants */
+    Calculator_StreamType LOC_Stream;
+    Calculator_VOIDStreamReset(&LOC_Stream);
+
+    while (1)
+    {
+        /* Take the next key event, keys pressed while the LCD was busy are queued */
+        if (HKPD_U8GetEvent(&LOC_U8KeyEvent) && HKPD_EVENT_GHOST != LOC_U8KeyEvent)
+        {
+            if (!(LOC_U8KeyEvent & HKPD_EVENT_RELEASE))
+            {
+                MPROFILE_LATENCY_CONSUME(LOC_U8KeyEvent);
+            }
+#if MPROFILE_ACTIVE == 1
+            if (MAIN_U8ProfileChord(&LOC_Stream, LOC_U8KeyEvent))
+            {
+                HLCD_VOIDFlush();
+                continue;
+            }
+#endif
+            if (!(LOC_U8KeyEvent & HKPD_EVENT_RELEASE))
+            {
+                /* Evaluate, edit and display the expression as keys arrive */
+                Calculator_VOIDStreamFeed(&LOC_Stream, LOC_U8KeyEvent);
+                MPROFILE_LATENCY_EVALUATED();
+
+                /* Send only the LCD cells that changed */
+                HLCD_VOIDFlush();
+                MPROFILE_LATENCY_FLUSHED();
+            }
+        }
+    }
+
+    return 0; /* Return success status */
+}